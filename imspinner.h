@@ -26,13 +26,13 @@
  * 
  */
 
-#include <functional>
 #include <array>
 #include <vector>
 #include <cmath>
 #include <map>
 #include <cctype>
 #include <algorithm>
+#include <cfloat>
 
 #ifdef __has_include
     #if !__has_include(<imgui.h>)
@@ -44,6 +44,20 @@
 #include "imgui.h"
 #include "imgui_internal.h"
 
+// SIMD paths of detail::SinCosBatch; define IMSPINNER_DISABLE_SIMD (or IMGUI_DISABLE_SSE) to use the scalar code.
+#if !defined(IMSPINNER_DISABLE_SIMD) && !defined(IMGUI_DISABLE_SSE)
+    #if defined(__AVX2__)
+        #define IMSPINNER_SIMD_AVX2
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define IMSPINNER_SIMD_SSE2
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define IMSPINNER_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
 namespace ImSpinner
 {
     static const ImColor white{1.f, 1.f, 1.f, 1.f};
@@ -68,10 +82,304 @@ namespace ImSpinner
       e_st_ingyang,
       e_st_barchartsine,
 
+      // Every other spinner, in header order: imspinner.h, then the text, dots, bars and shapes add-ons.
+      // The names and defaults live in the registry of imspinner_compat.h (GetSpinnerInfo).
+      e_st_rainbow_mix,
+      e_st_rotating_heart,
+      e_st_ang8,
+      e_st_ang_mix,
+      e_st_loading_ring,
+      e_st_clock,
+      e_st_pulsar,
+      e_st_double_fade_pulsar,
+      e_st_twin_pulsar,
+      e_st_fade_pulsar,
+      e_st_fade_pulsar_square,
+      e_st_circular_lines,
+      e_st_4_caleidospcope,
+      e_st_thick_to_sin,
+      e_st_square_spins,
+      e_st_twin_ang,
+      e_st_filling,
+      e_st_filling_mem,
+      e_st_topup,
+      e_st_twin_ang180,
+      e_st_twin_ang360,
+      e_st_fade_tris,
+      e_st_ang_twin,
+      e_st_arc_rotation,
+      e_st_arc_fade,
+      e_st_simple_arc_fade,
+      e_st_square_stroke_fade,
+      e_st_ascii_symbol_points,
+      e_st_seven_segments,
+      e_st_square_stroke_fill,
+      e_st_square_stroke_loading,
+      e_st_square_loading,
+      e_st_filled_arc_fade,
+      e_st_points_roller,
+      e_st_points_arc_bounce,
+      e_st_filled_arc_color,
+      e_st_filled_arc_ring,
+      e_st_arc_wedges,
+      e_st_twin_ball,
+      e_st_solar_balls,
+      e_st_solar_scale_balls,
+      e_st_solar_arcs,
+      e_st_moving_arcs,
+      e_st_rainbow_circle,
+      e_st_pulsar_ball,
+      e_st_ang_triple,
+      e_st_gooey_balls,
+      e_st_rotate_gooey_balls,
+      e_st_herbert_balls,
+      e_st_herbert_balls3_d,
+      e_st_rotate_triangles,
+      e_st_rotate_shapes,
+      e_st_sin_squares,
+      e_st_moon_line,
+      e_st_circle_drop,
+      e_st_surrounded_indicator,
+      e_st_wifi_indicator,
+      e_st_triangles_selector,
+      e_st_camera,
+      e_st_flowing_gradient,
+      e_st_rotate_segments,
+      e_st_lemniscate,
+      e_st_rotate_gear,
+      e_st_rotate_wheel,
+      e_st_atom,
+      e_st_pattern_rings,
+      e_st_pattern_eclipse,
+      e_st_pattern_sphere,
+      e_st_ring_synchronous,
+      e_st_ring_watermarks,
+      e_st_rotated_atom,
+      e_st_rainbow_balls,
+      e_st_rainbow_shot,
+      e_st_spiral,
+      e_st_spiral_eye,
+      e_st_blocks,
+      e_st_twin_blocks,
+      e_st_scale_blocks,
+      e_st_scale_squares,
+      e_st_squish_square,
+      e_st_arc_polar_fade,
+      e_st_arc_polar_radius,
+      e_st_caleidoscope,
+      e_st_sine_arcs,
+      e_st_triangles_shift,
+      e_st_points_shift,
+      e_st_circular_points,
+      e_st_curved_circle,
+      e_st_mod_circle,
+      e_st_rotate_segments_pulsar,
+      e_st_spline_ang,
+      e_st_conic_grid,
+      e_st_arc_arrow,
+      e_st_orbit_moon,
+      e_st_conic_wheels,
+      e_st_dot_ring,
+      e_st_text_fade,
+      e_st_text_fading,
+      e_st_text_underline,
+      e_st_text_underline_dots,
+      e_st_text_typing,
+      e_st_text_scroll,
+      e_st_text_color_fill,
+      e_st_text_scroll_colors,
+      e_st_text_color_cycle,
+      e_st_text_bounce,
+      e_st_text_split,
+      e_st_text_underline_scroll,
+      e_st_text_roll,
+      e_st_text_colorful,
+      e_st_text_cascade,
+      e_st_text_conveyor,
+      e_st_text_reveal,
+      e_st_text_wave,
+      e_st_text_sweep,
+      e_st_text_shine,
+      e_st_text_scroll_sweep,
+      e_st_text_spotlight,
+      e_st_text_shake,
+      e_st_text_flip,
+      e_st_text_spin,
+      e_st_text_tumble,
+      e_st_text_swirl,
+      e_st_text_roll_wave,
+      e_st_text_vibrate,
+      e_st_text_glitch,
+      e_st_text_blur,
+      e_st_text_dropout,
+      e_st_text_scanline,
+      e_st_text_squash,
+      e_st_text_scramble,
+      e_st_text_decode,
+      e_st_text_vanish,
+      e_st_bounce_dots,
+      e_st_zip_dots,
+      e_st_dots_to_points,
+      e_st_dots_to_bar,
+      e_st_wave_dots,
+      e_st_fade_dots,
+      e_st_three_dots,
+      e_st_five_dots,
+      e_st_multi_fade_dots,
+      e_st_scale_dots,
+      e_st_moving_dots,
+      e_st_rotate_dots,
+      e_st_orion_dots,
+      e_st_galaxy_dots,
+      e_st_inc_dots,
+      e_st_inc_full_dots,
+      e_st_inc_scale_dots,
+      e_st_some_scale_dots,
+      e_st_dots_loading,
+      e_st_square_random_dots,
+      e_st_hbo_dots,
+      e_st_moon_dots,
+      e_st_twin_hbo_dots,
+      e_st_three_dots_star,
+      e_st_swing_dots,
+      e_st_dna_dots,
+      e_st_3_smuggle_dots,
+      e_st_dots_typing,
+      e_st_dots_step,
+      e_st_dots_gather,
+      e_st_dots_shift,
+      e_st_dots_orbit,
+      e_st_dots_circle,
+      e_st_dots_square,
+      e_st_dots_shuffle,
+      e_st_dots_split,
+      e_st_dots_leader,
+      e_st_dots_rolling,
+      e_st_dots_triangle,
+      e_st_dots_cascade,
+      e_st_dots_swap,
+      e_st_dots_spread,
+      e_st_dots_twin,
+      e_st_dots_hop,
+      e_st_dots_jiggle,
+      e_st_dots_vibrate,
+      e_st_dots_wiper,
+      e_st_dots_collapse,
+      e_st_dots_flip,
+      e_st_dots_turn,
+      e_st_dots_carousel,
+      e_st_dots_half_turn,
+      e_st_dots_slide_flip,
+      e_st_dots_stagger_turn,
+      e_st_dots_stretch,
+      e_st_dots_mirror_stretch,
+      e_st_dots_pinch,
+      e_st_dots_corners,
+      e_st_dots_nudge_rotate,
+      e_st_dots_unfold,
+      e_st_dots_shuttle,
+      e_st_dots_spread_shuttle,
+      e_st_dots_triad,
+      e_st_dots_satellite,
+      e_st_dots_track,
+      e_st_fade_bars,
+      e_st_bars_rotate_fade,
+      e_st_bars_scale_middle,
+      e_st_bar_chart_adv_sine,
+      e_st_bar_chart_adv_sine_fade,
+      e_st_bar_chart_rainbow,
+      e_st_fluid,
+      e_st_fluid_points,
+      e_st_bars_seq_pulse,
+      e_st_bars_cascade_grow,
+      e_st_bars_rise,
+      e_st_bars_corner_hop,
+      e_st_bars_diagonal_grow,
+      e_st_bars_bounce_center,
+      e_st_bars_scale_alt,
+      e_st_bars_corner_wave,
+      e_st_bars_jump,
+      e_st_bars_double_row,
+      e_st_bars_six_pulse,
+      e_st_bars_six_stagger,
+      e_st_bars_morph_plus,
+      e_st_bars_flip_six,
+      e_st_bars_swap_tri_bottom,
+      e_st_bars_swap_tri_zigzag,
+      e_st_bars_morph_diagonal,
+      e_st_bars_slide_diagonal,
+      e_st_bars_conic_alternate,
+      e_st_bars_conic_walk,
+      e_st_bars_march_in,
+      e_st_bars_march_down,
+      e_st_bars_wave_skew,
+      e_st_bars_row_drop,
+      e_st_bars_zigzag_rows,
+      e_st_bars_fill_cascade,
+      e_st_bars_ping_pong_rows,
+      e_st_bars_wave_rows_wide,
+      e_st_bars_grid_fade,
+      e_st_bars_grid_spread,
+      e_st_bars_stretch,
+      e_st_bars_stretch_seq,
+      e_st_bars_bounce_ball,
+      e_st_bars_knock_dots,
+      e_st_bars_staircase,
+      e_st_bars_knock_away,
+      e_st_bars_gates,
+      e_st_bars_capture,
+      e_st_bars_escape,
+      e_st_bars_devour,
+      e_st_bars_lift,
+      e_st_bars_gap_slide,
+      e_st_bars_converge,
+      e_st_bars_swap_ends,
+      e_st_bars_relay,
+      e_st_bars_push,
+      e_st_bars_push_wave,
+      e_st_bars_gather,
+      e_st_bars_split,
+      e_st_bars_slot,
+      e_st_morph_shape,
+      e_st_flip_triangle,
+      e_st_fold_square,
+      e_st_pinwheel,
+      e_st_corner_squares,
+      e_st_split_square,
+      e_st_corner_burst,
+      e_st_skew_square,
+      e_st_tumble_square,
+      e_st_tri_diamond,
+      e_st_twin_blades,
+      e_st_cross_blades,
+      e_st_drift_square,
+      e_st_pie_bounce,
+      e_st_leap_frog,
+      e_st_plus_squares,
+      e_st_seven_march,
+      e_st_corner_arcs,
+      e_st_walk_blocks,
+      e_st_tumble_half_disc,
+      e_st_fold_half_disc,
+      e_st_wiper_arrow,
+      e_st_skew_squares,
+      e_st_stretch_squares,
+      e_st_tri_pie,
+      e_st_shuffle_bars,
+      e_st_hinge_tumble,
+      e_st_diagonal_flip,
+      e_st_pulse_grid,
+      e_st_march_grid,
+      e_st_spin_bars,
+      e_st_morph_dots,
+      e_st_comb_discs,
+      e_st_orbit_disc,
+
       e_st_count
     };
 
     using float_ptr = float *;
+    using text_ptr = const char *;
     constexpr float PI_DIV_4 = IM_PI / 4.f;
     constexpr float PI_DIV_2 = IM_PI / 2.f;
     constexpr float PI_2 = IM_PI * 2.f;
@@ -95,9 +403,33 @@ namespace ImSpinner
     DECLPROP (Reverse, bool, false)
     DECLPROP (Delta, float, 0.f)
     DECLPROP (Mode, int, 0)
+    DECLPROP (Text, text_ptr, "Loading...")
+    DECLPROP (Ext, int, 0)
+    DECLPROP (Radius2, float, 0.f)
+    DECLPROP (Radius3, float, 0.f)
+    DECLPROP (Speed2, float, 0.f)
+    DECLPROP (Thickness2, float, 0.f)
+    DECLPROP (MinFade, float, 0.f)
+    DECLPROP (ScaleY, float, 0.f)
 #undef DECLPROP
 
     namespace detail {
+      inline float &TessellationQuality() { static float quality = 1.f; return quality; }
+
+      // Segments needed to keep a circular arc of this radius and sweep within style.CircleTessellationMaxError
+      // framebuffer pixels (divided by the SetSpinnerQuality() knob), the same error bound dear imgui uses for
+      // AddCircle, but measured at the framebuffer scale and only over the swept angle.
+      inline int ArcSegments(float radius, float sweep) {
+        const ImGuiIO &io = ImGui::GetIO();
+        const float scale = ImMax(io.DisplayFramebufferScale.x, io.DisplayFramebufferScale.y);
+        const float r = radius * (scale > 0.f ? scale : 1.f);
+        if (r <= 0.f)
+          return 2;
+        const float error = ImMin(ImGui::GetStyle().CircleTessellationMaxError / TessellationQuality(), r);
+        const float step = 2.f * ImAcos(1.f - error / r);
+        return ImClamp((int)ImCeil(ImFabs(sweep) / step), 2, 512);
+      }
+
       // SpinnerBegin is a function that starts a spinner widget, used to display an animation indicating that
       // a task is in progress. It returns true if the widget is visible and can be used, or false if it should be skipped.
       inline bool SpinnerBegin(const char *label, float radius, ImVec2 &pos, ImVec2 &size, ImVec2 &centre, int &num_segments) {
@@ -116,7 +448,8 @@ namespace ImSpinner
         const ImRect bb(pos, ImVec2(pos.x + size.x, pos.y + size.y));
         ImGui::ItemSize(bb, style.FramePadding.y);
 
-        num_segments = window->DrawList->_CalcCircleAutoSegmentCount(radius);
+        // Full circle, rounded up to even like dear imgui's own auto segment count.
+        num_segments = ImMax(4, (ArcSegments(radius, PI_2) + 1) & ~1);
 
         centre = bb.GetCenter();
         // If the item cannot be added to the window, return false
@@ -126,7 +459,7 @@ namespace ImSpinner
         return true;
       }
 
-#define IMPLRPOP(basetype,type) basetype m_##type; \
+#define IMPLRPOP(basetype,type) basetype m_##type{}; \
                                 void set##type(const basetype& v) { m_##type = v;} \
                                 void set(type h) { m_##type = h.value;} \
                                 template<typename First, typename... Args> \
@@ -155,6 +488,14 @@ namespace ImSpinner
         IMPLRPOP(bool, Reverse)
         IMPLRPOP(float, Delta)
         IMPLRPOP(int, Mode)
+        IMPLRPOP(text_ptr, Text)
+        IMPLRPOP(int, Ext)
+        IMPLRPOP(float, Radius2)
+        IMPLRPOP(float, Radius3)
+        IMPLRPOP(float, Speed2)
+        IMPLRPOP(float, Thickness2)
+        IMPLRPOP(float, MinFade)
+        IMPLRPOP(float, ScaleY)
       };
 #undef IMPLRPOP
 
@@ -177,19 +518,989 @@ namespace ImSpinner
         draw_list->AddPolyline(points, num_points, col, flags, thickness);
 #endif
       }
+
+      // Strokes an open path of num_segments points around centre. The point generator is a template parameter
+      // rather than a std::function, so the per-point closure call is inlined instead of going through an indirect call.
+      template<typename F>
+      inline void EmitCircle(ImDrawList* draw_list, const ImVec2 &centre, int num_segments, const F &point_func, ImU32 col, float thickness) {
+        draw_list->PathClear();
+        draw_list->_Path.reserve(num_segments);
+        for (int i = 0; i < num_segments; i++) {
+          const ImVec2 p = point_func(i);
+          draw_list->_Path.push_back(ImVec2(centre.x + p.x, centre.y + p.y));
+        }
+        PathStroke(draw_list, col, thickness, 0);
+      }
+
+      // Cache of derived data (unit circles, meshes, text metrics) keyed by a hash of its inputs, holding at
+      // most Capacity entries. Open addressing with linear probing over 2 * Capacity slots. When it is full the
+      // whole table is dropped at once, but the slots and the buffers inside their values are kept: a rebuilt
+      // entry refills a buffer that usually has room already, so even a cache that keeps overflowing (inputs
+      // animated every frame) stops allocating once its buffers have grown to their largest size.
+      template<typename T, int Capacity>
+      struct BoundedCache {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        struct Slot { ImGuiID key; T value; };
+        std::vector<Slot> slots;  // key 0 marks an empty slot
+        int count = 0;
+
+        // The entry for key. found is false for a new entry, whose value still holds whatever a dropped entry
+        // left there and must be refilled.
+        T &Get(ImGuiID key, bool &found) {
+          if (key == 0)
+            key = 1;
+          if (slots.empty())
+            slots.resize(Capacity * 2, Slot{ 0, T() });
+
+          const size_t mask = slots.size() - 1;
+          for (size_t i = key & mask; ; i = (i + 1) & mask) {
+            Slot &slot = slots[i];
+            if (slot.key == key) {
+              found = true;
+              return slot.value;
+            }
+            if (slot.key == 0) {
+              if (count >= Capacity) {
+                for (Slot &s : slots)
+                  s.key = 0;
+                count = 0;
+                return Get(key, found);
+              }
+              slot.key = key;
+              count++;
+              found = false;
+              return slot.value;
+            }
+          }
+        }
+      };
+
+      // Returns count unit-circle points (cos(i * step), sin(i * step)), cached per (count, step) the same way
+      // ImDrawListSharedData keeps ArcFastVtx, so ring spinners don't pay two transcendental calls per point
+      // every frame. A ring rotated by some angle is then one complex multiply per point, see RotateUnit.
+      // The pointer stays valid until the next UnitCircle call.
+      inline const ImVec2* UnitCircle(int count, float step) {
+        struct Circle { int count; float step; std::vector<ImVec2> points; };
+        static BoundedCache<Circle, 256> cache;  // segment counts following an animated radius keep changing
+        if (count <= 0)
+          return nullptr;
+
+        bool found;
+        Circle &circle = cache.Get(ImHashData(&step, sizeof(step), ImHashData(&count, sizeof(count))), found);
+        if (found && circle.count == count && circle.step == step)
+          return circle.points.data();
+
+        circle.count = count;  // a new entry, or a hash collision rebuilt in place
+        circle.step = step;
+        circle.points.resize(count);
+        for (int i = 0; i < count; i++)
+          circle.points[i] = ImVec2(ImCos(i * step), ImSin(i * step));
+        return circle.points.data();
+      }
+
+      // Rotates a unit-circle point by the angle whose cosine/sine are (c, s) and scales it by r.
+      inline ImVec2 RotateUnit(const ImVec2 &u, float c, float s, float r) {
+        return ImVec2((u.x * c - u.y * s) * r, (u.x * s + u.y * c) * r);
+      }
+
+      // Vectorized sin/cos for whole arcs. The kernel is the Cephes sinf/cosf scheme: reduction by pi/4 in
+      // three parts (Cody-Waite) and minimax polynomials on [-pi/4, pi/4], evaluated 8 (AVX2) or 4 (SSE2, NEON)
+      // lanes at a time, with a scalar copy of the same code for the tail and other targets. Checked against
+      // double precision libm: for |a| <= 8192 the absolute error is below 9.4e-8, i.e. within 2 ulp for results
+      // of magnitude 0.5..1; close to the zeros the relative error is larger (up to 14 ulp for |a| <= 64).
+      // SinCosBatch reduces the start angle to [0, 2pi) first, so long-running animation clocks stay accurate.
+      namespace sincos {
+        static const float FOPI = 1.27323954473516f;   // 4 / pi
+        static const float DP1 = 0.78515625f, DP2 = 2.4187564849853515625e-4f, DP3 = 3.77489497744594108e-8f;
+        static const float S0 = -1.9515295891e-4f, S1 = 8.3321608736e-3f, S2 = -1.6666654611e-1f;
+        static const float C0 = 2.443315711809948e-5f, C1 = -1.388731625493765e-3f, C2 = 4.166664568298827e-2f;
+
+        inline void Scalar(float a, float &s, float &c) {
+          const float x = ImFabs(a);
+          const int j = ((int)(x * FOPI) + 1) & ~1;
+          const float y = (float)j;
+          const float z = ((x - y * DP1) - y * DP2) - y * DP3, zz = z * z;
+          const float ps = z + z * zz * ((S0 * zz + S1) * zz + S2);
+          const float pc = 1.f - 0.5f * zz + zz * zz * ((C0 * zz + C1) * zz + C2);
+          const bool swap = (j & 2) != 0;
+          s = ((j & 4) != 0) != (a < 0.f) ? -(swap ? pc : ps) : (swap ? pc : ps);
+          c = ((j - 2) & 4) == 0 ? -(swap ? ps : pc) : (swap ? ps : pc);
+        }
+
+#if defined(IMSPINNER_SIMD_AVX2)
+        inline void Lanes(__m256 a, float *s, float *c) {
+          const __m256 sign_mask = _mm256_set1_ps(-0.f);
+          const __m256 x = _mm256_andnot_ps(sign_mask, a);
+          __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FOPI)));
+          j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+          const __m256 y = _mm256_cvtepi32_ps(j);
+          __m256 z = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP1)));
+          z = _mm256_sub_ps(z, _mm256_mul_ps(y, _mm256_set1_ps(DP2)));
+          z = _mm256_sub_ps(z, _mm256_mul_ps(y, _mm256_set1_ps(DP3)));
+          const __m256 zz = _mm256_mul_ps(z, z);
+          __m256 ps = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(S0), zz), _mm256_set1_ps(S1));
+          ps = _mm256_add_ps(_mm256_mul_ps(ps, zz), _mm256_set1_ps(S2));
+          ps = _mm256_add_ps(z, _mm256_mul_ps(_mm256_mul_ps(z, zz), ps));
+          __m256 pc = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(C0), zz), _mm256_set1_ps(C1));
+          pc = _mm256_add_ps(_mm256_mul_ps(pc, zz), _mm256_set1_ps(C2));
+          pc = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.f), _mm256_mul_ps(_mm256_set1_ps(0.5f), zz)), _mm256_mul_ps(_mm256_mul_ps(zz, zz), pc));
+          const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(2)));
+          const __m256 sin_sign = _mm256_xor_ps(_mm256_and_ps(sign_mask, a), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29)));
+          const __m256 cos_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+          _mm256_storeu_ps(s, _mm256_xor_ps(_mm256_blendv_ps(ps, pc, swap), sin_sign));
+          _mm256_storeu_ps(c, _mm256_xor_ps(_mm256_blendv_ps(pc, ps, swap), cos_sign));
+        }
+#elif defined(IMSPINNER_SIMD_SSE2)
+        inline __m128 Select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+        inline void Lanes(__m128 a, float *s, float *c) {
+          const __m128 sign_mask = _mm_set1_ps(-0.f);
+          const __m128 x = _mm_andnot_ps(sign_mask, a);
+          __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FOPI)));
+          j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+          const __m128 y = _mm_cvtepi32_ps(j);
+          __m128 z = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP1)));
+          z = _mm_sub_ps(z, _mm_mul_ps(y, _mm_set1_ps(DP2)));
+          z = _mm_sub_ps(z, _mm_mul_ps(y, _mm_set1_ps(DP3)));
+          const __m128 zz = _mm_mul_ps(z, z);
+          __m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(S0), zz), _mm_set1_ps(S1));
+          ps = _mm_add_ps(_mm_mul_ps(ps, zz), _mm_set1_ps(S2));
+          ps = _mm_add_ps(z, _mm_mul_ps(_mm_mul_ps(z, zz), ps));
+          __m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(C0), zz), _mm_set1_ps(C1));
+          pc = _mm_add_ps(_mm_mul_ps(pc, zz), _mm_set1_ps(C2));
+          pc = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), zz)), _mm_mul_ps(_mm_mul_ps(zz, zz), pc));
+          const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+          const __m128 sin_sign = _mm_xor_ps(_mm_and_ps(sign_mask, a), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+          const __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+          _mm_storeu_ps(s, _mm_xor_ps(Select(swap, pc, ps), sin_sign));
+          _mm_storeu_ps(c, _mm_xor_ps(Select(swap, ps, pc), cos_sign));
+        }
+#elif defined(IMSPINNER_SIMD_NEON)
+        inline void Lanes(float32x4_t a, float *s, float *c) {
+          const float32x4_t x = vabsq_f32(a);
+          int32x4_t j = vcvtq_s32_f32(vmulq_n_f32(x, FOPI));
+          j = vandq_s32(vaddq_s32(j, vdupq_n_s32(1)), vdupq_n_s32(~1));
+          const float32x4_t y = vcvtq_f32_s32(j);
+          float32x4_t z = vmlsq_n_f32(x, y, DP1);
+          z = vmlsq_n_f32(z, y, DP2);
+          z = vmlsq_n_f32(z, y, DP3);
+          const float32x4_t zz = vmulq_f32(z, z);
+          float32x4_t ps = vmlaq_n_f32(vdupq_n_f32(S1), zz, S0);
+          ps = vmlaq_f32(vdupq_n_f32(S2), ps, zz);
+          ps = vmlaq_f32(z, vmulq_f32(z, zz), ps);
+          float32x4_t pc = vmlaq_n_f32(vdupq_n_f32(C1), zz, C0);
+          pc = vmlaq_f32(vdupq_n_f32(C2), pc, zz);
+          pc = vmlaq_f32(vmlsq_n_f32(vdupq_n_f32(1.f), zz, 0.5f), vmulq_f32(zz, zz), pc);
+          const uint32x4_t swap = vtstq_s32(j, vdupq_n_s32(2));
+          const uint32x4_t sin_sign = veorq_u32(vandq_u32(vreinterpretq_u32_f32(a), vdupq_n_u32(0x80000000u)),
+                                                vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(j, vdupq_n_s32(4))), 29));
+          const uint32x4_t cos_sign = vshlq_n_u32(vreinterpretq_u32_s32(vbicq_s32(vdupq_n_s32(4), vsubq_s32(j, vdupq_n_s32(2)))), 29);
+          vst1q_f32(s, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, pc, ps)), sin_sign)));
+          vst1q_f32(c, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, ps, pc)), cos_sign)));
+        }
+#endif
+      }
+
+      // Fills c[i] = cos(start + i * step) and s[i] = sin(start + i * step) for i < n.
+      inline void SinCosBatch(float *c, float *s, int n, float start, float step) {
+        start = (float)std::fmod((double)start, 6.283185307179586);
+        int i = 0;
+#if defined(IMSPINNER_SIMD_AVX2)
+        const __m256 lane = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+        for (; i + 8 <= n; i += 8)
+          sincos::Lanes(_mm256_add_ps(_mm256_set1_ps(start), _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps((float)i), lane), _mm256_set1_ps(step))), s + i, c + i);
+#elif defined(IMSPINNER_SIMD_SSE2)
+        const __m128 lane = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+        for (; i + 4 <= n; i += 4)
+          sincos::Lanes(_mm_add_ps(_mm_set1_ps(start), _mm_mul_ps(_mm_add_ps(_mm_set1_ps((float)i), lane), _mm_set1_ps(step))), s + i, c + i);
+#elif defined(IMSPINNER_SIMD_NEON)
+        static const float lanes[4] = { 0.f, 1.f, 2.f, 3.f };
+        const float32x4_t lane = vld1q_f32(lanes);
+        for (; i + 4 <= n; i += 4)
+          sincos::Lanes(vmlaq_n_f32(vdupq_n_f32(start), vaddq_f32(vdupq_n_f32((float)i), lane), step), s + i, c + i);
+#endif
+        for (; i < n; i++)
+          sincos::Scalar(start + i * step, s[i], c[i]);
+      }
+
+      // cos / sin of one arc as SoA arrays, kept in a buffer reused across frames (one per call site):
+      //   static detail::ArcTable arc; arc.Fill(n, start, step); ... arc.c[i], arc.s[i]
+      struct ArcTable {
+        std::vector<float> c, s;
+
+        void Fill(int n, float start, float step) {
+          if ((int)c.size() < n) { c.resize(n); s.resize(n); }
+          if (n > 0)
+            SinCosBatch(c.data(), s.data(), n, start, step);
+        }
+      };
+
+#ifdef IMSPINNER_ENABLE_DISC_SPRITES
+      // Anti-aliased disc sprites in the font atlas (opt-in, see SetupDiscSprites). Sprite k is a disc of
+      // radius[k] texels centred in a (2 * radius + 2)^2 texel rect, so bilinear sampling stays inside the rect.
+      struct DiscSprites {
+        static constexpr int count = 4;
+        const int radius[count] = { 4, 8, 16, 32 };
+        ImFontAtlas *atlas = nullptr;
+#if IMGUI_VERSION_NUM < 19197
+        int rects[count] = {};
+#else
+        ImFontAtlasRectId rects[count] = {};
+#endif
+      };
+
+      inline DiscSprites &GetDiscSprites() { static DiscSprites sprites; return sprites; }
+
+      // Coverage of texel (x, y) by a disc of radius r centred at (r + 1, r + 1), with the same 1 px fringe
+      // AddConvexPolyFilled puts around filled shapes.
+      inline unsigned char DiscSpriteAlpha(int x, int y, int r) {
+        const float dx = x + 0.5f - (r + 1), dy = y + 0.5f - (r + 1);
+        return (unsigned char)(ImClamp(r + 0.5f - ImSqrt(dx * dx + dy * dy), 0.f, 1.f) * 255.f + 0.5f);
+      }
+
+      // Draws the batch as one textured quad per disc. Returns false, drawing nothing, when sprites are not set
+      // up, the font texture is not the one bound, or a disc is larger than the largest sprite.
+      inline bool AddDiscSpritesBatch(ImDrawList *draw_list, const ImVec2 *centres, const float *radii, const ImU32 *cols, int n)
+      {
+        const DiscSprites &sprites = GetDiscSprites();
+        ImFontAtlas *atlas = sprites.atlas;
+        if (!atlas)
+          return false;
+
+        // The quads sample the font texture, which is what a draw list has bound unless a texture was pushed.
+#if IMGUI_VERSION_NUM < 19197
+        if (draw_list->_CmdHeader.TextureId != atlas->TexID)
+          return false;
+#else
+        if (draw_list->_CmdHeader.TexRef._TexData != atlas->TexData)
+          return false;
+#endif
+
+        ImVec2 uv0[DiscSprites::count], uv1[DiscSprites::count];
+        for (int k = 0; k < DiscSprites::count; k++) {
+#if IMGUI_VERSION_NUM < 19197
+          const ImFontAtlasCustomRect *rect = atlas->GetCustomRectByIndex(sprites.rects[k]);
+          if (!rect)
+            return false;
+          atlas->CalcCustomRectUV(rect, &uv0[k], &uv1[k]);
+#else
+          ImFontAtlasRect rect;
+          if (!atlas->GetCustomRect(sprites.rects[k], &rect))
+            return false;
+          uv0[k] = rect.uv0;
+          uv1[k] = rect.uv1;
+#endif
+        }
+
+        // Sprites are picked by radius in framebuffer pixels; a sprite never gets magnified.
+        const float scale = ImGui::GetIO().DisplayFramebufferScale.x > 0.f ? ImGui::GetIO().DisplayFramebufferScale.x : 1.f;
+        const float max_radius = sprites.radius[DiscSprites::count - 1] / scale;
+        int count = 0;
+        for (int i = 0; i < n; i++) {
+          if ((cols[i] & IM_COL32_A_MASK) == 0 || radii[i] < 0.5f)
+            continue;
+          if (radii[i] > max_radius)
+            return false;
+          count++;
+        }
+
+        const int chunk = 0x8000 / 4;
+        for (int i = 0; count > 0; ) {
+          const int quads = ImMin(count, chunk);
+          count -= quads;
+          draw_list->PrimReserve(quads * 6, quads * 4);
+          for (int done = 0; done < quads; i++) {
+            if ((cols[i] & IM_COL32_A_MASK) == 0 || radii[i] < 0.5f)
+              continue;
+
+            int k = 0;
+            while (sprites.radius[k] < radii[i] * scale)
+              k++;
+            const float h = radii[i] * (sprites.radius[k] + 1) / sprites.radius[k];
+            draw_list->PrimRectUV(ImVec2(centres[i].x - h, centres[i].y - h), ImVec2(centres[i].x + h, centres[i].y + h), uv0[k], uv1[k], cols[i]);
+            done++;
+          }
+        }
+        return true;
+      }
+#endif // IMSPINNER_ENABLE_DISC_SPRITES
+
+      // Appends n filled discs the way AddCircleFilled(centres[i], radii[i], cols[i], segs) draws them, AA fringe
+      // included, with one PrimReserve for the batch: vertices are the shared unit-circle template (UnitCircle)
+      // scaled per disc, and the fan / fringe indices follow a fixed pattern, so no path is built and no normals
+      // are computed per disc. segs <= 0 picks the automatic segment count of the largest radius. With disc
+      // sprites compiled in and set up (SetupDiscSprites) the discs become textured quads instead.
+      inline void AddDiscsBatch(ImDrawList *draw_list, const ImVec2 *centres, const float *radii, const ImU32 *cols, int n, int segs)
+      {
+        // Same early-outs as AddCircleFilled.
+        auto visible = [&] (int i) { return (cols[i] & IM_COL32_A_MASK) != 0 && radii[i] >= 0.5f; };
+        int count = 0;
+        float max_radius = 0.f;
+        for (int i = 0; i < n; i++)
+          if (visible(i)) { count++; max_radius = ImMax(max_radius, radii[i]); }
+        if (count == 0)
+          return;
+#ifdef IMSPINNER_ENABLE_DISC_SPRITES
+        if (AddDiscSpritesBatch(draw_list, centres, radii, cols, n))
+          return;
+#endif
+
+        segs = ImClamp(segs > 0 ? segs : draw_list->_CalcCircleAutoSegmentCount(max_radius), 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        const ImVec2 *unit = UnitCircle(segs, PI_2 / segs);
+        const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+        const bool aa = (draw_list->Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+        const int disc_vtx = aa ? segs * 2 : segs;
+        const int disc_idx = aa ? (segs - 2) * 3 + segs * 6 : (segs - 2) * 3;
+
+        // AddConvexPolyFilled moves the fringe vertices half the fringe width along the averaged edge normals;
+        // on a regular polygon that is the radial direction, scaled by 1 / cos(pi / segs).
+#if IMGUI_VERSION_NUM >= 18200
+        const float fringe = draw_list->_FringeScale;
+#else
+        const float fringe = 1.f;
+#endif
+        const float half_fringe = aa ? fringe * 0.5f / ImCos(IM_PI / segs) : 0.f;
+
+        // Reservations stay well below 64k vertices, so they remain addressable with 16-bit indices.
+        const int chunk = ImMax(1, 0x8000 / disc_vtx);
+        for (int i = 0; count > 0; ) {
+          const int discs = ImMin(count, chunk);
+          count -= discs;
+          draw_list->PrimReserve(discs * disc_idx, discs * disc_vtx);
+
+          ImDrawVert *vtx = draw_list->_VtxWritePtr;
+          ImDrawIdx *idx = draw_list->_IdxWritePtr;
+          unsigned int base = draw_list->_VtxCurrentIdx;
+          for (int done = 0; done < discs; i++) {
+            if (!visible(i))
+              continue;
+
+            const ImVec2 c = centres[i];
+            const ImU32 col = cols[i];
+            if (aa) {
+              const float r_in = radii[i] - half_fringe, r_out = radii[i] + half_fringe;
+              const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+              for (int k = 0; k < segs; k++, vtx += 2) {
+                vtx[0].pos = ImVec2(c.x + unit[k].x * r_in, c.y + unit[k].y * r_in); vtx[0].uv = uv; vtx[0].col = col;
+                vtx[1].pos = ImVec2(c.x + unit[k].x * r_out, c.y + unit[k].y * r_out); vtx[1].uv = uv; vtx[1].col = col_trans;
+              }
+              for (int k = 2; k < segs; k++, idx += 3) {
+                idx[0] = (ImDrawIdx)base; idx[1] = (ImDrawIdx)(base + ((k - 1) << 1)); idx[2] = (ImDrawIdx)(base + (k << 1));
+              }
+              for (int k0 = segs - 1, k1 = 0; k1 < segs; k0 = k1++, idx += 6) {
+                const unsigned int in0 = base + (k0 << 1), in1 = base + (k1 << 1);
+                idx[0] = (ImDrawIdx)in1; idx[1] = (ImDrawIdx)in0; idx[2] = (ImDrawIdx)(in0 + 1);
+                idx[3] = (ImDrawIdx)(in0 + 1); idx[4] = (ImDrawIdx)(in1 + 1); idx[5] = (ImDrawIdx)in1;
+              }
+            } else {
+              const float r = radii[i];
+              for (int k = 0; k < segs; k++, vtx++) {
+                vtx->pos = ImVec2(c.x + unit[k].x * r, c.y + unit[k].y * r); vtx->uv = uv; vtx->col = col;
+              }
+              for (int k = 2; k < segs; k++, idx += 3) {
+                idx[0] = (ImDrawIdx)base; idx[1] = (ImDrawIdx)(base + k - 1); idx[2] = (ImDrawIdx)(base + k);
+              }
+            }
+            base += disc_vtx;
+            done++;
+          }
+
+          draw_list->_VtxWritePtr = vtx;
+          draw_list->_IdxWritePtr = idx;
+          draw_list->_VtxCurrentIdx = base;
+        }
+      }
+
+      // Collects the discs of a spinner and draws them through AddDiscsBatch when the segment count changes and
+      // when it goes out of scope. Add() takes the AddCircleFilled arguments; as the discs are deferred, use it
+      // where nothing else is drawn in between. All batches share one set of buffers, so only one may be alive.
+      //   detail::DiscBatch discs(window->DrawList);
+      //   discs.Add(p, thickness, color_alpha(color, 1.f), 8);
+      struct DiscBatch {
+        struct Buffers {
+          std::vector<ImVec2> centres;
+          std::vector<float> radii;
+          std::vector<ImU32> cols;
+        };
+
+        ImDrawList *draw_list;
+        int segs = 0;
+
+        static Buffers &Scratch() { static Buffers buffers; return buffers; }
+
+        explicit DiscBatch(ImDrawList *dl) : draw_list(dl) { Clear(); }
+        ~DiscBatch() { Flush(); }
+        DiscBatch(const DiscBatch &) = delete;
+        DiscBatch &operator=(const DiscBatch &) = delete;
+
+        void Add(const ImVec2 &centre, float radius, ImU32 col, int num_segments = 0) {
+          if (num_segments <= 0)
+            num_segments = draw_list->_CalcCircleAutoSegmentCount(radius);
+          if (num_segments != segs) {
+            Flush();
+            segs = num_segments;
+          }
+          Buffers &b = Scratch();
+          b.centres.push_back(centre);
+          b.radii.push_back(radius);
+          b.cols.push_back(col);
+        }
+
+        void Flush() {
+          Buffers &b = Scratch();
+          if (!b.centres.empty())
+            AddDiscsBatch(draw_list, b.centres.data(), b.radii.data(), b.cols.data(), (int)b.centres.size(), segs);
+          Clear();
+        }
+
+        void Clear() {
+          Buffers &b = Scratch();
+          b.centres.clear();
+          b.radii.clear();
+          b.cols.clear();
+        }
+      };
+
+      // Collects the unrounded filled rects of a spinner as vertices and indices and appends them with one
+      // PrimReserve when it goes out of scope (or on Flush()); Add() takes the AddRectFilled arguments and draws
+      // the same triangles. A rect that continues the previous one with the same colour and height widens it, one
+      // that continues it along a shared top or bottom edge extends its strip: the shared edge is a single row of
+      // vertices, so k columns take 3k + 1 vertices instead of 4k. As with DiscBatch, rects are deferred, so flush
+      // before drawing anything that must go on top of them, and only one batch may be alive at a time.
+      //   detail::RectBatch rects(window->DrawList);
+      //   rects.Add(ImVec2(x0, y0), ImVec2(x1, y1), c);
+      struct RectBatch {
+        // vtx / idx only grow; vtx_count / idx_count are the used part. Indices are relative to the first vertex.
+        struct Buffers {
+          std::vector<ImDrawVert> vtx;
+          std::vector<ImDrawIdx> idx;
+          int vtx_count = 0, idx_count = 0;
+        };
+
+        ImDrawList *draw_list;
+        ImVec2 uv;
+        // Current strip: its colour, column count, which edge is shared, the last column and its shared-edge vertex.
+        ImU32 run_col = 0;
+        int run_count = 0;
+        bool run_top = false;
+        float last_x1 = 0.f, last_y0 = 0.f, last_y1 = 0.f;
+        unsigned int last_shared = 0;
+
+        static Buffers &Scratch() { static Buffers buffers; return buffers; }
+
+        explicit RectBatch(ImDrawList *dl) : draw_list(dl), uv(dl->_Data->TexUvWhitePixel) { Clear(); }
+        ~RectBatch() { Flush(); }
+        RectBatch(const RectBatch &) = delete;
+        RectBatch &operator=(const RectBatch &) = delete;
+
+        void Add(const ImVec2 &p_min, const ImVec2 &p_max, ImU32 col) {
+          if ((col & IM_COL32_A_MASK) == 0)
+            return;
+          const float x0 = ImMin(p_min.x, p_max.x), x1 = ImMax(p_min.x, p_max.x);
+          const float y0 = ImMin(p_min.y, p_max.y), y1 = ImMax(p_min.y, p_max.y);
+          Buffers &b = Scratch();
+
+          if (run_count > 0 && col == run_col && x0 == last_x1) {
+            ImDrawVert *last = b.vtx.data() + b.vtx_count - 4;
+            if (y0 == last_y0 && y1 == last_y1) {
+              // Same height: move the right edge of the last column.
+              last[1].pos.x = last[3].pos.x = last_x1 = x1;
+              return;
+            }
+            if (run_count == 1 && y0 == last_y0) {
+              // Second column decides the shared edge; a new strip starts out sharing the bottom one.
+              last[0].pos.y = last[1].pos.y = last_y0;
+              last[2].pos.y = last[3].pos.y = last_y1;
+              run_top = true;
+            }
+            if ((run_top ? y0 == last_y0 : y1 == last_y1) && b.vtx_count + 3 <= 0x8000) {
+              AddColumn(b, x0, x1, y0, y1);
+              return;
+            }
+          }
+
+          // Reservations stay well below 64k vertices, so they remain addressable with 16-bit indices.
+          if (b.vtx_count + 4 > 0x8000)
+            Flush();
+          run_col = col;
+          run_count = 0;
+          run_top = false;
+          last_shared = (unsigned int)b.vtx_count;
+          Reserve(b, 1, 0);
+          WriteVtx(b.vtx[b.vtx_count++], x0, y1);
+          AddColumn(b, x0, x1, y0, y1);
+        }
+
+        static void Reserve(Buffers &b, int vtx_count, int idx_count) {
+          if (b.vtx_count + vtx_count > (int)b.vtx.size())
+            b.vtx.resize(ImMax(b.vtx.size() * 2, (size_t)64));
+          if (b.idx_count + idx_count > (int)b.idx.size())
+            b.idx.resize(ImMax(b.idx.size() * 2, (size_t)96));
+        }
+
+        void WriteVtx(ImDrawVert &v, float x, float y) const {
+          v.pos = ImVec2(x, y); v.uv = uv; v.col = run_col;
+        }
+
+        // Appends the shared-edge vertex at x1 and the two far-edge vertices of one column.
+        void AddColumn(Buffers &b, float x0, float x1, float y0, float y1) {
+          const float shared_y = run_top ? y0 : y1, far_y = run_top ? y1 : y0;
+          const unsigned int s0 = last_shared, s1 = (unsigned int)b.vtx_count;
+          Reserve(b, 3, 6);
+          ImDrawVert *vtx = b.vtx.data() + b.vtx_count;
+          WriteVtx(vtx[0], x1, shared_y);
+          WriteVtx(vtx[1], x0, far_y);
+          WriteVtx(vtx[2], x1, far_y);
+          ImDrawIdx *idx = b.idx.data() + b.idx_count;
+          idx[0] = (ImDrawIdx)s0; idx[1] = (ImDrawIdx)s1; idx[2] = (ImDrawIdx)(s1 + 2);
+          idx[3] = (ImDrawIdx)s0; idx[4] = (ImDrawIdx)(s1 + 2); idx[5] = (ImDrawIdx)(s1 + 1);
+          b.vtx_count += 3;
+          b.idx_count += 6;
+          last_shared = s1;
+          last_x1 = x1; last_y0 = y0; last_y1 = y1;
+          run_count++;
+        }
+
+        void Flush() {
+          Buffers &b = Scratch();
+          if (b.vtx_count > 0) {
+            const int vtx_count = b.vtx_count, idx_count = b.idx_count;
+            draw_list->PrimReserve(idx_count, vtx_count);
+            memcpy(draw_list->_VtxWritePtr, b.vtx.data(), vtx_count * sizeof(ImDrawVert));
+            const ImDrawIdx base = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+            const ImDrawIdx *src = b.idx.data();
+            ImDrawIdx *dst = draw_list->_IdxWritePtr;
+            for (int i = 0; i < idx_count; i++)
+              dst[i] = (ImDrawIdx)(base + src[i]);
+            draw_list->_VtxWritePtr += vtx_count;
+            draw_list->_IdxWritePtr += idx_count;
+            draw_list->_VtxCurrentIdx += vtx_count;
+          }
+          Clear();
+        }
+
+        void Clear() {
+          Buffers &b = Scratch();
+          b.vtx_count = b.idx_count = 0;
+          run_count = 0;
+        }
+      };
+
+    }
+
+#ifdef IMSPINNER_ENABLE_DISC_SPRITES
+    // Opt-in: rasterizes a few anti-aliased disc sizes into the font atlas as custom rects, after which the dot
+    // spinners (everything drawn through detail::AddDiscsBatch) draw each dot as one textured quad, 4 vertices
+    // instead of 2 * segments, in the same draw call since the font texture is already bound. Discs too large
+    // for the biggest sprite, or drawn while another texture is pushed, keep using geometry.
+    // Only compiled with IMSPINNER_ENABLE_DISC_SPRITES defined.
+    // Call it after the fonts are added and before the renderer backend creates the font texture, and again
+    // whenever the atlas is cleared and rebuilt:
+    //   io.Fonts->AddFontFromFileTTF(...);
+    //   ImSpinner::SetupDiscSprites(io.Fonts);
+    inline bool SetupDiscSprites(ImFontAtlas *atlas)
+    {
+      detail::DiscSprites &sprites = detail::GetDiscSprites();
+      sprites.atlas = nullptr;
+
+#if IMGUI_VERSION_NUM < 19197
+      for (int k = 0; k < detail::DiscSprites::count; k++)
+        sprites.rects[k] = atlas->AddCustomRectRegular(sprites.radius[k] * 2 + 2, sprites.radius[k] * 2 + 2);
+      if (!atlas->Build())
+        return false;
+
+      // Build() renders the alpha8 texture; the RGBA32 copy is converted from it, unless it already exists.
+      unsigned char *alpha = atlas->TexPixelsAlpha8;
+      unsigned int *rgba = atlas->TexPixelsRGBA32;
+      for (int k = 0; k < detail::DiscSprites::count; k++) {
+        const ImFontAtlasCustomRect *rect = atlas->GetCustomRectByIndex(sprites.rects[k]);
+        for (int y = 0; y < rect->Height; y++)
+          for (int x = 0; x < rect->Width; x++) {
+            const unsigned char a = detail::DiscSpriteAlpha(x, y, sprites.radius[k]);
+            const int offset = (rect->Y + y) * atlas->TexWidth + rect->X + x;
+            if (alpha) alpha[offset] = a;
+            if (rgba) rgba[offset] = IM_COL32(255, 255, 255, a);
+          }
+      }
+#else
+      for (int k = 0; k < detail::DiscSprites::count; k++) {
+        ImFontAtlasRect rect;
+        sprites.rects[k] = atlas->AddCustomRect(sprites.radius[k] * 2 + 2, sprites.radius[k] * 2 + 2, &rect);
+        if (sprites.rects[k] == ImFontAtlasRectId_Invalid)
+          return false;
+
+        ImTextureData *tex = atlas->TexData;
+        for (int y = 0; y < rect.h; y++) {
+          unsigned char *row = (unsigned char *)tex->GetPixelsAt(rect.x, rect.y + y);
+          for (int x = 0; x < rect.w; x++) {
+            const unsigned char a = detail::DiscSpriteAlpha(x, y, sprites.radius[k]);
+            if (tex->Format == ImTextureFormat_Alpha8) row[x] = a;
+            else ((ImU32 *)row)[x] = IM_COL32(255, 255, 255, a);
+          }
+        }
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, rect.x, rect.y, rect.w, rect.h);
+      }
+#endif
+
+      sprites.atlas = atlas;
+      return true;
+    }
+#endif // IMSPINNER_ENABLE_DISC_SPRITES
+
+    // Returns the animation time in seconds; see SetTimeSource().
+    using TimeSource = double (*)();
+
+    namespace detail {
+      struct Clock {
+        TimeSource source = nullptr;
+        int frame = -1;
+        double time = 0.0;
+        double shift = 0.0;  // pinned time minus the real time
+        bool pinned = false;
+      };
+
+      inline Clock &GetClock() { static Clock clock; return clock; }
+
+      // Animation time of the current frame. A custom source is read once per frame, so every spinner
+      // drawn in a frame sees the same time.
+      inline double Now() {
+        Clock &clock = GetClock();
+        if (clock.pinned)
+          return clock.time;
+        if (!clock.source)
+          return ImGui::GetTime();
+
+        const int frame = ImGui::GetFrameCount();
+        if (clock.frame != frame) {
+          clock.frame = frame;
+          clock.time = clock.source();
+        }
+        return clock.time;
+      }
+
+      // Pins the clock to time for its lifetime: baking phases, instancing with a phase offset.
+      struct ClockScope {
+        Clock saved;
+        explicit ClockScope(double time) : saved(GetClock()) {
+          GetClock().shift += time - Now();
+          GetClock().time = time;
+          GetClock().pinned = true;
+        }
+        ~ClockScope() { GetClock() = saved; }
+      };
+
+      // Animation time scaled by speed, wrapped to `period` in double precision before narrowing, so phases
+      // stay smooth after days of uptime instead of stepping with the float ulp of a large time. The default,
+      // 2pi * 2520, is a whole number of turns for angles and their n/2 .. n/10 multiples; spinners cycling
+      // over any other period (seconds, keyframe fractions) pass that period so the wrap lands on a cycle edge.
+      constexpr double kAngleWrap = 6.283185307179586 * 2520.0;
+      inline float AnimTime(float speed = 1.f, double period = kAngleWrap) {
+        return (float)std::fmod(Now() * speed, period);
+      }
+
+      // Vertices and indices a spinner appended to a draw list, relative to the position it was drawn at,
+      // so the same geometry can be appended again somewhere else without regenerating it.
+      struct DrawSlice {
+        ImVec2 origin;
+        std::vector<ImDrawVert> vtx;
+        std::vector<ImDrawIdx> idx;
+      };
+
+      struct DrawSliceMark { int cmd_count, vtx_start, idx_start; unsigned int vtx_base; };
+
+      inline DrawSliceMark MarkDrawSlice(const ImDrawList *draw_list) {
+        return { draw_list->CmdBuffer.Size, draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->_VtxCurrentIdx };
+      }
+
+      // Copies what was appended since mark. Fails if nothing was drawn or the spinner opened new draw commands
+      // (clip rect / texture changes, index overflow), since a slice is replayed into the current command only.
+      inline bool CaptureDrawSlice(DrawSlice &slice, const ImDrawList *draw_list, const DrawSliceMark &mark, const ImVec2 &origin) {
+        const int vtx_count = draw_list->VtxBuffer.Size - mark.vtx_start, idx_count = draw_list->IdxBuffer.Size - mark.idx_start;
+        if (vtx_count == 0 || draw_list->CmdBuffer.Size != mark.cmd_count)
+          return false;
+
+        slice.origin = origin;
+        slice.vtx.resize(vtx_count);
+        memcpy(slice.vtx.data(), draw_list->VtxBuffer.Data + mark.vtx_start, vtx_count * sizeof(ImDrawVert));
+        slice.idx.resize(idx_count);
+        for (int i = 0; i < idx_count; i++)
+          slice.idx[i] = (ImDrawIdx)(draw_list->IdxBuffer[mark.idx_start + i] - mark.vtx_base);
+        return true;
+      }
+
+      // Appends slice translated to pos: a block copy of the vertices plus a position fix-up, and rebased indices.
+      inline void ReplayDrawSlice(ImDrawList *draw_list, const DrawSlice &slice, const ImVec2 &pos) {
+        const int vtx_count = (int)slice.vtx.size(), idx_count = (int)slice.idx.size();
+        const ImVec2 offset(pos.x - slice.origin.x, pos.y - slice.origin.y);
+        draw_list->PrimReserve(idx_count, vtx_count);
+
+        ImDrawVert *vtx = draw_list->_VtxWritePtr;
+        memcpy(vtx, slice.vtx.data(), vtx_count * sizeof(ImDrawVert));
+        for (int i = 0; i < vtx_count; i++) {
+          vtx[i].pos.x += offset.x;
+          vtx[i].pos.y += offset.y;
+        }
+
+        ImDrawIdx *idx = draw_list->_IdxWritePtr;
+        const ImDrawIdx base = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+        for (int i = 0; i < idx_count; i++)
+          idx[i] = (ImDrawIdx)(slice.idx[i] + base);
+
+        draw_list->_VtxWritePtr += vtx_count;
+        draw_list->_IdxWritePtr += idx_count;
+        draw_list->_VtxCurrentIdx += vtx_count;
+      }
+
+      // State of stateful spinners, one pool per state type, keyed by the spinner's own ID so every instance
+      // animates on its own. Open addressing with linear probing over a power-of-two table: a lookup is a hash
+      // and a short probe, an insert never moves other entries. Entries of spinners that were not drawn for
+      // evict_frames frames are dropped by a periodic sweep that rebuilds the table. The sweep rebuilds into a
+      // spare table kept from the previous rebuild, so once the pool has settled it allocates nothing.
+      template<typename T>
+      struct StatePool {
+        static constexpr int evict_frames = 600;
+        struct Slot { ImGuiID key; int frame; T value; };
+        std::vector<Slot> slots;  // key 0 marks an empty slot
+        std::vector<Slot> spare;
+        int count = 0, swept_frame = 0;
+
+        T &Get(ImGuiID id, const T &init) {
+          if (id == 0)
+            id = 1;
+          const int frame = ImGui::GetFrameCount();
+          if (frame - swept_frame >= evict_frames) {
+            swept_frame = frame;
+            Rebuild(slots.size(), frame - evict_frames);
+          }
+          if (slots.empty())
+            Rebuild(16, frame);
+
+          const size_t mask = slots.size() - 1;
+          for (size_t i = id & mask; ; i = (i + 1) & mask) {
+            Slot &slot = slots[i];
+            if (slot.key == id) {
+              slot.frame = frame;
+              return slot.value;
+            }
+            if (slot.key == 0) {
+              // Keep the load under 3/4 so probes stay short.
+              if ((count + 1) * 4 > (int)slots.size() * 3) {
+                Rebuild(slots.size() * 2, frame - evict_frames);
+                return Get(id, init);
+              }
+              slot = { id, frame, init };
+              count++;
+              return slot.value;
+            }
+          }
+        }
+
+        void Rebuild(size_t capacity, int min_frame) {
+          spare.assign(capacity, Slot{ 0, 0, T() });
+          spare.swap(slots);
+          count = 0;
+          const size_t mask = slots.size() - 1;
+          for (const Slot &s : spare) {
+            if (s.key == 0 || s.frame < min_frame)
+              continue;
+            size_t i = s.key & mask;
+            while (slots[i].key != 0)
+              i = (i + 1) & mask;
+            slots[i] = s;
+            count++;
+          }
+        }
+      };
+
+      // State of type T for spinner id, created from init the first time it is asked for.
+      template<typename T>
+      inline T &GetState(ImGuiID id, const T &init = T()) {
+        static StatePool<T> pool;
+        return pool.Get(id, init);
+      }
+
+      // State advanced on a fixed timestep, with the previous step kept for interpolation.
+      template<typename T>
+      struct Integrated {
+        T prev, cur;
+        double time = -1.0;
+        float acc = 0.f;
+      };
+
+      // Runs step(state.cur) once per 1/60 s of clock time elapsed since the last call - the rate the per-step
+      // constants of the physics spinners were tuned at - so they animate at the same speed at any frame rate
+      // or update rate. Returns how far the clock is into the next step, for ImLerp(prev, cur, alpha).
+      // Catch-up is capped at a quarter second, so a spinner that was scrolled away resumes instead of racing.
+      template<typename T, typename F>
+      inline float Integrate(Integrated<T> &state, const F &step) {
+        constexpr float dt = 1.f / 60.f;
+        const double now = Now();
+        if (state.time < 0.0 || now < state.time) {
+          state.time = now;
+          state.prev = state.cur;
+          return 1.f;
+        }
+
+        state.acc = ImMin(state.acc + (float)(now - state.time), 0.25f);
+        state.time = now;
+        for (; state.acc >= dt; state.acc -= dt) {
+          state.prev = state.cur;
+          step(state.cur);
+        }
+        return state.acc / dt;
+      }
+
+      struct UpdateRateState {
+        float rate = 0.f;        // global updates per second, 0 = every frame
+        float next_rate = -1.f;  // SetNextSpinnerUpdateRate(), consumed by the next spinner
+        struct Entry { double time, next_change; int frame; DrawSlice slice; };
+        std::map<ImGuiID, Entry> entries;
+        int pruned_frame = 0;
+      };
+
+      inline UpdateRateState &GetUpdateRateState() { static UpdateRateState state; return state; }
+
+      struct RedrawState {
+        float interval = 0.f;  // SetSpinnerFrameInterval()
+        int frame = -1;
+        double next = DBL_MAX;
+      };
+
+      inline RedrawState &GetRedrawState() { static RedrawState state; return state; }
+
+      // Folds a spinner's next visible change (clock time) into this frame's deadline. Times asked for while
+      // the clock is pinned are moved back to the real clock.
+      inline void RequestRedraw(double time) {
+        RedrawState &state = GetRedrawState();
+        const int frame = ImGui::GetFrameCount();
+        if (state.frame != frame) {
+          state.frame = frame;
+          state.next = DBL_MAX;
+        }
+        state.next = ImMin(state.next, time - GetClock().shift);
+      }
+
+      // Clock time at which AnimTime(speed, period) * steps reaches its next whole number, for spinners that
+      // only change at discrete steps (CSS steps()). Measured from the same wrapped phase the spinner reads,
+      // so the deadline still lines up with the step edges after the phase wraps.
+      inline double NextStepTime(float speed, double period, float steps = 1.f) {
+        const double rate = ImAbs((double)speed * steps);
+        if (rate <= 0.0)
+          return DBL_MAX;
+        const double phase = ImAbs((double)AnimTime(speed, period)) * steps;
+        return Now() + (std::floor(phase) + 1.0 - phase) / rate;
+      }
+
+      // Declared by SPINNER_HEADER for every spinner.
+      // With an update rate set, Replay() re-appends the geometry of the last update until 1/rate seconds have
+      // passed; otherwise the spinner draws and the destructor captures the new geometry.
+      // A visible spinner also reports when it next changes: now + the frame interval unless the spinner
+      // declares a later step with NextChange(), no earlier than its next update when throttled.
+      struct SpinnerScope {
+        float rate;
+        bool visible = false;
+        double next_change = -1.0, update_time = -1.0;
+        UpdateRateState::Entry *entry = nullptr;
+        DrawSliceMark mark = {};
+        ImVec2 origin;
+
+        SpinnerScope() {
+          UpdateRateState &state = GetUpdateRateState();
+          rate = state.next_rate >= 0.f ? state.next_rate : state.rate;
+          state.next_rate = -1.f;
+        }
+
+        void NextChange(double time) { next_change = time; }
+
+        bool Replay(const ImVec2 &pos) {
+          visible = true;
+          if (rate <= 0.f)
+            return false;
+
+          UpdateRateState &state = GetUpdateRateState();
+          const double time = Now();
+          const int frame = ImGui::GetFrameCount();
+          // Drop geometry of spinners that stopped being drawn.
+          if (frame - state.pruned_frame > 256) {
+            state.pruned_frame = frame;
+            for (auto it = state.entries.begin(); it != state.entries.end(); )
+              it = (frame - it->second.frame > 256) ? state.entries.erase(it) : std::next(it);
+          }
+
+          ImDrawList *draw_list = ImGui::GetWindowDrawList();
+          auto it = state.entries.find(ImGui::GetItemID());
+          if (it != state.entries.end() && !it->second.slice.vtx.empty() && time >= it->second.time && time - it->second.time < 1.0 / rate) {
+            it->second.frame = frame;
+            ReplayDrawSlice(draw_list, it->second.slice, pos);
+            next_change = it->second.next_change;
+            update_time = it->second.time;
+            return true;
+          }
+
+          entry = &state.entries[ImGui::GetItemID()];
+          entry->time = update_time = time;
+          entry->frame = frame;
+          mark = MarkDrawSlice(draw_list);
+          origin = pos;
+          return false;
+        }
+
+        ~SpinnerScope() {
+          if (!visible)
+            return;
+
+          double next = next_change >= 0.0 ? next_change : Now() + GetRedrawState().interval;
+          if (entry) {
+            entry->next_change = next_change;
+            if (!CaptureDrawSlice(entry->slice, ImGui::GetWindowDrawList(), mark, origin))
+              entry->slice.vtx.clear();
+          }
+          if (update_time >= 0.0)
+            next = ImMax(next, update_time + 1.0 / rate);
+          RequestRedraw(next);
+        }
+      };
+    }
+
+    // Limits how often spinners regenerate their geometry; in between they replay the last one.
+    // hz is updates per second, 0 regenerates every frame (default).
+    inline void SetSpinnerUpdateRate(float hz) { detail::GetUpdateRateState().rate = hz; }
+
+    // Same for the next spinner only, overriding the global rate (0 = every frame).
+    inline void SetNextSpinnerUpdateRate(float hz) { detail::GetUpdateRateState().next_rate = hz; }
+
+    // Tessellation quality of arcs and circles: 1 keeps style.CircleTessellationMaxError (default),
+    // 2 halves the allowed error (more segments), 0.5 doubles it (fewer segments).
+    inline void SetSpinnerQuality(float quality) { detail::TessellationQuality() = ImMax(quality, 0.01f); }
+
+    // Replaces ImGui::GetTime() as the spinner clock, e.g. a fixed step for benchmarks or recorded time for replay.
+    // The source is read once per frame; nullptr goes back to ImGui::GetTime().
+    // Spinners read the clock as a phase wrapped to their cycle (detail::AnimTime), so long uptimes stay smooth.
+    // Angle-driven spinners without a shorter cycle wrap every 2pi * 2520 / speed seconds (about 1.6 hours at
+    // speed 2.8); the few whose picture is not periodic in the angle, such as the eased modes of
+    // SpinnerIncScaleDots and SpinnerBarChartSine, show one jump there.
+    inline void SetTimeSource(TimeSource source) { detail::GetClock() = detail::Clock(); detail::GetClock().source = source; }
+
+    // Animation time the spinners draw with in this frame.
+    inline double GetSpinnerTime() { return detail::Now(); }
+
+    // Minimum interval continuous spinners ask to be redrawn at (0 = every frame, default).
+    inline void SetSpinnerFrameInterval(float seconds) { detail::GetRedrawState().interval = seconds; }
+
+    // Earliest spinner clock time at which a spinner drawn this frame changes visibly; call after the spinners
+    // were submitted. A power-saving loop can sleep until then. DBL_MAX if no spinner was visible this frame.
+    inline double GetNextRedrawTime() {
+      const detail::RedrawState &state = detail::GetRedrawState();
+      return state.frame == ImGui::GetFrameCount() ? state.next : DBL_MAX;
     }
 
 #define SPINNER_HEADER(pos, size, centre, num_segments) \
   ImVec2 pos, size, centre; int num_segments; \
-  if (!detail::SpinnerBegin(label, radius, pos, size, centre, num_segments)) { return; }; \
+  detail::SpinnerScope spinner_scope; \
+  if (!detail::SpinnerBegin(label, radius, pos, size, centre, num_segments) || spinner_scope.Replay(pos)) { return; }; \
   ImGuiWindow *window = ImGui::GetCurrentWindow(); \
-  auto circle = [&] (const std::function<ImVec2 (int)>& point_func, ImU32 dbc, float dth) { \
-    window->DrawList->PathClear(); \
-    for (int i = 0; i < num_segments; i++) { \
-      ImVec2 p = point_func(i); \
-      window->DrawList->PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y)); \
-    } \
-    detail::PathStroke(window->DrawList, dbc, dth, 0); \
+  auto circle = [&] (const auto& point_func, ImU32 dbc, float dth, int points = 0) { \
+    detail::EmitCircle(window->DrawList, centre, points > 0 ? points : num_segments, point_func, dbc, dth); \
   }
     
     inline ImColor color_alpha(ImColor c, float alpha) { c.Value.w *= alpha * ImGui::GetStyle().Alpha; return c; }
@@ -203,16 +1514,30 @@ namespace ImSpinner
         return ((result *= a) + b);
     };
 
+    // Height (0..1) of a ball dropped from rest after limtime, sampled at the 0.01 steps of the original simulation.
+    // The steps don't depend on the input, so they are simulated once into a table and every call is a constant-time
+    // lookup of the first step whose time reaches limtime.
     inline float damped_gravity(float limtime) {
-        float time = 0.0f, initialHeight = 10.f, height = initialHeight, velocity = 0.f, prtime = 0.0f;
+        struct step { float time, height; };
+        static const std::vector<step> steps = [] {
+            std::vector<step> s;
+            float time = 0.0f, initialHeight = 10.f, height = initialHeight;
+            while (height >= 0.0) {
+                s.push_back({time, height / 10.f});
+                time += 0.01f;
+                height = initialHeight - 0.5f * 9.81f * time * time;
+            }
+            return s;
+        }();
 
-        while (height >= 0.0) {
-            if (prtime >= limtime) { return height / 10.f; }
-            time += 0.01f; prtime += 0.01f;
-            height = initialHeight - 0.5f * 9.81f * time * time;
-            if (height < 0.0) { initialHeight = 0.0; time = 0.0; }
-        }
-        return 0.f;
+        const int count = (int)steps.size();
+        if (!(limtime <= steps[count - 1].time)) { return 0.f; }  // also catches NaN, like the loop did
+        if (limtime <= 0.f) { return steps[0].height; }
+
+        int k = ImClamp((int)std::ceil(limtime * 100.f), 0, count - 1);
+        while (k > 0 && steps[k - 1].time >= limtime) { --k; }
+        while (steps[k].time < limtime) { ++k; }
+        return steps[k].height;
     }
 
     inline float damped_trifolium(float limtime, float a = 0.f, float b = 1.f) {
@@ -310,19 +1635,19 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float t = (float)ImGui::GetTime();
+        const float t = detail::AnimTime(), st = detail::AnimTime(speed);
         const ImColor c = color_alpha(color, 1.f);
         const float start = ImAbs(ImSin(t) * (num_segments - 5));
         for (int i = 0; i < arcs; ++i)
         {
             const float rb = (radius / arcs) * (i + 1);
-            const float ab = ease((ease_mode)mode, t * speed + i * PI_DIV(2) / arcs, IM_PI, 1.0f, 0.0f);
+            const float ab = ease((ease_mode)mode, st + i * PI_DIV(2) / arcs, IM_PI, 1.0f, 0.0f);
             const float a_min = ImMax(ang_min, PI_2 * ((float)start) / (float)num_segments + (IM_PI / arcs) * i) + ab;
             const float a_max = ImMin(ang_max, PI_2 * ((float)num_segments + 3 * (i + 1)) / (float)num_segments) - ab;
 
             circle([&] (int seg) {
                 const float a = a_min + ((float)seg / (float)num_segments) * (a_max - a_min);
-                const float rspeed = a + t * speed;
+                const float rspeed = a + st;
                 return ImVec2(ImCos(rspeed) * rb, ImSin(rspeed) * rb);
             }, c, thickness);
         }
@@ -338,7 +1663,7 @@ namespace ImSpinner
         {
             const float rb = (radius / arcs) * (i + 1);
 
-            const float start = ImAbs(ImSin((float)ImGui::GetTime()) * (num_segments - 5));
+            const float start = ImAbs(ImSin(detail::AnimTime()) * (num_segments - 5));
             const float a_min = ImMax(ang_min, PI_2 * ((float)start) / (float)num_segments + (IM_PI / arcs) * i);
             const float a_max = ImMin(ang_max, PI_2 * ((float)num_segments + 3 * (i + 1)) / (float)num_segments);
             const float koeff = mode ? (1.1f - 1.f / (i+1)) : 1.f;
@@ -346,7 +1671,7 @@ namespace ImSpinner
 
             circle([&] (int i) {
                 const float a =  a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-                const float rspeed = a + (float)ImGui::GetTime() * speed * koeff;
+                const float rspeed = a + detail::AnimTime(speed * koeff);
                 return ImVec2(ImCos(rspeed) * rb, ImSin(rspeed) * rb);
             }, color_alpha(c, 1.f), thickness);
         }
@@ -359,7 +1684,7 @@ namespace ImSpinner
         SPINNER_HEADER(pos, size, centre, num_segments);
 
         // Calculate the start angle of the spinner based on the current time and speed.
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         // Modify the number of segments to ensure the heart shape is complete.
         num_segments = (num_segments * 3) / 2;
@@ -387,7 +1712,7 @@ namespace ImSpinner
     inline void SpinnerAng(const char *label, float radius, float thickness, const ImColor &color = white, const ImColor &bg = white, float speed = 2.8f, float angle = IM_PI, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);                            // Get the position, size, centre, and number of segments of the spinner using the SPINNER_HEADER macro.
-        float start = (float)ImGui::GetTime() * speed;                        // The start angle of the spinner is calculated based on the current time and the specified speed.
+        float start = detail::AnimTime(speed);                        // The start angle of the spinner is calculated based on the current time and the specified speed.
         float b = 0.f;
         switch (mode) {
         case 1: b = damped_gravity(ImSin(start * 1.1f)) * angle; break;
@@ -401,16 +1726,18 @@ namespace ImSpinner
             return ImVec2(ImCos(a) * radiusmode(a), ImSin(a) * radiusmode(a));
         }, color_alpha(bg, 1.f), thickness);
 
+        const float sweep = angle * (num_segments - 1) / num_segments;                // The arc only needs segments for its own sweep.
+        const int arc_segments = detail::ArcSegments(radius, sweep);
         circle([&] (int i) {                                                        // Draw the spinner itself using the `circle` function, with the specified color and thickness.
-            const float a = start - b + (i * angle / num_segments);
+            const float a = start - b + (i * sweep / arc_segments);
             return ImVec2(ImCos(a) * radiusmode(a), ImSin(a) * radiusmode(a));
-        }, color_alpha(color, 1.f), thickness);
+        }, color_alpha(color, 1.f), thickness, arc_segments + 1);
     }
 
     inline void SpinnerAng8(const char *label, float radius, float thickness, const ImColor &color = white, const ImColor &bg = white, float speed = 2.8f, float angle = IM_PI, int mode = 0, float rkoef = 0.5f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);                            // Get the position, size, centre, and number of segments of the spinner using the SPINNER_HEADER macro.
-        float start = (float)ImGui::GetTime() * speed;                        // The start angle of the spinner is calculated based on the current time and the specified speed.
+        float start = detail::AnimTime(speed);                        // The start angle of the spinner is calculated based on the current time and the specified speed.
         float b = 0.f, kb = 1.f;
         switch (mode) {
         case 1: b = damped_gravity(ImSin(start * 1.1f)) * angle; break;
@@ -442,7 +1769,7 @@ namespace ImSpinner
         for (int i = 0; i < arcs; ++i)
         {
             const float koeff = (1.1f - 1.f / (i+1));
-            float start = (float)ImGui::GetTime() * speed * koeff;                        // The start angle of the spinner is calculated based on the current time and the specified speed.
+            float start = detail::AnimTime(speed * koeff);                        // The start angle of the spinner is calculated based on the current time and the specified speed.
             radius = (mode == 2) ? (0.8f + ImCos(start) * 0.2f) * radius : radius;
             const float rb = (radius / arcs) * (i + 1);
             const float b = (mode == 1) ? damped_gravity(ImSin(start * 1.1f)) * angle : 0.f;
@@ -457,12 +1784,13 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI);                         // Calculate the starting angle based on the current time and speed
+        const float start = detail::AnimTime(speed, IM_PI);                         // Calculate the starting angle based on the current time and speed
         const float bg_angle_offset = PI_2 / num_segments - 1;
 
         num_segments *= 2;                                                                          // Double the number of segments for the background ringxxxxxxx
+        const ImVec2 *unit = detail::UnitCircle(num_segments, bg_angle_offset);
         circle([&] (int i) { 
-            return ImVec2(ImCos(i * bg_angle_offset) * radius, ImSin(i * bg_angle_offset) * radius); // Draw the background ring
+            return ImVec2(unit[i].x * radius, unit[i].y * radius);                                  // Draw the background ring
         }, color_alpha(bg, 1.f), thickness);
 
         float out_h, out_s, out_v;
@@ -485,10 +1813,12 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / (num_segments - 1);
       
-      circle([&] (int i) { return ImVec2(ImCos(i * bg_angle_offset) * radius, ImSin(i * bg_angle_offset) * radius); }, color_alpha(bg, 1.f), thickness);
+      const ImVec2 *unit = detail::UnitCircle(num_segments, bg_angle_offset);
+      
+      circle([&] (int i) { return ImVec2(unit[i].x * radius, unit[i].y * radius); }, color_alpha(bg, 1.f), thickness);
 
       window->DrawList->AddLine(centre, ImVec2(centre.x + ImCos(start) * radius, centre.y + ImSin(start) * radius), color_alpha(color, 1.f), thickness * 2);
       window->DrawList->AddLine(centre, ImVec2(centre.x + ImCos(start * 0.5f) * radius / 2.f, centre.y + ImSin(start * 0.5f) * radius / 2.f), color_alpha(color, 1.f), thickness * 2);
@@ -498,12 +1828,13 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      ImGuiStorage* storage = window->DC.StateStorage;
-      const ImGuiID radiusbId = window->GetID("##radiusb");
-      float radius_b = storage->GetFloat(radiusbId, 0.8f);
+      struct state_t { float radius_b = 0.8f; };
+      state_t &state = detail::GetState<state_t>(ImGui::GetItemID());
+      float radius_b = state.radius_b;
 
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / (num_segments - 1);
+      const ImVec2 *unit = detail::UnitCircle(num_segments, bg_angle_offset);
 
       float start_r = ImFmod(start, PI_DIV_2);
       switch (mode) {
@@ -513,16 +1844,16 @@ namespace ImSpinner
       float radius1 = radius_k * radius;
 
       circle([&] (int i) {
-          return ImVec2(ImCos(i * bg_angle_offset) * radius1, ImSin(i * bg_angle_offset) * radius1);
+          return ImVec2(unit[i].x * radius1, unit[i].y * radius1);
       }, color_alpha(bg, 1.f), thickness);
 
       if (sequence) { radius_b -= (0.005f * speed); radius_b = ImMax(radius_k, ImMax(0.8f, radius_b)); } 
       else { radius_b = (1.f - radius_k); }
-      storage->SetFloat(radiusbId, radius_b);
+      state.radius_b = radius_b;
       
       float radius_tb = sequence ? ImMax(radius_k, radius_b) * radius : (radius_b * radius);
       circle([&] (int i) {
-          return ImVec2(ImCos(i * bg_angle_offset) * radius_tb, ImSin(i * bg_angle_offset) * radius_tb);
+          return ImVec2(unit[i].x * radius_tb, unit[i].y * radius_tb);
       }, color_alpha(bg, 1.f), thickness);
     }
 
@@ -530,19 +1861,14 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      ImGuiStorage* storage = window->DC.StateStorage;
-      const ImGuiID radiusbId = window->GetID("##radiusb");
-      float radius_b = storage->GetFloat(radiusbId, 0.8f);
-
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2_DIV(num_segments);
 
       float start_r = ImFmod(start, PI_DIV_2);
       float radius_k = ImSin(start_r);
       window->DrawList->AddCircleFilled(centre, radius_k * radius, color_alpha(bg, ImMin(0.1f, radius_k)), num_segments);
 
-      radius_b = (1.f - radius_k);
-      storage->SetFloat(radiusbId, radius_b);
+      const float radius_b = (1.f - radius_k);
 
       window->DrawList->AddCircleFilled(centre, radius_b * radius, color_alpha(bg, ImMin(0.3f, radius_b)), num_segments);
     }
@@ -552,8 +1878,10 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       const float bg_angle_offset = PI_2 / (num_segments - 1);
+      const ImVec2 *unit = detail::UnitCircle(num_segments, bg_angle_offset);
       const float koeff = PI_DIV(2 * rings);
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
+      const float start_c = ImCos(start), start_s = ImSin(start);
 
       for (int num_ring = 0; num_ring < rings; ++num_ring) {
         float radius_k = ImSin(ImFmod(start + (num_ring * koeff), PI_DIV_2));
@@ -561,8 +1889,7 @@ namespace ImSpinner
         radius1 += ease((ease_mode)mode, start, radius);
 
         circle([&] (int i) {
-            const float a = start + (i * bg_angle_offset);
-            return ImVec2(ImCos(a) * radius1, ImSin(a) * radius1);
+            return detail::RotateUnit(unit[i], start_c, start_s, radius1);
         }, color_alpha(color, radius_k > 0.5f ? 2.f - (radius_k * 2.f) : color.Value.w), thickness);
       }
     }
@@ -573,7 +1900,7 @@ namespace ImSpinner
 
       const float bg_angle_offset = PI_2_DIV(num_segments);
       const float koeff = PI_DIV(2 * rings);
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
 
       for (int num_ring = 0; num_ring < rings; ++num_ring) {
         float radius_k = ImSin(ImFmod(start + (num_ring * koeff), PI_DIV_2));
@@ -588,7 +1915,7 @@ namespace ImSpinner
 
         const float bg_angle_offset = PI_2_DIV(num_segments);
         const float koeff = PI_DIV(2 * rings);
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
 
         for (int num_ring = 0; num_ring < rings; ++num_ring) {
             float start_r = ImFmod(start, PI_DIV_2);
@@ -611,7 +1938,7 @@ namespace ImSpinner
         SPINNER_HEADER(pos, size, centre, num_segments);
 
         auto ghalf_pi = [] (float f) -> float { return ImMin(f, PI_DIV_2); };
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI);
+        const float start = detail::AnimTime(speed, IM_PI);
         const float bg_angle_offset = PI_2_DIV(lines);
         for (size_t j = 0; j < 3; ++j)
         {
@@ -634,8 +1961,9 @@ namespace ImSpinner
     inline void SpinnerDots(const char *label, float *nextdot, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 12, float minth = -1.f, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
         const float bg_angle_offset = PI_2 / dots;
         dots = ImMin(dots, (size_t)32);
         const size_t mdots = dots / 2;
@@ -661,6 +1989,8 @@ namespace ImSpinner
         case 4: start = ease_outquad(ImSin(ImFmod(start, IM_PI))); break;
         case 5: start = ease_inoutexpo(ImSin(ImFmod(start, IM_PI))); break;
         }
+        static detail::ArcTable arc;
+        arc.Fill((int)dots + 1, start, bg_angle_offset);
         for (size_t i = 0; i <= dots; i++)
         {
             float a = start + (i * bg_angle_offset);
@@ -674,7 +2004,8 @@ namespace ImSpinner
                 if ((i > ref_nextdot && i < dots) || (i < ((int)(ref_nextdot + mdots)) % dots))
                     th = thcorrect(i);
             }
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(-a) * radiusmode(a, i), centre.y + ImSin(-a) * radiusmode(a, i)), th, color_alpha(color, 1.f), 8);
+            const float r = radiusmode(a, (int)i);
+            discs.Add(ImVec2(centre.x + arc.c[i] * r, centre.y - arc.s[i] * r), th, color_alpha(color, 1.f), 8);
         }
     }
 
@@ -682,7 +2013,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
         switch (mode) {
         case 1: start += ease_inoutquad(ImSin(ImFmod(start, IM_PI))); break;
         }
@@ -690,19 +2021,20 @@ namespace ImSpinner
         const float bg_angle_offset = PI_2_DIV(dots);
         dots = ImMin(dots, (size_t)32);
 
+        static detail::ArcTable arc;
+        arc.Fill((int)dots + 1, start, bg_angle_offset);
         for (size_t i = 0; i <= dots; i++)
         {
-            float a = ImFmod(start + (i * bg_angle_offset), PI_2);
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(-a) * radius, centre.y + ImSin(-a) * radius), thickness / 2, color_alpha(bgcolor, 1.f), 8);
+            window->DrawList->AddCircleFilled(ImVec2(centre.x + arc.c[i] * radius, centre.y - arc.s[i] * radius), thickness / 2, color_alpha(bgcolor, 1.f), 8);
         }
 
         window->DrawList->PathClear();
         const float d_ang = (mdots / (float)dots) * PI_2;
         const float angle_offset = (d_ang) / dots;
+        arc.Fill((int)dots, start, angle_offset);
         for (size_t i = 0; i < dots; i++)
         {
-            const float a = start + (i * angle_offset);
-            window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
+            window->DrawList->PathLineTo(ImVec2(centre.x + arc.c[i] * radius, centre.y + arc.s[i] * radius));
         }
         detail::PathStroke(window->DrawList, color_alpha(color, 1.f), thickness, false);
     }
@@ -720,7 +2052,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const float nextItemKoeff = 2.5f;
         const float offset = size.x / 4.f;
 
@@ -763,7 +2095,7 @@ namespace ImSpinner
     inline void SpinnerThickToSin(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int nt = 1, int lt = 8, int mode = 0) {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        float start = detail::AnimTime(speed, PI_2);
         float length = ImFmod(start, IM_PI);
         const float dangle = ImSin(length) * IM_PI * 0.5f;
         const float angle_offset = IM_PI / (lt * 2);
@@ -800,7 +2132,7 @@ namespace ImSpinner
         const float nextItemKoeff = 2.5f;
         const float heightSpeed = 0.8f;
         const float dots = (size.x / (thickness * nextItemKoeff));
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         for (size_t i = 0; i < dots; i++)
         {
@@ -824,8 +2156,8 @@ namespace ImSpinner
       const float radius = ImMax(radius1, radius2);
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
-      const float aoffset = ImFmod((float)ImGui::GetTime(), 1.5f * IM_PI);
+      const float start = detail::AnimTime(speed, PI_2);
+      const float aoffset = detail::AnimTime(1.f, 1.5f * IM_PI);
       const float bofsset = (aoffset > angle) ? angle : aoffset;
       const float angle_offset = angle * 2.f / num_segments;
 
@@ -856,7 +2188,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+      const float start = detail::AnimTime(speed, PI_2);
       const float angle_offset = PI_2_DIV(num_segments - 1);
 
       circle([&] (int i) {
@@ -879,9 +2211,8 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const float angle_offset = PI_2_DIV(num_segments - 1);
-        num_segments *= 4;
 
         circle([&] (int i) {
             const float a = (i * angle_offset);
@@ -907,7 +2238,7 @@ namespace ImSpinner
       const float radius = ImMax(radius1, radius2);
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI);
+      const float start = detail::AnimTime(speed, IM_PI);
       window->DrawList->AddCircleFilled(centre, radius1, color_alpha(bg, 1.f), num_segments);
 
       const float abegin = (PI_DIV_2) - start;
@@ -933,8 +2264,8 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       num_segments *= 8;
-      const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
-      const float aoffset = ImFmod((float)ImGui::GetTime(), PI_2);
+      const float start = detail::AnimTime(speed, PI_2);
+      const float aoffset = detail::AnimTime(1.f, PI_2);
       const float bofsset = (aoffset > IM_PI) ? IM_PI : aoffset;
       const float angle_offset = PI_2_DIV(num_segments);
       float ared_min = 0, ared = 0;
@@ -981,9 +2312,9 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       num_segments *= 4;
-      float start1 = ImFmod((float)ImGui::GetTime() * speed1, PI_2);
-      float start2 = ImFmod((float)ImGui::GetTime() * speed2, PI_2);
-      const float aoffset = ImFmod((float)ImGui::GetTime(), 2.f * IM_PI);
+      float start1 = detail::AnimTime(speed1, PI_2);
+      float start2 = detail::AnimTime(speed2, PI_2);
+      const float aoffset = detail::AnimTime(1.f, 2.f * IM_PI);
       const float bofsset = (aoffset > IM_PI) ? IM_PI : aoffset;
       const float angle_offset = PI_2 / num_segments;
       float ared_min = 0, ared = 0;
@@ -1012,67 +2343,88 @@ namespace ImSpinner
 
 
 
-    inline void SpinnerFadeTris(const char *label, float radius, const ImColor &color = white, float speed = 2.8f, size_t dim = 2, bool scale = false, int mode = 0)
-    {
-        SPINNER_HEADER(pos, size, centre, num_segments);
+    namespace detail {
+      // Subdivided triangle of SpinnerFadeTris in centre-relative coordinates, with the polar angle of each
+      // sub-triangle's centre. It depends only on (radius, dim), so it is built once instead of every frame.
+      struct FadeTrisMesh {
+        float radius = 0.f;
+        size_t dim = 0;
+        std::vector<ImVec2> points;   // 3 per triangle
+        std::vector<float> angles;    // 1 per triangle
+      };
 
-        ImGuiContext &g = *GImGui;
-        const ImGuiStyle &style = g.Style;
-        const float nextItemKoeff = 1.5f;
-        const float yOffsetKoeftt = 0.8f;
-        const float heightSpeed = 0.8f;
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+      inline const FadeTrisMesh &GetFadeTrisMesh(float radius, size_t dim) {
+        static BoundedCache<FadeTrisMesh, 64> cache;  // radii animated or scaled every frame keep changing
+        static std::vector<ImVec2> newPoints;         // one subdivision level, kept across rebuilds
+        bool found;
+        FadeTrisMesh &mesh = cache.Get(ImHashData(&dim, sizeof(dim), ImHashData(&radius, sizeof(radius))), found);
+        if (found && mesh.radius == radius && mesh.dim == dim)
+          return mesh;
+
+        mesh.radius = radius;  // a new entry, or a hash collision rebuilt in place
+        mesh.dim = dim;
+        mesh.points.clear();
+        mesh.angles.clear();
 
-        std::vector<ImVec2> points;
         auto pushPoints = [] (std::vector<ImVec2> &pp, const ImVec2 &p1, const ImVec2 &p2, const ImVec2 &p3) { pp.push_back(p1); pp.push_back(p2); pp.push_back(p3); };
         auto hsumPoints = [] (const ImVec2 &p1, const ImVec2 &p2) { return ImVec2((p1.x + p2.x) / 2.f, (p1.y + p2.y) / 2.f); };
 
-        auto splitTriangle = [&] (const ImVec2 &p1, const ImVec2 &p2, const ImVec2 &p3, int numDivisions) {
-            pushPoints(points, p1, p2, p3);
-
-            for (int i = 0; i < numDivisions; i++) {
-                std::vector<ImVec2> newPoints;
-                for (int j = 0; j < points.size() - 2; j += 3) {
-                    ImVec2 p1 = points[j];
-                    ImVec2 p2 = points[j + 1];
-                    ImVec2 p3 = points[j + 2];
-
-                    ImVec2 p4((p1.x + p2.x) / 2, (p1.y + p2.y) / 2);
-                    ImVec2 p5((p2.x + p3.x) / 2, (p2.y + p3.y) / 2);
-                    ImVec2 p6((p3.x + p1.x) / 2, (p3.y + p1.y) / 2);
-
-                    pushPoints(newPoints, p1, p4, p6);
-                    pushPoints(newPoints, p4, p5, p6);
-                    pushPoints(newPoints, p4, p2, p5);
-                    pushPoints(newPoints, p6, p5, p3);
-                }
-                points = newPoints;
-            }
-
-            return points;
-        };
-
-        auto calculateAngle = [] (ImVec2 v1, ImVec2 v2, const ImVec2 c) {
-            v1.x -= c.x; v1.y -= c.y; v2.x -= c.x; v2.y -= c.y;
+        auto calculateAngle = [] (ImVec2 v1, ImVec2 v2) {
             float dotProduct = v1.x * v2.x + v1.y * v2.y;
             float magnitudeV1 = ImSqrt(v1.x * v1.x + v1.y * v1.y);
             float magnitudeV2 = ImSqrt(v2.x * v2.x + v2.y * v2.y);
             float angleInRadians = ImAcos(dotProduct / (magnitudeV1 * magnitudeV2));
             float crossProduct = v1.x * v2.y - v2.x * v1.y;
             float signedAngle = std::copysign(angleInRadians, crossProduct);
-            return fmod(signedAngle + PI_2, PI_2);
+            return (float)fmod(signedAngle + PI_2, PI_2);
         };
 
-        const float offset = IM_PI / dim;
-        ImVec2 p1 = ImVec2(centre.x + ImSin(0) * radius, centre.y + ImCos(0) * radius);
-        ImVec2 p2 = ImVec2(centre.x + ImSin(PI_DIV(3) * 2) * radius, centre.y + ImCos(PI_DIV(3) * 2) * radius);
-        ImVec2 p3 = ImVec2(centre.x + ImSin(PI_DIV(3) * 4) * radius, centre.y + ImCos(PI_DIV(3) * 4) * radius);
-        std::vector<ImVec2> subdividedPoints = splitTriangle(p1, p2, p3, dim);
-        for (size_t i = 0; i < subdividedPoints.size(); i+=3) {
-            ImVec2 trisCenter = hsumPoints(hsumPoints(subdividedPoints[i], subdividedPoints[i + 1]), subdividedPoints[i + 2]);
-            const float angle = calculateAngle(p1, trisCenter, centre);
-            ImColor c = color_alpha(color, 1.f - ImMax(0.1f, ImFmod(start + angle, PI_2) / PI_2));
-            window->DrawList->AddTriangleFilled(subdividedPoints[i], subdividedPoints[i+1], subdividedPoints[i+2], c);
+        const ImVec2 p1 = ImVec2(ImSin(0) * radius, ImCos(0) * radius);
+        const ImVec2 p2 = ImVec2(ImSin(PI_DIV(3) * 2) * radius, ImCos(PI_DIV(3) * 2) * radius);
+        const ImVec2 p3 = ImVec2(ImSin(PI_DIV(3) * 4) * radius, ImCos(PI_DIV(3) * 4) * radius);
+
+        std::vector<ImVec2> &points = mesh.points;
+        pushPoints(points, p1, p2, p3);
+        for (size_t i = 0; i < dim; i++) {
+            newPoints.clear();
+            newPoints.reserve(points.size() * 4);
+            for (size_t j = 0; j + 2 < points.size(); j += 3) {
+                const ImVec2 t1 = points[j];
+                const ImVec2 t2 = points[j + 1];
+                const ImVec2 t3 = points[j + 2];
+
+                const ImVec2 t4((t1.x + t2.x) / 2, (t1.y + t2.y) / 2);
+                const ImVec2 t5((t2.x + t3.x) / 2, (t2.y + t3.y) / 2);
+                const ImVec2 t6((t3.x + t1.x) / 2, (t3.y + t1.y) / 2);
+
+                pushPoints(newPoints, t1, t4, t6);
+                pushPoints(newPoints, t4, t5, t6);
+                pushPoints(newPoints, t4, t2, t5);
+                pushPoints(newPoints, t6, t5, t3);
+            }
+            points.assign(newPoints.begin(), newPoints.end());
+        }
+
+        mesh.angles.reserve(points.size() / 3);
+        for (size_t i = 0; i + 2 < points.size(); i += 3) {
+            const ImVec2 trisCenter = hsumPoints(hsumPoints(points[i], points[i + 1]), points[i + 2]);
+            mesh.angles.push_back(calculateAngle(p1, trisCenter));
+        }
+        return mesh;
+      }
+    }
+
+    inline void SpinnerFadeTris(const char *label, float radius, const ImColor &color = white, float speed = 2.8f, size_t dim = 2, bool scale = false, int mode = 0)
+    {
+        SPINNER_HEADER(pos, size, centre, num_segments);
+
+        const float start = detail::AnimTime(speed, PI_2);
+
+        const detail::FadeTrisMesh &mesh = detail::GetFadeTrisMesh(radius, dim);
+        auto at = [&] (size_t i) { return ImVec2(centre.x + mesh.points[i].x, centre.y + mesh.points[i].y); };
+        for (size_t i = 0; i < mesh.angles.size(); i++) {
+            ImColor c = color_alpha(color, 1.f - ImMax(0.1f, ImFmod(start + mesh.angles[i], PI_2) / PI_2));
+            window->DrawList->AddTriangleFilled(at(i * 3), at(i * 3 + 1), at(i * 3 + 2), c);
         }
     }
 
@@ -1083,13 +2435,15 @@ namespace ImSpinner
       float radius = ImMax(radius1, radius2);
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = (float)ImGui::GetTime()* speed;
+      float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / num_segments;
+      const ImVec2 *unit = detail::UnitCircle(num_segments + 1, bg_angle_offset);
+      const float start_c = ImCos(start), start_s = ImSin(start);
 
       window->DrawList->PathClear();
-      for (size_t i = 0; i <= num_segments; i++) {
-        const float a = start + (i * bg_angle_offset);
-        window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius1, centre.y + ImSin(a) * radius1));
+      for (int i = 0; i <= num_segments; i++) {
+        const ImVec2 p = detail::RotateUnit(unit[i], start_c, start_s, radius1);
+        window->DrawList->PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y));
       }
       detail::PathStroke(window->DrawList, color_alpha(bg, 1.f), thickness, false);
 
@@ -1116,15 +2470,16 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float arc_angle = PI_2 / (float)arcs;
-      const float angle_offset = arc_angle / num_segments;
+      const int arc_segments = detail::ArcSegments(radius, arc_angle);
+      const float angle_offset = arc_angle / arc_segments;
       
       for (size_t arc_num = 0; arc_num < arcs; ++arc_num) {
         window->DrawList->PathClear();
         ImColor c = color_alpha(color, ImMax(0.1f, arc_num / (float)arcs));
         float b = ease((ease_mode)mode, start + arc_num * PI_DIV(2) / arcs, IM_PI, 1.0f, 0.0f);
-        for (size_t i = 0; i <= num_segments; i++) {
+        for (int i = 0; i <= arc_segments; i++) {
           const float a = start + b + arc_angle * arc_num + (i * angle_offset);
           window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
         }
@@ -1136,14 +2491,17 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime()* speed, IM_PI * 4.f);
+      const float start = detail::AnimTime(speed, IM_PI * 4.f);
       const float arc_angle = PI_2 / (float)arcs;
-      const float angle_offset = arc_angle / num_segments;
+      // Tessellate the swept angle (the arc plus one step of overlap), not the full circle.
+      const float sweep = arc_angle * (num_segments + 1) / num_segments;
+      const int arc_segments = detail::ArcSegments(radius, sweep);
+      const float angle_offset = sweep / arc_segments;
       
       for (size_t arc_num = 0; arc_num < arcs; ++arc_num)
       {
         window->DrawList->PathClear();
-        for (size_t i = 0; i <= num_segments + 1; i++)
+        for (int i = 0; i <= arc_segments; i++)
         {
           const float a = arc_angle * arc_num + (i * angle_offset) - PI_DIV_2 - PI_DIV_4;
           window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
@@ -1172,13 +2530,16 @@ namespace ImSpinner
     inline void SpinnerSimpleArcFade(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f)     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI * 4.f);
+        const float start = detail::AnimTime(speed, IM_PI * 4.f);
         const float arc_angle = PI_2 / (float)4;
-        const float angle_offset = arc_angle / num_segments;
+        // Tessellate the swept angle (the arc plus one step of overlap), not the full circle.
+        const float sweep = arc_angle * (num_segments + 1) / num_segments;
+        const int arc_segments = detail::ArcSegments(radius * 1.3f, sweep);
+        const float angle_offset = sweep / arc_segments;
 
         auto draw_segment = [&] (int arc_num, float delta, auto c, float k, float t) {
             window->DrawList->PathClear();
-            for (size_t i = 0; i <= num_segments + 1; i++) {
+            for (int i = 0; i <= arc_segments; i++) {
                 const float a = t * start + arc_angle * arc_num + (i * angle_offset) - PI_DIV_2 - PI_DIV_4 + delta;
                 window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius * k, centre.y + ImSin(a) * radius * k));
             }
@@ -1210,7 +2571,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI * 4.f);
+        const float start = detail::AnimTime(speed, IM_PI * 4.f);
         const float arc_angle = PI_DIV_2;
         const float ht = thickness / 2.f;
 
@@ -1253,15 +2614,64 @@ namespace ImSpinner
 #endif
 
 
+    namespace detail {
+      // Non-transparent texels of one glyph, extracted from the font atlas once and reused until the glyph or
+      // the atlas pixels change (the uv rect and the pixel buffer identify the atlas version).
+      struct GlyphPoints {
+        struct texel { short x, y; unsigned char alpha; };
+        const unsigned char *bitmap = nullptr;
+        int atlas_width = 0, atlas_height = 0;
+        float U0 = 0.f, V0 = 0.f, U1 = 0.f, V1 = 0.f;
+        int width = 0, height = 0;
+        std::vector<texel> texels;
+      };
+
+      inline const GlyphPoints &GetGlyphPoints(const ImFontGlyph *glyph, const unsigned char *bitmap, int atlas_width, int atlas_height) {
+        static std::map<const ImFontGlyph *, GlyphPoints> cache;
+        GlyphPoints &gp = cache[glyph];
+        if (gp.bitmap == bitmap && gp.atlas_width == atlas_width && gp.atlas_height == atlas_height
+            && gp.U0 == glyph->U0 && gp.V0 == glyph->V0 && gp.U1 == glyph->U1 && gp.V1 == glyph->V1)
+          return gp;
+
+        gp.bitmap = bitmap; gp.atlas_width = atlas_width; gp.atlas_height = atlas_height;
+        gp.U0 = glyph->U0; gp.V0 = glyph->V0; gp.U1 = glyph->U1; gp.V1 = glyph->V1;
+
+        const int U1 = (int)(glyph->U1 * atlas_width);
+        const int U0 = (int)(glyph->U0 * atlas_width);
+        const int V1 = (int)(glyph->V1 * atlas_height);
+        const int V0 = (int)(glyph->V0 * atlas_height);
+        gp.width = U1 - U0;
+        gp.height = V1 - V0;
+        gp.texels.clear();
+        for (int x = U0, ppx = 0; x < U1; x++, ppx++) {
+          for (int y = V0, ppy = 0; y < V1; y++, ppy++) {
+            // * 4 + 3 because dear imgui now defaults to RGBA32
+            const unsigned char alpha = bitmap[(atlas_width * y + x)
+#if IMGUI_VERSION_NUM > 19197
+                                                                     * 4 + 3];
+#else
+                                                                            ];
+#endif
+            if (alpha)
+              gp.texels.push_back({(short)ppx, (short)ppy, alpha});
+          }
+        }
+        return gp;
+      }
+    }
+
     inline void SpinnerAsciiSymbolPoints(const char *label, const char* text, float radius, float thickness, const ImColor &color = white, float speed = 2.8f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         if (!text || !*text)
             return;
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, (float)strlen(text));
+        const float start = detail::AnimTime(speed, (float)strlen(text));
         const ImFontGlyph* glyph = ImGui::GetCurrentContext()->IMSPINNER_FIND_GLYPH(text[(int)start]);
+        if (!glyph)
+            return;
 
         ImVec2 pp(centre.x - radius, centre.y - radius);
         ImFontAtlas* atlas = ImGui::GetIO().Fonts;
@@ -1277,26 +2687,18 @@ namespace ImSpinner
         bitmap = atlas_tex_data->Pixels;
 #endif
 
-        const int U1 = (int)(glyph->U1 * out_width);
-        const int U0 = (int)(glyph->U0 * out_width);
-        const int V1 = (int)(glyph->V1 * out_height);
-        const int V0 = (int)(glyph->V0 * out_height);
-        const float px = size.x / (U1 - U0);
-        const float py = size.y / (V1 - V0);
-        
-        for (int x = U0, ppx = 0; x < U1; x++, ppx++) {
-            for (int y = V0, ppy = 0; y < V1; y++, ppy++) {
-                ImVec2 point(pp.x + (ppx * px), pp.y + (ppy * py));
-                // * 4 + 3 because dear imgui now defaults to RGBA32
-                const unsigned char alpha = bitmap[(out_width * y + x)
-#if IMGUI_VERSION_NUM > 19197
-                                                                        * 4 + 3];
-#else
-                                                                               ];
-#endif
-                window->DrawList->AddCircleFilled(point, thickness * 1.5f, color_alpha({.5f,.5f,.5f,.5f}, alpha / 255.f));
-                window->DrawList->AddCircleFilled(point, thickness, color_alpha(color, alpha / 255.f));
-            }
+        const detail::GlyphPoints &gp = detail::GetGlyphPoints(glyph, bitmap, out_width, out_height);
+        const float px = size.x / gp.width;
+        const float py = size.y / gp.height;
+
+        // Fully transparent texels used to be drawn too; they are skipped when the glyph is sampled.
+        // Dot and shadow share one segment count so the whole glyph goes out as one batch.
+        const ImColor shadow(.5f, .5f, .5f, .5f);
+        const int segs = window->DrawList->_CalcCircleAutoSegmentCount(thickness * 1.5f);
+        for (const detail::GlyphPoints::texel &t : gp.texels) {
+            const ImVec2 point(pp.x + (t.x * px), pp.y + (t.y * py));
+            discs.Add(point, thickness * 1.5f, color_alpha(shadow, t.alpha / 255.f), segs);
+            discs.Add(point, thickness, color_alpha(color, t.alpha / 255.f), segs);
         }
     }
 
@@ -1307,7 +2709,7 @@ namespace ImSpinner
         if (!text || !*text)
             return;
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, (float)strlen(text));
+        const float start = detail::AnimTime(speed, (float)strlen(text));
 
         struct Segment { ImVec2 b, e; };
         const float q = 1.f, hq = q * 0.5f, xq = thickness / radius;
@@ -1386,7 +2788,7 @@ namespace ImSpinner
         SPINNER_HEADER(pos, size, centre, num_segments);
 
         const float overt = 3.f;
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2 + overt);
+        const float start = detail::AnimTime(speed, PI_2 + overt);
         const float arc_angle = 2.f * PI_DIV_4;
         const float ht = thickness / 2.f;
 
@@ -1431,7 +2833,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2 );
+        const float start = detail::AnimTime(speed, PI_2);
         const float arc_angle = 2.f * PI_DIV_4;
         const float ht = thickness / 2.f;
 
@@ -1471,7 +2873,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2 + PI_DIV_2 );
+        const float start = detail::AnimTime(speed, PI_2 + PI_DIV_2);
         const float arc_angle = PI_DIV_2;
         const float ht = thickness / 2.f;
 
@@ -1501,9 +2903,12 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime()* speed, IM_PI * 4.f);
+      const float start = detail::AnimTime(speed, IM_PI * 4.f);
       const float arc_angle = PI_2 / (float)arcs;
-      const float angle_offset = arc_angle / num_segments;
+      // Tessellate the swept angle (the arc plus one step of overlap), not the full circle.
+      const float sweep = arc_angle * (num_segments + 1) / num_segments;
+      const int arc_segments = detail::ArcSegments(radius, sweep);
+      const float angle_offset = sweep / arc_segments;
       for (size_t arc_num = 0; arc_num < arcs; ++arc_num)
       {
         const float b = arc_angle * arc_num - PI_DIV_2 - PI_DIV_4;
@@ -1531,7 +2936,7 @@ namespace ImSpinner
 
         window->DrawList->PathClear();
         window->DrawList->PathLineTo(centre);
-        for (size_t i = 0; i <= num_segments + 1; i++)
+        for (int i = 0; i <= arc_segments; i++)
         {
           const float ar = arc_angle * arc_num + (i * angle_offset) - PI_DIV_2 - PI_DIV_4;
           window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(ar) * vradius, centre.y + ImSin(ar) * vradius));
@@ -1542,8 +2947,9 @@ namespace ImSpinner
 
     inline void SpinnerPointsRoller(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t points = 8, int circles = 2, float rspeed = 1.f) {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI / (points / 2));
+        const float start = detail::AnimTime(speed, IM_PI / (points / 2));
         const float arc_angle = PI_2 / (float)points;
         const float angle_offset = arc_angle / num_segments;
 
@@ -1569,7 +2975,7 @@ namespace ImSpinner
                 ));
 
                 const float ar = start + adv_angle + arc_angle * arc_num - PI_DIV_2 - PI_DIV_4;
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(ar) * vradius, centre.y + ImSin(ar) * vradius), thickness, color_alpha(dotColor, 1.f), 8);
+                discs.Add(ImVec2(centre.x + ImCos(ar) * vradius, centre.y + ImSin(ar) * vradius), thickness, color_alpha(dotColor, 1.f), 8);
             }
             dspeed += rspeed;
         }
@@ -1578,8 +2984,9 @@ namespace ImSpinner
     inline void SpinnerPointsArcBounce(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t points = 4, int circles = 2, float rspeed = 0.f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = ImFmod((float)ImGui::GetTime()* speed, IM_PI * 4.f);
+        const float start = detail::AnimTime(speed, IM_PI * 4.f);
         const float arc_angle = PI_2 / (float)points;
         const float angle_offset = arc_angle / num_segments;
         float dspeed = rspeed;
@@ -1611,7 +3018,7 @@ namespace ImSpinner
                 }
 
                 const float ar = start * dspeed + adv_angle + arc_angle * arc_num - PI_DIV_2 - PI_DIV_4;
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(ar) * vradius, centre.y + ImSin(ar) * vradius), thickness, color_alpha(c, 1.f), 8);
+                discs.Add(ImVec2(centre.x + ImCos(ar) * vradius, centre.y + ImSin(ar) * vradius), thickness, color_alpha(c, 1.f), 8);
             }
             dspeed += rspeed;
         }
@@ -1621,7 +3028,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime()* speed, PI_2);
+      const float start = detail::AnimTime(speed, PI_2);
       const float arc_angle = PI_2 / (float)arcs;
       const float angle_offset = arc_angle / num_segments;
 
@@ -1656,7 +3063,7 @@ namespace ImSpinner
         const float pi_div_2 = PI_DIV_2;
         const float pi_div_4 = PI_DIV_4;
         const float pi_mul_2 = PI_2;
-        const float start = ImFmod((float)ImGui::GetTime() * speed, pi_mul_2 + pi_div_4);
+        const float start = detail::AnimTime(speed, pi_mul_2 + pi_div_4);
         const float arc_angle = pi_mul_2 / (float)arcs;
         const float angle_offset = arc_angle / num_segments;
 
@@ -1693,9 +3100,10 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float arc_angle = PI_2 / (float)arcs;
-        const float angle_offset = arc_angle / num_segments;
+        const int arc_segments = detail::ArcSegments(radius, arc_angle);
+        const float angle_offset = arc_angle / arc_segments;
         float out_h, out_s, out_v;
         ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
 
@@ -1708,7 +3116,7 @@ namespace ImSpinner
             window->DrawList->PathClear();
             window->DrawList->PathLineTo(centre);
             const float ab = ease((ease_mode)mode, start + arc_num * PI_DIV(2) / arcs, IM_PI, 1.0f, 0.0f);
-            for (size_t i = 0; i < num_segments + 1; i++)
+            for (int i = 0; i <= arc_segments; i++)
             {
                 const float start_a = ImFmod(start * (1.05f * (arc_num + 1)), PI_2);
                 const float ar = start_a + ab + arc_angle * arc_num + (i * angle_offset) - PI_DIV_2;
@@ -1723,14 +3131,16 @@ namespace ImSpinner
       float radius = ImMax(radius1, radius2);
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / num_segments;
+      const ImVec2 *unit = detail::UnitCircle(num_segments + 1, bg_angle_offset);
+      const float start_c = ImCos(start), start_s = ImSin(start);
 
       window->DrawList->PathClear();
-      for (size_t i = 0; i <= num_segments; i++)
+      for (int i = 0; i <= num_segments; i++)
       {
-        const float a = start + (i * bg_angle_offset);
-        window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius1, centre.y + ImSin(a) * radius1));
+        const ImVec2 p = detail::RotateUnit(unit[i], start_c, start_s, radius1);
+        window->DrawList->PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y));
       }
       detail::PathStroke(window->DrawList, color_alpha(bg, 1.f), thickness, false);
 
@@ -1747,7 +3157,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float bg_angle_offset = PI_2 / num_segments;
 
         for (int i = 0; i < balls; ++i) {
@@ -1766,7 +3176,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI * 16.f);
+        const float start = detail::AnimTime(speed, IM_PI * 16.f);
         const float bg_angle_offset = PI_2 / num_segments;
 
         for (int i = 0; i < balls; ++i) {
@@ -1780,7 +3190,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime()* speed;
+        const float start = detail::AnimTime(speed);
         const int half_segments = num_segments / 2;
 
         for (int i = 0; i < balls; ++i)
@@ -1812,7 +3222,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImFmod(ImGui::GetTime() * speed, IM_PI * 2);
+        const float start = detail::AnimTime(speed, IM_PI * 2);
         const int half_segments = num_segments / 2;
 
         for (int i = 0; i < arcs; ++i) {
@@ -1830,7 +3240,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed, IM_PI + PI_DIV_2 + PI_DIV(8));
         num_segments *= 2;
         const float bg_angle_offset = IM_PI / num_segments;
 
@@ -1839,7 +3249,7 @@ namespace ImSpinner
 
         for (int i = 0; i < arcs; ++i)
         {
-            float max_angle = IM_PI - ImFmod(start /* * (1.0 + 0.1f * i) */, IM_PI + PI_DIV_2 + PI_DIV(8));
+            float max_angle = IM_PI - start;
             max_angle = ImMin(IM_PI, max_angle + (PI_DIV_2 / arcs) * i);
             const float rb = (radius / arcs) * 1.1f * (i + 1);
 
@@ -1866,25 +3276,19 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      ImGuiStorage* storage = window->DC.StateStorage;
-      const ImGuiID vtimeId = window->GetID("##vtime");
-      const ImGuiID hmaxId = window->GetID("##hmax");
-
-      float vtime = storage->GetFloat(vtimeId, 0.f);
-      float hmax = storage->GetFloat(hmaxId, 1.f);
-
-      vtime += 0.05f;
-      hmax += 0.01f;
-
-      storage->SetFloat(vtimeId, vtime);
-      storage->SetFloat(hmaxId, hmax);
+      struct state_t { float hmax = 1.f; };
+      auto &state = detail::GetState<detail::Integrated<state_t>>(ImGui::GetItemID());
+      const float alpha = detail::Integrate(state, [] (state_t &s) { s.hmax += 0.01f; });
+      // hmax is only used modulo pi: keep it small so the float steps don't get lost
+      if (state.cur.hmax > IM_PI * 10.f) { state.cur.hmax -= IM_PI * 10.f; state.prev.hmax -= IM_PI * 10.f; }
+      const float hmax = ImLerp(state.prev.hmax, state.cur.hmax, alpha);
 
       constexpr float rkoeff[9] = {0.1f, 0.15f, 0.17f, 0.25f, 0.31f, 0.19f, 0.08f, 0.24f, 0.9f};
       const int iterations = shadow ? 4 : 1;
       for (int j = 0; j < iterations; j++) {
           ImColor c = color_alpha(color, 1.f - 0.15f * j);
           for (int i = 0; i < dots; i++) {
-              float start = ImFmod((float)ImGui::GetTime() * speed * (1 + rkoeff[i % 9]) - (IM_PI / 12.f) * j, IM_PI);
+              float start = ImFmod(detail::AnimTime(speed * (1 + rkoeff[i % 9]), IM_PI) + IM_PI - (IM_PI / 12.f) * j, IM_PI);
               float sign = ((i % 2 == 0) ? 1.f : -1.f);
               float offset = (i == 0) ? 0.f : (floorf((i+1) / 2.f + 0.1f) * sign * 2.f * thickness);
               float maxht = damped_gravity(ImSin(ImFmod(hmax, IM_PI))) * radius;
@@ -1897,12 +3301,10 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        ImGuiStorage* storage = window->DC.StateStorage;
-
         const int iterations = shadow ? 4 : 1;
         for (int j = 0; j < iterations; j++) {
             ImColor c = color_alpha(color, 1.f - 0.15f * j);
-            float start = ImFmod((float)ImGui::GetTime() * speed - (IM_PI / 12.f) * j, IM_PI);
+            float start = ImFmod(detail::AnimTime(speed, IM_PI) + IM_PI - (IM_PI / 12.f) * j, IM_PI);
             float maxht = damped_gravity(ImSin(ImFmod(start, IM_PI))) * (radius * 0.6f);
             window->DrawList->AddCircleFilled(ImVec2(centre.x, centre.y), maxht, c, num_segments);
         }
@@ -1912,7 +3314,7 @@ namespace ImSpinner
         for (size_t arc_num = 0; arc_num < arcs; ++arc_num) {
             window->DrawList->PathClear();
             float arc_start = 2 * IM_PI / arcs;
-            float start = ImFmod((float)ImGui::GetTime() * speed - (IM_PI * arc_num), IM_PI);
+            float start = detail::AnimTime(speed, IM_PI);
             float b = mode ? start + damped_spring(1, 10.f, 1.0f, ImSin(ImFmod(start + arc_num * PI_DIV(2) / arcs, IM_PI)), 1, 0) : start;
             float maxht = (damped_gravity(ImSin(ImFmod(start, IM_PI))) * 0.3f + 0.7f) * radius;
             for (size_t i = 0; i < num_segments; i++) {
@@ -1930,7 +3332,7 @@ namespace ImSpinner
       float radius = ImMax(ImMax(radius1, radius2), radius3);
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start1 = (float)ImGui::GetTime() * speed;
+      const float start1 = detail::AnimTime(speed);
       const float angle_offset = angle / num_segments;
 
       window->DrawList->PathClear();
@@ -1941,7 +3343,7 @@ namespace ImSpinner
       }
       detail::PathStroke(window->DrawList, color_alpha(c1, 1.f), thickness, false);
 
-      float start2 = (float)ImGui::GetTime() * 1.2f * speed;
+      float start2 = detail::AnimTime(1.2f * speed);
       window->DrawList->PathClear();
       for (size_t i = 0; i < num_segments; i++)
       {
@@ -1950,7 +3352,7 @@ namespace ImSpinner
       }
       detail::PathStroke(window->DrawList, color_alpha(c2, 1.f), thickness, false);
 
-      float start3 = (float)ImGui::GetTime() * 0.9f * speed;
+      float start3 = detail::AnimTime(0.9f * speed);
       window->DrawList->PathClear();
       for (size_t i = 0; i < num_segments; i++)
       {
@@ -1964,7 +3366,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float angle_offset = angle / num_segments;
       const float th = thickness / num_segments;
 
@@ -1983,8 +3385,8 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float startI = (float)ImGui::GetTime() * speed;
-      const float startY = (float)ImGui::GetTime() * (speed + (yang_detlta_r > 0.f ? ImClamp(yang_detlta_r * 0.5f, 0.5f, 2.f) : 0.f));
+      const float startI = detail::AnimTime(speed);
+      const float startY = detail::AnimTime(speed + (yang_detlta_r > 0.f ? ImClamp(yang_detlta_r * 0.5f, 0.5f, 2.f) : 0.f));
       const float angle_offset = angle / num_segments;
       const float th = thickness / num_segments;
 
@@ -2026,7 +3428,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI);
+      float start = detail::AnimTime(speed, IM_PI);
       start = mode ? damped_spring(1, 10.f, 1.0f, ImSin(start), 1, 0) : start;
       const float radius1 = (0.4f + 0.3f * ImSin(start)) * radius;
       const float radius2 = radius - radius1;
@@ -2040,8 +3442,8 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-      const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+      const float start = detail::AnimTime(1.f, IM_PI);
+      const float rstart = detail::AnimTime(speed, PI_2);
       float radius1 = (0.2f + 0.3f * ImSin(start)) * radius;
       const float angle_offset = PI_2 / balls;
 
@@ -2057,8 +3459,8 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-        const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(1.f, IM_PI);
+        const float rstart = detail::AnimTime(speed, PI_2);
         const float radius1 = 0.3f * radius;
         const float radius2 = 0.8f * radius;
         const float angle_offset = PI_2 / balls;
@@ -2080,8 +3482,8 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-        const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(1.f, IM_PI);
+        const float rstart = detail::AnimTime(speed, PI_2);
         const float radius1 = 0.3f * radius;
         const float radius2 = 0.8f * radius;
         const int balls = 2;
@@ -2117,8 +3519,8 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-      const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+      const float start = detail::AnimTime(1.f, IM_PI);
+      const float rstart = detail::AnimTime(speed, PI_2);
       const float radius1 = radius / 2.5f + thickness;
       const float angle_offset = PI_2 / tris;
 
@@ -2139,21 +3541,22 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-        const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(1.f, IM_PI);
+        const float rstart = detail::AnimTime(speed, PI_2);
         const float radius1 = radius / 2.5f + thickness;
         const float angle_offset = PI_2 / shapes;
 
-        std::vector<ImVec2> points(pnt);
         const float begin_a = -IM_PI / ((pnt % 2 == 0) ? pnt : (pnt - 1));
         for (int i = 0; i <= shapes; i++)
         {
             const float a = rstart + (i * angle_offset);
             ImVec2 tri_centre(centre.x + ImCos(a) * radius1, centre.y + ImSin(a) * radius1);
+            // Build the shape in the draw list's path buffer, which is reused between frames, rather than a fresh vector.
+            window->DrawList->PathClear();
             for (int pi = 0; pi < pnt; ++pi) {
-                points[pi] = {tri_centre.x + ImCos(begin_a + pi * PI_2 / pnt) * radius1, tri_centre.y + ImSin(begin_a + pi * PI_2 / pnt) * radius1};
+                window->DrawList->PathLineTo({tri_centre.x + ImCos(begin_a + pi * PI_2 / pnt) * radius1, tri_centre.y + ImSin(begin_a + pi * PI_2 / pnt) * radius1});
             }
-            window->DrawList->AddConvexPolyFilled(points.data(), pnt, color_alpha(color, 1.f));
+            window->DrawList->PathFillConvex(color_alpha(color, 1.f));
         }
     }
 
@@ -2161,12 +3564,12 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime(), IM_PI);
-        const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(1.f, IM_PI);
+        const float rstart = detail::AnimTime(speed, PI_2);
         const float radius1 = radius / 2.5f + thickness;
         const float angle_offset = PI_DIV_2;
 
-        std::vector<ImVec2> points(4);
+        ImVec2 points[4];
         for (int i = 0; i <= 4; i++)
         {
             const float a = rstart + (i * angle_offset);
@@ -2180,7 +3583,7 @@ namespace ImSpinner
             for (int pi = 0; pi < 4; ++pi) {
                 points[pi] = {tri_centre.x + ImCos(begin_a+ pi * PI_DIV_2) * radius1, tri_centre.y + ImSin(begin_a + pi * PI_DIV_2) * radius1};
             }
-            window->DrawList->AddConvexPolyFilled(points.data(), 4, color_alpha(color, 1.f));
+            window->DrawList->AddConvexPolyFilled(points, 4, color_alpha(color, 1.f));
         }
     }
 
@@ -2188,13 +3591,13 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float angle_offset = (angle * 0.5f) / num_segments;
       const float th = thickness / num_segments;
 
       window->DrawList->AddCircleFilled(centre, radius, bg, num_segments);
 
-      auto draw_gradient = [&] (const std::function<float (int)>& b, const std::function<float (int)>& e, const std::function<float (int)>& th) {
+      auto draw_gradient = [&] (const auto& b, const auto& e, const auto& th) {
         for (int i = 0; i < num_segments; i++)
         {
           window->DrawList->AddLine(ImVec2(centre.x + ImCos(start + b(i)) * radius, centre.y + ImSin(start + b(i)) * radius),
@@ -2227,7 +3630,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / num_segments;
       const float angle_offset = angle / num_segments;
       const float th = thickness_drop / num_segments;
@@ -2261,19 +3664,19 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+      float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
       window->DrawList->AddCircleFilled(centre, thickness, color_alpha(bg, 1.f), num_segments);
       window->DrawList->AddCircleFilled(centre, thickness, color_alpha(color, ImMax(0.1f, ImMin(lerp_koeff, 1.f))), num_segments);
 
       auto PathArc = [&] (const ImColor& c, float th) {
         window->DrawList->PathClear();
-        const float bg_angle_offset = PI_2 / num_segments;
+        const ImVec2 *unit = detail::UnitCircle(num_segments + 1, PI_2 / num_segments);
         for (int i = 0; i <= num_segments; i++)
-          window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(i * bg_angle_offset) * radius, centre.y + ImSin(i * bg_angle_offset) * radius));
+          window->DrawList->PathLineTo(ImVec2(centre.x + unit[i].x * radius, centre.y + unit[i].y * radius));
         detail::PathStroke(window->DrawList, color_alpha(c, 1.f), th, false);
       };
       
-      lerp_koeff = (ImSin((float)ImGui::GetTime() * speed * 1.6f) + 1.f) * 0.5f;
+      lerp_koeff = (ImSin(detail::AnimTime(speed * 1.6f)) + 1.f) * 0.5f;
       PathArc(bg, thickness);
       PathArc(color_alpha(color, 1.f - ImMax(0.1f, ImMin(lerp_koeff, 1.f))), thickness);
     }
@@ -2282,7 +3685,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+        float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
         float start_ang = -cangle - PI_DIV_4 - PI_DIV_2;
         ImVec2 pc(centre.x + ImSin(cangle) * radius, centre.y + ImCos(cangle) * radius);
         window->DrawList->AddCircleFilled(pc, thickness, bg, num_segments);
@@ -2299,7 +3702,7 @@ namespace ImSpinner
         const float interval = (size.x * 0.7f) / dots;
         for (int i = 0; i < dots; ++i) {
             float r = 1.5f * (i + 1) * interval;
-            lerp_koeff = (ImSin((float)ImGui::GetTime() * speed - (i+1) * (IM_PI / dots)) + 1.f) * 0.5f;
+            lerp_koeff = (ImSin(detail::AnimTime(speed) - (i+1) * (IM_PI / dots)) + 1.f) * 0.5f;
             PathArc(start_ang, bg, thickness, r);
             PathArc(start_ang, color_alpha(color, ImMax(0.1f, ImMin(lerp_koeff, 1.f))), thickness, r);
         }
@@ -2309,14 +3712,14 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+      float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
       ImColor c = color_alpha(color, ImMax(0.1f, ImMin(lerp_koeff, 1.f)));
       float dr = radius - thickness - 3;
       window->DrawList->AddCircleFilled(centre, dr, bg, num_segments);
       window->DrawList->AddCircleFilled(centre, dr, c, num_segments);
 
       // Render
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
       float astart = ImFmod(start, PI_2 / bars);
       start -= astart;
       const float angle_offset = PI_2 / bars;
@@ -2333,7 +3736,7 @@ namespace ImSpinner
         };
       };
 
-      auto draw_sectors = [&] (float s, const std::function<ImU32 (size_t)>& color_func) {
+      auto draw_sectors = [&] (float s, const auto& color_func) {
         for (size_t i = 0; i <= bars; i++) {
           float left = s + (i * angle_offset) - angle_offset_t;
           float right = s + (i * angle_offset) + angle_offset_t;
@@ -2351,7 +3754,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
       switch (mode) {
       case 1:
         start += ease_inoutquad(ImSin(ImFmod(start, IM_PI)));
@@ -2371,7 +3774,7 @@ namespace ImSpinner
         };
       };
 
-      auto draw_sectors = [&] (float s, const std::function<ImU32 (int)>& color_func) {
+      auto draw_sectors = [&] (float s, const auto& color_func) {
         for (size_t i = 0; i <= bars; i++) {
           float left = s + (i * angle_offset) - angle_offset_t;
           float right = s + (i * angle_offset) + angle_offset_t;
@@ -2387,42 +3790,41 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float angle_offset = (angle * 0.5f) / num_segments;
       const float bg_angle_offset = (PI_2) / num_segments;
       const float th = thickness / num_segments;
 
+      static detail::ArcTable arc;
+      arc.Fill(num_segments + 1, 0.f, bg_angle_offset);
       for (size_t i = 0; i <= num_segments; i++)
       {
-        const float a = (i * bg_angle_offset);
-        window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
+        window->DrawList->PathLineTo(ImVec2(centre.x + arc.c[i] * radius, centre.y + arc.s[i] * radius));
       }
       detail::PathStroke(window->DrawList, bg, thickness, false);
 
-      auto draw_gradient = [&] (const std::function<float (size_t)>& b, const std::function<float (size_t)>& e, const std::function<ImU32 (size_t)>& c) {
+      // Both halves of the gradient walk one arc of 2 * num_segments steps; segment i spans points i and i + 1.
+      arc.Fill(num_segments * 2 + 1, start, angle_offset);
+      auto draw_gradient = [&] (size_t first, const auto& c) {
         for (size_t i = 0; i < num_segments; i++)
         {
-          window->DrawList->AddLine(ImVec2(centre.x + ImCos(start + b(i)) * radius, centre.y + ImSin(start + b(i)) * radius),
-                                    ImVec2(centre.x + ImCos(start + e(i)) * radius, centre.y + ImSin(start + e(i)) * radius),
+          const size_t b = first + i, e = first + i + 1;
+          window->DrawList->AddLine(ImVec2(centre.x + arc.c[b] * radius, centre.y + arc.s[b] * radius),
+                                    ImVec2(centre.x + arc.c[e] * radius, centre.y + arc.s[e] * radius),
                                     c(i),
                                     thickness);
         }
       };
 
-      draw_gradient([&] (size_t i) { return (i) * angle_offset; },
-                    [&] (size_t i) { return (i + 1) * angle_offset; },
-                    [&] (size_t i) { return color_alpha(color, (i / (float)num_segments)); });
-
-      draw_gradient([&] (size_t i) { return (num_segments + i) * angle_offset; },
-                    [&] (size_t i) { return (num_segments + i + 1) * angle_offset; },
-                    [&] (size_t i) { return color_alpha(color, 1.f - (i / (float)num_segments)); });
+      draw_gradient(0,            [&] (size_t i) { return color_alpha(color, (i / (float)num_segments)); });
+      draw_gradient(num_segments, [&] (size_t i) { return color_alpha(color, 1.f - (i / (float)num_segments)); });
     }
 
     inline void SpinnerRotateSegments(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t arcs = 4, size_t layers = 1, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = (float)ImGui::GetTime()* speed;
+      float start = detail::AnimTime(speed);
       switch (mode) {
       case 1: start += ease_inoutquad(ImSin(ImFmod(start, IM_PI))); break;
       }
@@ -2434,12 +3836,13 @@ namespace ImSpinner
       {
         for (size_t arc_num = 0; arc_num < arcs; ++arc_num)
         {
+          static detail::ArcTable arc;
+          const float a = start * (1 + 0.1f * layer) + arc_angle * arc_num + (2 * angle_offset);
+          arc.Fill(num_segments - 3, a * reverse, angle_offset * reverse);
+
           window->DrawList->PathClear();
-          for (size_t i = 2; i <= num_segments - 2; i++)
-          {
-            const float a = start * (1 + 0.1f * layer) + arc_angle * arc_num + (i * angle_offset);
-            window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(a * reverse) * r, centre.y + ImSin(a * reverse) * r));
-          }
+          for (int i = 0; i < num_segments - 3; i++)
+            window->DrawList->PathLineTo(ImVec2(centre.x + arc.c[i] * r, centre.y + arc.s[i] * r));
           detail::PathStroke(window->DrawList, color_alpha(color, 1.f), thickness, false);
         }
 
@@ -2452,7 +3855,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float a = radius;
       const float t = start;
       const float step = angle / num_segments;
@@ -2474,7 +3877,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       const float bg_angle_offset = PI_2 / num_segments;
       const float bg_radius = radius - thickness;
 
@@ -2502,7 +3905,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float bg_radius = radius - thickness;
         const float line_th = ImMax(radius / 8.f, 3.f);
 
@@ -2536,7 +3939,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       elipses = std::min<int>(elipses, 3);
 
       auto draw_rotated_ellipse = [&] (float alpha, float start) {
@@ -2575,7 +3978,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime()* speed;
+        const float start = detail::AnimTime(speed);
         elipses = std::max<int>(elipses, 1);
 
         auto draw_rotated_ellipse = [&] (float alpha, float tr, float y) {
@@ -2606,7 +4009,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime()* speed;
+        const float start = detail::AnimTime(speed);
         elipses = std::max<int>(elipses, 1);
 
         auto draw_rotated_ellipse = [&] (const ImVec2 &pp, float alpha, float tr, float r, float x, float y) {
@@ -2643,7 +4046,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed * 3.f, size.y);
+        const float start = detail::AnimTime(speed * 3.f, size.y);
         elipses = std::max<int>(elipses, 1);
 
         auto draw_rotated_ellipse = [&] (float alpha, float tr, float y, float r) {
@@ -2678,10 +4081,10 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
        
         num_segments *= 4;
-        const float aoffset = ImFmod((float)ImGui::GetTime(), PI_2);
+        const float aoffset = detail::AnimTime(1.f, PI_2);
         const float bofsset = (aoffset > IM_PI) ? IM_PI : aoffset;
         const float angle_offset = PI_2 / num_segments;
         float ared_min = 0, ared = 0;
@@ -2721,7 +4124,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         num_segments *= 4;
 
         const float angle_offset = PI_2 / num_segments;
@@ -2765,7 +4168,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float start = (float)ImGui::GetTime()* speed;
+      const float start = detail::AnimTime(speed);
       auto draw_rotated_ellipse = [&] (float alpha) {
         std::array<ImVec2, 36> pts;
 
@@ -2795,10 +4198,11 @@ namespace ImSpinner
     inline void SpinnerRainbowBalls(const char *label, float radius, float thickness, const ImColor &color, float speed, int balls = 5, int mode = 0, int rings = 1, int mx = 1)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float start = ImFmod((float)ImGui::GetTime() * speed * 3.f, IM_PI);
-      const float colorback = 0.3f + 0.2f * ImSin((float)ImGui::GetTime() * speed);
-      const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+      const float start = detail::AnimTime(speed * 3.f, IM_PI);
+      const float colorback = 0.3f + 0.2f * ImSin(detail::AnimTime(speed));
+      const float rstart = detail::AnimTime(speed, PI_2);
       const float radius1 = (0.7f + 0.2f * ImSin(start)) * radius;
       const float angle_offset = PI_2 / balls;
       const bool rainbow = ((ImU32)color.Value.w) == 0;
@@ -2808,19 +4212,22 @@ namespace ImSpinner
       for (int j = 0; j < rings; j++) {
           const float ring_r = radius1 * (rings > 1 ? ((j+1) / (float)rings) : 1);
           float ring_angle = (j * (PI_2 / rings));
+          static detail::ArcTable arc;
+          arc.Fill(balls, rstart + ring_angle, angle_offset);
           for (int i = 0; i < balls; i++) {
             const float a = rstart + (i * angle_offset) + ring_angle;
+            const float ca = arc.c[i], sa = arc.s[i];
             ImColor c = rainbow ? ImColor::HSV(out_h + i * (1.f / balls) + colorback, out_s, out_v) : color;
             float rb = ring_r + ease((ease_mode)mode, start, ring_r);
             float ax, ay;
             switch (mx) {
-            default: ax = ImCos(a) * rb; ay = ImSin(a) * rb; break;
-            case 1: ax = ImCos(a) * rb; ay = ImSin(a) * rb + ImSin(a * 8) * rb * 0.15f; break;
-            case 2: { float pulse = 0.8f + 0.2f * ImSin(start * 2); ax = ImCos(a) * rb * pulse; ay = ImSin(a) * rb * pulse; } break;
-            case 3: { float R = rb, r = rb * 0.3f, d = rb * 0.1f; float t = a; ax = (R - r) * ImCos(t) + d * ImCos((R - r) / r * t); ay = (R - r) * ImSin(t) - d * ImSin((R - r) / r * t); } break;
-            case 4: { float t = a; ax = rb * ImCos(t) / (1 + ImSin(t) * ImSin(t)); ay = rb * ImSin(t) * ImCos(t) / (1 + ImSin(t) * ImSin(t)); } break;
-            case 5: { float zigzag = (ImSin(a * 8) > 0) ? rb * 0.3f : -rb * 0.3f; ax = ImCos(a) * rb + zigzag * ImCos(a + IM_PI / 2); ay = ImSin(a) * rb + zigzag * ImSin(a + IM_PI / 2); } break;
-            case 6: ax = ImCos(a) * (rb + ImSin(a * 3) * rb * 0.3f); ay = ImSin(a) * (rb + ImSin(a * 3) * rb * 0.3f); break;
+            default: ax = ca * rb; ay = sa * rb; break;
+            case 1: ax = ca * rb; ay = sa * rb + ImSin(a * 8) * rb * 0.15f; break;
+            case 2: { float pulse = 0.8f + 0.2f * ImSin(start * 2); ax = ca * rb * pulse; ay = sa * rb * pulse; } break;
+            case 3: { float R = rb, r = rb * 0.3f, d = rb * 0.1f; float t = a; ax = (R - r) * ca + d * ImCos((R - r) / r * t); ay = (R - r) * sa - d * ImSin((R - r) / r * t); } break;
+            case 4: ax = rb * ca / (1 + sa * sa); ay = rb * sa * ca / (1 + sa * sa); break;
+            case 5: { float zigzag = (ImSin(a * 8) > 0) ? rb * 0.3f : -rb * 0.3f; ax = ca * rb - zigzag * sa; ay = sa * rb + zigzag * ca; } break;
+            case 6: ax = ca * (rb + ImSin(a * 3) * rb * 0.3f); ay = sa * (rb + ImSin(a * 3) * rb * 0.3f); break;
             case 7:
                 {
                     float t = ImFmod(a, PI_2) / PI_2;
@@ -2830,9 +4237,9 @@ namespace ImSpinner
                     else { ax = (t * 4 - 1.75f) * 2 * rb; ay = -rb; }
                 }
                 break;
-            case 8: ax = ImCos(a) * rb; ay = ImSin(a) * rb + ImSin(a * 4) * rb * 0.2f; break;
+            case 8: ax = ca * rb; ay = sa * rb + ImSin(a * 4) * rb * 0.2f; break;
             }
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ax, centre.y + ay), thickness, color_alpha(c, 1.f), num_segments);
+            discs.Add(ImVec2(centre.x + ax, centre.y + ay), thickness, color_alpha(c, 1.f), num_segments);
           }
       }
     }
@@ -2841,9 +4248,9 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed * 3.f, PI_2);
-        const float colorback = 0.3f + 0.2f * ImSin((float)ImGui::GetTime() * speed);
-        const float rstart = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed * 3.f, PI_2);
+        const float colorback = 0.3f + 0.2f * ImSin(detail::AnimTime(speed));
+        const float rstart = detail::AnimTime(speed, PI_2);
         const float angle_offset = PI_2 / balls;
         const bool rainbow = ((ImU32)color.Value.w) == 0;
 
@@ -2874,14 +4281,15 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         float a = radius / num_segments;
         float b = a;
+        const int steps = detail::ArcSegments(a + b * PI_2 * arcs, PI_2);  // per turn, for the outermost turn
 
         ImVec2 last = centre;
-        for (size_t arc_num = 0; arc_num < (num_segments * arcs); ++arc_num)
+        for (int arc_num = 0; arc_num < steps * (int)arcs; ++arc_num)
         {
-            float angle = (PI_2 / num_segments) * arc_num;
+            float angle = (PI_2 / steps) * arc_num;
             float x = centre.x + (a + b * angle) * ImCos(start + angle);
             float y = centre.y + (a + b * angle) * ImSin(start + angle);
 
@@ -2894,7 +4302,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         float a = (radius * 3.f) / num_segments;
         float b = a;
         num_segments *= 4;
@@ -2921,7 +4329,8 @@ namespace ImSpinner
       ImVec2 lt{centre.x - radius, centre.y - radius};
       const float offset_block = radius * 2.f / 3.f;
 
-      int start = (int)ImFmod((float)ImGui::GetTime() * speed, 8.f);
+      int start = (int)detail::AnimTime(speed, 8.f);
+      spinner_scope.NextChange(detail::NextStepTime(speed, 8.f));
 
       const ImVec2ih poses[] = {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
 
@@ -2943,7 +4352,7 @@ namespace ImSpinner
         const float offset_block = radius * 2.f / 3.f;
         ImVec2 lt{centre.x - radius - offset_block / 2.f, centre.y - radius - offset_block / 2.f};
 
-        int start = (int)ImFmod((float)ImGui::GetTime() * speed, 8.f);
+        int start = (int)detail::AnimTime(speed, 8.f);
         const ImVec2ih poses[] = {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
 
         int ti = 0;
@@ -2958,7 +4367,7 @@ namespace ImSpinner
 
         lt = ImVec2{centre.x - radius + offset_block / 2.f, centre.y - radius + offset_block / 2.f};
         ti = std::size(poses) - 1;
-        start = (int)ImFmod((float)ImGui::GetTime() * speed * 1.1f, 8.f);
+        start = (int)detail::AnimTime(speed * 1.1f, 8.f);
         for (const auto &rpos: poses)
         {
             const ImColor &c = (ti == start) ? color : bg;
@@ -2987,11 +4396,11 @@ namespace ImSpinner
       {
         ImColor c = ImColor::HSV(out_h + ti * 0.1f, out_s, out_v);
         if (mode) {
-            float h = (0.1f + 0.4f * ImSin((float)ImGui::GetTime() * (speed * rkoeff[ti % 9])));
+            float h = (0.1f + 0.4f * ImSin(detail::AnimTime(speed * rkoeff[ti % 9])));
             window->DrawList->AddCircleFilled(ImVec2(lt.x + rpos.x * (offset_block), lt.y + rpos.y * offset_block), std::max<float>(1.f, h * thickness),
                                               color_alpha(c, 1.f));
         } else {
-            float h = (0.8f + 0.4f * ImSin((float)ImGui::GetTime() * (speed * rkoeff[ti % 9])));
+            float h = (0.8f + 0.4f * ImSin(detail::AnimTime(speed * rkoeff[ti % 9])));
             window->DrawList->AddRectFilled(ImVec2(lt.x + rpos.x * (offset_block), lt.y + rpos.y * offset_block),
                                            ImVec2(lt.x + rpos.x * (offset_block) + h * thickness, lt.y + rpos.y * offset_block + h * thickness),
                                            color_alpha(c, 1.f));
@@ -3017,7 +4426,7 @@ namespace ImSpinner
         for (const auto &rpos: poses)
         {
             const ImColor c = ImColor::HSV(out_h + offsets[ti], out_s, out_v);
-            const float strict = (0.5f + 0.5f * ImSin((float)-ImGui::GetTime() * speed + offsets[ti % 9]));
+            const float strict = (0.5f + 0.5f * ImSin(-detail::AnimTime(speed) + offsets[ti % 9]));
             const float side = ImClamp<float>(strict + 0.1f, 0.1f, 1.f) * hside;
             window->DrawList->AddRectFilled(ImVec2(lt.x + hside + (rpos.x * offset_block) - side, lt.y + hside + (rpos.y * offset_block) - side),
                                             ImVec2(lt.x + hside + (rpos.x * offset_block) + side, lt.y + hside + (rpos.y * offset_block) + side),
@@ -3030,7 +4439,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
         
-        float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        float start = detail::AnimTime(speed, PI_2);
         const float side = ImSin((float)-start) * radius;
         bool type = (start > IM_PI) ? 1 : 0;
         if (type) {
@@ -3054,20 +4463,23 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       float arc_angle = PI_2 / (float)arcs;
-      const float angle_offset = arc_angle / num_segments;
+      // Tessellate the swept angle (the arc plus one step of overlap), not the full circle.
+      const float sweep = arc_angle * (num_segments + 1) / num_segments;
+      const int arc_segments = detail::ArcSegments(radius, sweep);
+      const float angle_offset = sweep / arc_segments;
       constexpr float rkoeff[6][3] = {{0.15f, 0.1f, 0.1f}, {0.033f, 0.15f, 0.8f}, {0.017f, 0.25f, 0.6f}, {0.037f, 0.1f, 0.4f}, {0.25f, 0.1f, 0.3f}, {0.11f, 0.1f, 0.2f}};
       for (size_t arc_num = 0; arc_num < arcs; ++arc_num)
       {
         const float b = arc_angle * arc_num - PI_DIV_2 - PI_DIV_4;
         const float e = arc_angle * arc_num + arc_angle - PI_DIV_2 - PI_DIV_4;
         const float a = arc_angle * arc_num;
-        float h = (0.6f + 0.3f * ImSin((float)ImGui::GetTime() * (speed * rkoeff[arc_num % 6][2] * 2.f) + (2 * rkoeff[arc_num % 6][0])));
+        float h = (0.6f + 0.3f * ImSin(detail::AnimTime(speed * rkoeff[arc_num % 6][2] * 2.f) + (2 * rkoeff[arc_num % 6][0])));
         ImColor c = color_alpha(color, h);
         c.Value.w += ease((ease_mode)mode, h, arc_angle);
 
         window->DrawList->PathClear();
         window->DrawList->PathLineTo(centre);
-        for (size_t i = 0; i <= num_segments + 1; i++)
+        for (int i = 0; i <= arc_segments; i++)
         {
           const float ar = arc_angle * arc_num + (i * angle_offset) - PI_DIV_2 - PI_DIV_4;
           window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(ar) * radius, centre.y + ImSin(ar) * radius));
@@ -3081,22 +4493,24 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       float arc_angle = PI_2 / (float)arcs;
-      const float angle_offset = arc_angle / num_segments;
+      // Tessellate the swept angle (the arc plus one step of overlap), not the full circle.
+      const float sweep = arc_angle * (num_segments + 1) / num_segments;
+      const int arc_segments = detail::ArcSegments(radius, sweep);
+      const float angle_offset = sweep / arc_segments;
       constexpr float rkoeff[6][3] = {{0.15f, 0.1f, 0.41f}, {0.033f, 0.15f, 0.8f}, {0.017f, 0.25f, 0.6f}, {0.037f, 0.1f, 0.4f}, {0.25f, 0.1f, 0.3f}, {0.11f, 0.1f, 0.2f}};
       float out_h, out_s, out_v;
-      const float start = (float)ImGui::GetTime();
       ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
       for (size_t arc_num = 0; arc_num < arcs; ++arc_num)
       {
         const float b = arc_angle * arc_num - PI_DIV_2 - PI_DIV_4;
         const float e = arc_angle * arc_num + arc_angle - PI_DIV_2 - PI_DIV_4;
         const float a = arc_angle * arc_num;
-        float r = (0.6f + 0.3f * ImSin(start * (speed * rkoeff[arc_num % 6][2] * 2.f) + (2.f * rkoeff[arc_num % 6][0])));
+        float r = (0.6f + 0.3f * ImSin(detail::AnimTime(speed * rkoeff[arc_num % 6][2] * 2.f) + (2.f * rkoeff[arc_num % 6][0])));
 
         window->DrawList->PathClear();
         window->DrawList->PathLineTo(centre);
         ImColor c = ImColor::HSV(out_h + arc_num * 0.31f, out_s, out_v);
-        for (size_t i = 0; i <= num_segments + 1; i++)
+        for (int i = 0; i <= arc_segments; i++)
         {
           const float ar = arc_angle * arc_num + (i * angle_offset) - PI_DIV_2 - PI_DIV_4;
           window->DrawList->PathLineTo(ImVec2(centre.x + ImCos(ar) * (radius * r), centre.y + ImSin(ar) * (radius * r)));
@@ -3109,7 +4523,7 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed, PI_2 * 50.f);   // 50 turns: a whole number of turns for start * 0.78 too
       float astart = ImFmod(start, PI_2 / arcs);
       start -= astart;
       const float angle_offset = PI_2 / arcs;
@@ -3126,7 +4540,7 @@ namespace ImSpinner
         };
       };
 
-      auto draw_sectors = [&] (float s, const std::function<ImColor (size_t)>& color_func, float r) {
+      auto draw_sectors = [&] (float s, const auto& color_func, float r) {
         for (size_t i = 0; i <= arcs; i++) {
           float left = s + (i * angle_offset) - angle_offset_t;
           float right = s + (i * angle_offset) + angle_offset_t;
@@ -3143,7 +4557,7 @@ namespace ImSpinner
       case 1:
         {
           ImColor c = color;
-          float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+          float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
           c.Value.w = ImMax(0.1f, ImMin(lerp_koeff, 1.f));
           float dr = radius - thickness - 3;
           window->DrawList->AddCircleFilled(centre, dr, c, num_segments);
@@ -3160,7 +4574,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        float start = detail::AnimTime(speed, PI_2);
         float length = ImFmod(start, IM_PI);
         const float dangle = ImSin(length) * IM_PI * 0.35f;
         const float angle_offset = IM_PI / num_segments;
@@ -3189,11 +4603,11 @@ namespace ImSpinner
         SPINNER_HEADER(pos, size, centre, num_segments);
 
         ImColor c = color;
-        float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+        float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
         c.Value.w = ImMax(0.1f, ImMin(lerp_koeff, 1.f));
 
         const float angle_offset = PI_2 / bars;
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
         const float astart = ImFmod(start, angle_offset);
         const float save_start = start;
         start -= astart;
@@ -3229,13 +4643,14 @@ namespace ImSpinner
     inline void SpinnerPointsShift(const char *label, float radius, float thickness, const ImColor &color = white, const ImColor &bg = half_white, float speed = 2.8f, size_t bars = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         ImColor c = color;
-        float lerp_koeff = (ImSin((float)ImGui::GetTime() * speed) + 1.f) * 0.5f;
+        float lerp_koeff = (ImSin(detail::AnimTime(speed)) + 1.f) * 0.5f;
         c.Value.w = ImMax(0.1f, ImMin(lerp_koeff, 1.f));
 
         const float angle_offset = PI_2 / bars;
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
         const float astart = ImFmod(start, angle_offset);
         const float save_start = start;
         start -= astart;
@@ -3252,7 +4667,7 @@ namespace ImSpinner
             rc.Value.w = ImMax(rmul, 0.1f);
             rmul *= 1.f + ImSin(rmul * IM_PI);
             const float r = ImMax(radius * rmul, radius);
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(left) * r, centre.y + ImSin(left) * r), thickness, color_alpha(rc, 1.f), num_segments);
+            discs.Add(ImVec2(centre.x + ImCos(left) * r, centre.y + ImSin(left) * r), thickness, color_alpha(rc, 1.f), num_segments);
         }
     }
 
@@ -3260,8 +4675,9 @@ namespace ImSpinner
     inline void SpinnerCircularPoints(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.8f, int lines = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, radius);
+        const float start = detail::AnimTime(speed, radius);
         const float bg_angle_offset = (PI_2) / lines;
         for (size_t j = 0; j < 3; ++j)
         {
@@ -3272,7 +4688,7 @@ namespace ImSpinner
             for (size_t i = 0; i < lines; i++)
             {
                 float a = (i * bg_angle_offset);
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * rmax, centre.y + ImSin(a) * rmax), thickness, c, num_segments);
+                discs.Add(ImVec2(centre.x + ImCos(a) * rmax, centre.y + ImSin(a) * rmax), thickness, c, num_segments);
             }
         }
     }
@@ -3281,7 +4697,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const float bg_angle_offset = PI_2 / num_segments;
 
         float out_h, out_s, out_v;
@@ -3305,7 +4721,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        float start = detail::AnimTime(speed, PI_2);
 
         window->DrawList->PathClear();
         for (size_t i = 0; i <= 90; i++)
@@ -3333,7 +4749,7 @@ namespace ImSpinner
 
         const float bg_angle_offset = PI_2_DIV(num_segments);
         const float koeff = PI_DIV(2 * layers);
-        float start = (float)ImGui::GetTime() * speed;
+        float start = detail::AnimTime(speed);
 
         for (int num_ring = 0; num_ring < layers; ++num_ring) {
             float radius_k = ImSin(ImFmod(start + (num_ring * koeff), PI_DIV_2));
@@ -3355,7 +4771,7 @@ namespace ImSpinner
     inline void SpinnerSplineAng(const char *label, float radius, float thickness, const ImColor &color = white, const ImColor &bg = white, float speed = 2.8f, float angle = IM_PI, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);                            // Get the position, size, centre, and number of segments of the spinner using the SPINNER_HEADER macro.
-        float start = (float)ImGui::GetTime() * speed;                        // The start angle of the spinner is calculated based on the current time and the specified speed.
+        float start = detail::AnimTime(speed);                        // The start angle of the spinner is calculated based on the current time and the specified speed.
         radius = (mode == 1) ? (0.8f + ImCos(start) * 0.2f) * radius : radius;
 
         //circle([&] (int i) {                                                         // Draw the background of the spinner using the `circle` function, with the specified background color and thickness.
@@ -3385,7 +4801,7 @@ namespace ImSpinner
       const float dot_r = 0.12f * W;        // 12px dot on a 50px box
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.f);
       float ang = ImFmod(time, 1.f) * IM_PI;        // .5 turn per second
       if (mode == 1) ang *= 2.f;                    // full turn
       if (mode == 2) ang = -ang;
@@ -3435,7 +4851,7 @@ namespace ImSpinner
       const float R = radius - thickness * 0.5f;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.f);
       float rot = ImFmod(time, 1.f) * (2.f * IM_PI);   // full turn per second
       if (mode == 2) rot = -rot;
 
@@ -3461,6 +4877,7 @@ namespace ImSpinner
     inline void SpinnerOrbitMoon(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
       (void)thickness; (void)color;
 
       const float s = radius / 35.f;          // CSS box is 70px (half = 35px)
@@ -3468,7 +4885,7 @@ namespace ImSpinner
       const ImColor green  = color_alpha(ImColor(0, 128, 0), 1.f);
       const ImColor grey   = color_alpha(ImColor(204, 204, 204), 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.f);
       float th = ImFmod(time, 1.f) * (2.f * IM_PI);            // hub orbit: 1 rev/sec
       float ph = ImFmod(time, 0.5f) / 0.5f * (2.f * IM_PI);    // moon orbit: 2 rev/sec
       if (mode == 2) { th = -th; ph = -ph; }
@@ -3481,17 +4898,17 @@ namespace ImSpinner
       // planet (green) orbits the hub, starting at the bottom
       float gx, gy;
       rot(0.f, 29.f * s, th, gx, gy);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + gx, centre.y + gy), 6.f * s, green, num_segments);
+      discs.Add(ImVec2(centre.x + gx, centre.y + gy), 6.f * s, green, num_segments);
 
       // hub (orange) sits at the centre
-      window->DrawList->AddCircleFilled(centre, 8.f * s, orange, num_segments);
+      discs.Add(centre, 8.f * s, orange, num_segments);
 
       // moon (grey): circle the planet, then carry the whole arm around the hub
       float mlx, mly;
       rot(0.f, -14.f * s, ph, mlx, mly);
       float mx, my;
       rot(mlx, 29.f * s + mly, th, mx, my);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + mx, centre.y + my), 4.f * s, grey, num_segments);
+      discs.Add(ImVec2(centre.x + mx, centre.y + my), 4.f * s, grey, num_segments);
     }
 
     // Conic wheels:
@@ -3511,7 +4928,7 @@ namespace ImSpinner
         color_alpha(ImColor(255, 165, 22), 1.f),   // #ffa516 orange
       };
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 6.f);
       float aO = ImFmod(time, 2.f) / 2.f * (2.f * IM_PI);     // outer:  2.0s / turn
       float aM = ImFmod(time, 1.f) * (2.f * IM_PI);           // middle: 1.0s / turn
       float aI = ImFmod(time, 1.2f) / 1.2f * (2.f * IM_PI);   // inner:  1.2s / turn
@@ -3539,6 +4956,7 @@ namespace ImSpinner
     inline void SpinnerDotRing(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
       (void)color;
 
       const ImColor g1 = color_alpha(ImColor(81, 75, 130), 1.f);    // #514b82 purple
@@ -3546,14 +4964,14 @@ namespace ImSpinner
       const int N = 12;
       const float ring = radius - thickness;
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float spin = ImFmod(time, 2.f) / 2.f * (2.f * IM_PI);   // one turn per 2 sec
       spin = (mode == 2) ? spin : -spin;                      // CSS rotates -1turn (CCW)
 
       for (int k = 0; k < N; k++) {
         const float a = -IM_PI * 0.5f + spin + k * (2.f * IM_PI / N);
         const ImVec2 p(centre.x + ImCos(a) * ring, centre.y + ImSin(a) * ring);
-        window->DrawList->AddCircleFilled(p, thickness, (k % 2 == 0) ? g1 : g2, num_segments);
+        discs.Add(p, thickness, (k % 2 == 0) ? g1 : g2, num_segments);
       }
     }
 
@@ -0,0 +1,184 @@
+#ifndef _IMSPINNER_BAKED_H_
+#define _IMSPINNER_BAKED_H_
+
+/*
+ * imspinner baked add-on
+ *
+ * Most spinners are periodic functions of time, so a dashboard full of them keeps
+ * regenerating the same anti-aliased polylines. SpinnerBaked renders 'frames' phase
+ * samples of one spinner + parameter set once on the CPU (imspinner_raster.h), packs
+ * them into a sprite sheet and then draws a single textured quad per frame.
+ *
+ * The sheet lives in a texture the application owns: install the create/destroy
+ * handlers once with SetBakedTextureHandlers(). Without handlers SpinnerBaked just
+ * draws the spinner live. Only spinners that are a pure function of time bake well;
+ * the ones that keep state between frames (detail::GetState) are sampled cold.
+ */
+
+#include <cfloat>
+#include <map>
+
+#include "imspinner_raster.h"
+
+namespace ImSpinner
+{
+    // Creates a texture from RGBA8 pixels (IM_COL32 byte order, width * height texels) and returns its id.
+    using BakedTextureCreate = ImTextureID (*)(const void *pixels, int width, int height);
+    using BakedTextureDestroy = void (*)(ImTextureID tex);
+
+    namespace detail {
+      struct BakedSheet {
+        ImTextureID tex = (ImTextureID)0;
+        ImGuiID params = 0;
+        int frames = 0, cols = 0, rows = 0;
+        float radius = 0.f, period = 0.f;
+      };
+
+      struct BakedState {
+        BakedTextureCreate create = nullptr;
+        BakedTextureDestroy destroy = nullptr;
+        std::map<ImGuiID, BakedSheet> sheets;
+      };
+
+      inline BakedState &GetBakedState() { static BakedState state; return state; }
+
+      inline void ReleaseBakedSheet(BakedSheet &sheet)
+      {
+        BakedState &state = GetBakedState();
+        if (sheet.tex != (ImTextureID)0 && state.destroy)
+          state.destroy(sheet.tex);
+        sheet.tex = (ImTextureID)0;
+      }
+
+      // Renders 'frames' samples of draw(label) over one period into a grid sheet of cell_size cells.
+      // The spinner is drawn into a scratch draw list at the current cursor with the clock pinned and clipping
+      // overridden; the window layout is restored afterwards, so baking leaves no trace in the UI. The sheet is
+      // converted to straight alpha, since AddImage blends it as such: left premultiplied, anti-aliased edges and
+      // translucent parts would be multiplied by alpha twice and come out darker than the live spinner.
+      template<typename F>
+      inline void BakeSheet(RasterImage &image, const char *label, const ImVec2 &cell_size, const ImVec2 &scale, int cols, int frames, float period, const F &draw)
+      {
+        ImGuiContext &g = *GImGui;
+        ImGuiWindow *window = ImGui::GetCurrentWindow();
+
+        const ImGuiWindowTempData dc = window->DC;
+        const ImRect clip = window->ClipRect;
+        ImDrawList *draw_list = window->DrawList;
+
+        const int cell_w = (int)ImCeil(cell_size.x * scale.x), cell_h = (int)ImCeil(cell_size.y * scale.y);
+        image.Resize(cols * cell_w, ((frames + cols - 1) / cols) * cell_h);
+        const RasterTexture tex = GetFontRasterTexture();
+
+        ImDrawList scratch(draw_list->_Data);
+        window->DrawList = &scratch;
+        window->ClipRect = ImRect(ImVec2(-FLT_MAX, -FLT_MAX), ImVec2(FLT_MAX, FLT_MAX));
+
+        const ImVec2 pos = dc.CursorPos;
+        for (int k = 0; k < frames; k++) {
+          scratch._ResetForNewFrame();
+          scratch.PushClipRect(pos, ImVec2(pos.x + cell_size.x, pos.y + cell_size.y));
+#if IMGUI_VERSION_NUM < 19197
+          scratch.PushTextureID(g.IO.Fonts->TexID);
+#else
+          scratch.PushTexture(g.IO.Fonts->TexRef);
+#endif
+          window->DC = dc;
+
+          ImGui::PushID(k);
+          {
+            ClockScope clock((double)period * k / frames);
+            draw(label);
+          }
+          ImGui::PopID();
+
+          // Shift the origin so this sample lands in its own cell of the sheet.
+          const ImVec2 cell((float)((k % cols) * cell_w), (float)((k / cols) * cell_h));
+          RasterizeDrawList(image, &scratch, tex, ImVec2(pos.x - cell.x / scale.x, pos.y - cell.y / scale.y), scale);
+        }
+
+        window->ClipRect = clip;
+        window->DrawList = draw_list;
+        window->DC = dc;
+        UnpremultiplyAlpha(image);
+      }
+    }
+
+    inline void SetBakedTextureHandlers(BakedTextureCreate create, BakedTextureDestroy destroy)
+    {
+      detail::GetBakedState().create = create;
+      detail::GetBakedState().destroy = destroy;
+    }
+
+    // Drops the sheet of one baked spinner (label is resolved in the current ID stack); it is rebaked on next use.
+    inline void InvalidateBakedSpinner(const char *label)
+    {
+      auto &sheets = detail::GetBakedState().sheets;
+      auto it = sheets.find(ImGui::GetCurrentWindow()->GetID(label));
+      if (it == sheets.end())
+        return;
+
+      detail::ReleaseBakedSheet(it->second);
+      sheets.erase(it);
+    }
+
+    // Drops every sheet, e.g. before the renderer goes away or after a style / DPI change.
+    inline void InvalidateBakedSpinners()
+    {
+      auto &sheets = detail::GetBakedState().sheets;
+      for (auto &it : sheets)
+        detail::ReleaseBakedSheet(it.second);
+      sheets.clear();
+    }
+
+    // Draws a baked copy of draw(label), e.g.
+    //   SpinnerBaked("ang", 16.f, PI_2 / 2.8f, 32, [] (const char *l) { SpinnerAng(l, 16.f, 2.f); });
+    // radius must match the radius the spinner lays itself out with, period is the length of its animation
+    // cycle in seconds. params identifies the parameter set: any change (e.g. ImHashData of the arguments)
+    // rebakes the sheet, as does a change of radius, period or frames.
+    template<typename F>
+    inline void SpinnerBaked(const char *label, float radius, float period, int frames, const F &draw, ImGuiID params = 0)
+    {
+      detail::BakedState &state = detail::GetBakedState();
+      if (!state.create || frames <= 0 || period <= 0.f) {
+        draw(label);
+        return;
+      }
+
+      ImGuiWindow *window = ImGui::GetCurrentWindow();
+      if (window->SkipItems)
+        return;
+
+      const ImGuiIO &io = ImGui::GetIO();
+      const ImVec2 scale(io.DisplayFramebufferScale.x > 0.f ? io.DisplayFramebufferScale.x : 1.f,
+                         io.DisplayFramebufferScale.y > 0.f ? io.DisplayFramebufferScale.y : 1.f);
+
+      detail::BakedSheet &sheet = state.sheets[window->GetID(label)];
+      if (sheet.tex == (ImTextureID)0 || sheet.params != params || sheet.frames != frames || sheet.radius != radius || sheet.period != period) {
+        detail::ReleaseBakedSheet(sheet);
+
+        const ImVec2 cell_size(radius * 2, (radius + ImGui::GetStyle().FramePadding.y) * 2);
+        sheet.cols = (int)ImCeil(ImSqrt((float)frames));
+        sheet.rows = (frames + sheet.cols - 1) / sheet.cols;
+
+        RasterImage image;
+        detail::BakeSheet(image, label, cell_size, scale, sheet.cols, frames, period, draw);
+        sheet.tex = state.create(image.pixels.data(), image.width, image.height);
+        sheet.params = params;
+        sheet.frames = frames;
+        sheet.radius = radius;
+        sheet.period = period;
+      }
+
+      ImVec2 pos, size, centre; int num_segments;
+      if (!detail::SpinnerBegin(label, radius, pos, size, centre, num_segments))
+        return;
+
+      const int frame = ImClamp((int)(detail::AnimTime(1.f / period, 1.f) * frames), 0, frames - 1);
+      const ImVec2 uv0((float)(frame % sheet.cols) / sheet.cols, (float)(frame / sheet.cols) / sheet.rows);
+      const ImVec2 uv1(uv0.x + 1.f / sheet.cols, uv0.y + 1.f / sheet.rows);
+      window->DrawList->AddImage(sheet.tex, pos, ImVec2(pos.x + size.x, pos.y + size.y), uv0, uv1);
+      detail::RequestRedraw(detail::NextStepTime(1.f / period, 1.f, (float)frames));
+    }
+}
+
+#endif // _IMSPINNER_BAKED_H_
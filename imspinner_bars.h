@@ -27,7 +27,7 @@ namespace ImSpinner
       const float nextItemKoeff = 1.5f;
       const float yOffsetKoeftt = 0.8f;
       const float heightSpeed = 0.8f;
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed, PI_2 / heightSpeed);  // the bars read start only through ImSin(a * heightSpeed)
 
       const float offset = IM_PI / bars;
       for (size_t i = 0; i < bars; i++)
@@ -44,7 +44,7 @@ namespace ImSpinner
       float radius = rmax;
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
       float astart = ImFmod(start, IM_PI / bars);
       start -= astart;
       const float bg_angle_offset = IM_PI / bars;
@@ -67,7 +67,7 @@ namespace ImSpinner
       const float nextItemKoeff = 1.5f;
       const float yOffsetKoeftt = 0.8f;
       const float heightSpeed = 0.8f;
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed, PI_2 / heightSpeed);
       const float offset = IM_PI / bars;
 
       for (size_t i = 0; i < bars; i++)
@@ -92,7 +92,7 @@ namespace ImSpinner
       const float yOffsetKoeftt = 0.8f;
       const float heightSpeed = 0.8f;
 
-      const float start = (float)ImGui::GetTime() * speed;
+      const float start = detail::AnimTime(speed);
       const float offset = IM_PI / bars;
       for (int i = 0; i < bars; i++)
       {
@@ -114,7 +114,7 @@ namespace ImSpinner
         SPINNER_HEADER(pos, size, centre, num_segments);
 
         const float nextItemKoeff = 1.5f;
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const int bars = radius * 2 / thickness;
         const float offset = PI_DIV_2 / bars;
         for (int i = 0; i < bars; i++)
@@ -132,7 +132,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const int bars = radius * 2 / thickness;
         const float offset = PI_DIV_2 / bars;
         for (int i = 0; i < bars; i++)
@@ -153,8 +153,8 @@ namespace ImSpinner
       const float nextItemKoeff = 1.5f;
       const float yOffsetKoeftt = 0.8f;
 
-      const float start = (float)ImGui::GetTime() * speed;
-      const float hspeed = 0.1f + ImSin((float)ImGui::GetTime() * 0.1f) * 0.05f;
+      const float start = detail::AnimTime(speed);
+      const float hspeed = 0.1f + ImSin(detail::AnimTime(0.1f)) * 0.05f;
       constexpr float rkoeff[6] = {4.f, 13.f, 3.4f, 8.7f, 25.f, 11.f};
       float out_h, out_s, out_v;
       ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
@@ -173,19 +173,20 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
 
       const ImGuiStyle &style = GImGui->Style;
-      const float hspeed = 0.1f + ImSin((float)ImGui::GetTime() * 0.1f) * 0.05f;
+      const float hspeed = 0.1f + ImSin(detail::AnimTime(0.1f)) * 0.05f;
       constexpr float rkoeff[6][3] = {{0.15f, 0.1f, 0.1f}, {0.033f, 0.15f, 0.8f}, {0.017f, 0.25f, 0.6f}, {0.037f, 0.1f, 0.4f}, {0.25f, 0.1f, 0.3f}, {0.11f, 0.1f, 0.2f}};
       const float j_k = radius * 2.f / num_segments;
+      detail::RectBatch rects(window->DrawList);
       float out_h, out_s, out_v;
       ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
       for (int i = 0; i < bars; i++)
       {
         ImColor c = color_alpha(ImColor::HSV(out_h - i * 0.1f, out_s, out_v), rkoeff[i % 6][1]);
         for (int j = 0; j < num_segments; ++j) {
-          float h = (0.6f + 0.3f * ImSin((float)ImGui::GetTime() * (speed * rkoeff[i % 6][2] * 2.f) + (2.f * rkoeff[i % 6][0] * j * j_k))) * (radius * 2.f * rkoeff[i % 6][2]);
-          window->DrawList->AddRectFilled(ImVec2(pos.x + style.FramePadding.x + j * j_k, centre.y + size.y / 2.f),
-                                          ImVec2(pos.x + style.FramePadding.x + (j + 1) * (j_k), centre.y + size.y / 2.f - h),
-                                          c);
+          float h = (0.6f + 0.3f * ImSin(detail::AnimTime(speed * rkoeff[i % 6][2] * 2.f) + (2.f * rkoeff[i % 6][0] * j * j_k))) * (radius * 2.f * rkoeff[i % 6][2]);
+          rects.Add(ImVec2(pos.x + style.FramePadding.x + j * j_k, centre.y + size.y / 2.f),
+                    ImVec2(pos.x + style.FramePadding.x + (j + 1) * (j_k), centre.y + size.y / 2.f - h),
+                    c);
         }
       }
     }
@@ -193,19 +194,20 @@ namespace ImSpinner
     inline void SpinnerFluidPoints(const char *label, float radius, float thickness, const ImColor &color, float speed, size_t dots = 6, float delta = 0.35f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const ImGuiStyle &style = GImGui->Style;
         const float rkoeff[3] = {0.033f, 0.3f, 0.8f};
-        const float hspeed = 0.1f + ImSin((float)ImGui::GetTime() * 0.1f) * 0.05f;
+        const float hspeed = 0.1f + ImSin(detail::AnimTime(0.1f)) * 0.05f;
         const float j_k = radius * 2.f / num_segments;
 
         float out_h, out_s, out_v;
         ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
         for (int j = 0; j < num_segments; ++j) {
-            float h = (0.6f + delta * ImSin((float)ImGui::GetTime() * (speed * rkoeff[2] * 2.f) + (2.f * rkoeff[0] * j * j_k))) * (radius * 2.f * rkoeff[2]);
+            float h = (0.6f + delta * ImSin(detail::AnimTime(speed * rkoeff[2] * 2.f) + (2.f * rkoeff[0] * j * j_k))) * (radius * 2.f * rkoeff[2]);
             for (int i = 0; i < dots; i++) {
                 ImColor c = color_alpha(ImColor::HSV(out_h - i * 0.1f, out_s, out_v), 1.f);
-                window->DrawList->AddCircleFilled(ImVec2(pos.x + style.FramePadding.x + j * j_k, centre.y + size.y / 2.f - (h / dots) * i), thickness, c);
+                discs.Add(ImVec2(pos.x + style.FramePadding.x + j * j_k, centre.y + size.y / 2.f - (h / dots) * i), thickness, c);
             }
         }
     }
@@ -231,9 +233,9 @@ namespace ImSpinner
       return t;
     }
 
-    inline void bars_draw_v(ImDrawList *dl, float cx, float top, float bot, float hw, const ImColor &c)
+    inline void bars_draw_v(detail::RectBatch &rects, float cx, float top, float bot, float hw, const ImColor &c)
     {
-      dl->AddRectFilled(ImVec2(cx - hw, top), ImVec2(cx + hw, bot), c);
+      rects.Add(ImVec2(cx - hw, top), ImVec2(cx + hw, bot), c);
     }
 
     inline void bars_draw_capsule_v(ImDrawList *dl, float cx, float yc, float hh, float hw, const ImColor &c)
@@ -241,7 +243,7 @@ namespace ImSpinner
       dl->AddRectFilled(ImVec2(cx - hw, yc - hh), ImVec2(cx + hw, yc + hh), c, hw);
     }
 
-    inline void bars_draw_box(ImDrawList *dl, float left, float top, float W, float H,
+    inline void bars_draw_box(detail::RectBatch &rects, float left, float top, float W, float H,
                               float ax, float ay, float wf, float hf, const ImColor &c)
     {
       const float bw = wf * W, bh = hf * H;
@@ -253,16 +255,16 @@ namespace ImSpinner
       if (ay <= 0.f)      { y0 = top; y1 = top + bh; }
       else if (ay >= 1.f) { y1 = top + H; y0 = y1 - bh; }
       else                { y0 = top + (H - bh) * 0.5f; y1 = y0 + bh; }
-      dl->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), c);
+      rects.Add(ImVec2(x0, y0), ImVec2(x1, y1), c);
     }
 
     inline void bars_draw_six_cols(float left, float W, float top, float H, float hf,
-                                   const ImColor &c, ImDrawList *dl)
+                                   const ImColor &c, detail::RectBatch &rects)
     {
       static const float ax[] = { 0.f, 0.f, 0.5f, 0.5f, 1.f, 1.f };
       static const float ay[] = { 0.f, 1.f, 0.f, 1.f, 0.f, 1.f };
       for (int i = 0; i < 6; i++)
-        bars_draw_box(dl, left, top, W, H, ax[i], ay[i], 0.2f, hf, c);
+        bars_draw_box(rects, left, top, W, H, ax[i], ay[i], 0.2f, hf, c);
     }
 
     inline void bars_draw_conic_tile(ImDrawList *dl, float ox, float oy, float s, const ImColor &c, int segs)
@@ -273,12 +275,12 @@ namespace ImSpinner
       dl->PathFillConvex(c);
     }
 
-    inline void bars_draw_row_stripes(ImDrawList *dl, float left, float y, float W, float rh, float px,
+    inline void bars_draw_row_stripes(detail::RectBatch &rects, float left, float y, float W, float rh, float px,
                                       float period, float bw, const ImColor &c)
     {
       for (float x = left + px - period * 3.f; x < left + W + period; x += period) {
         if (x + bw <= left || x >= left + W) continue;
-        dl->AddRectFilled(ImVec2(ImMax(x, left), y), ImVec2(ImMin(x + bw, left + W), y + rh), c);
+        rects.Add(ImVec2(ImMax(x, left), y), ImVec2(ImMin(x + bw, left + W), y + rh), c);
       }
     }
 
@@ -295,12 +297,12 @@ namespace ImSpinner
 
     inline float bars_rows4_rh(float H) { return H * 0.25f; }
 
-    inline void bars_draw_rows4_h(ImDrawList *dl, float left, float top, float W, float H,
+    inline void bars_draw_rows4_h(detail::RectBatch &rects, float left, float top, float W, float H,
                                   float period, float bw, float t, const ImColor &c)
     {
       const float rh = bars_rows4_rh(H);
       for (int r = 0; r < 4; r++)
-        bars_draw_row_stripes(dl, left, top + (float)r * rh, W, rh,
+        bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                               bars_row_px_cascade(r, t, W), period, bw, c);
     }
 
@@ -318,12 +320,13 @@ namespace ImSpinner
     inline void bars_draw_grid3(ImDrawList *dl, ImVec2 centre, float cell, float dot_r,
                                const ImColor &c, const uint16_t vis, const float *spread)
     {
+      detail::DiscBatch discs(dl);
       for (int gy = -1; gy <= 1; gy++)
         for (int gx = -1; gx <= 1; gx++) {
           const int i = (gy + 1) * 3 + (gx + 1);
           if (!(vis & (1 << i))) continue;
           const float sr = dot_r + (spread ? spread[i] : 0.f);
-          dl->AddCircleFilled(ImVec2(centre.x + gx * cell, centre.y + gy * cell), sr, c, 8);
+          discs.Add(ImVec2(centre.x + gx * cell, centre.y + gy * cell), sr, c, 8);
         }
     }
 
@@ -332,15 +335,16 @@ namespace ImSpinner
     inline void SpinnerBarsSeqPulse(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       const ImColor c = color_alpha(color, 1.f);
       if (mode == 1) {
         const float hh = (0.55f + 0.45f * ImSin(t * IM_PI * 2.f)) * halfH;
         for (int i = 0; i < 3; i++)
-          bars_draw_v(window->DrawList, cx[i], centre.y - hh, centre.y + hh, hw, c);
+          bars_draw_v(rects, cx[i], centre.y - hh, centre.y + hh, hw, c);
       } else {
         static const float kt[] = { 0.f, 0.33f, 0.5f, 0.66f, 1.f };
         static const float h0[] = { 1.f, 0.1f, 1.f, 1.f, 1.f };
@@ -349,7 +353,7 @@ namespace ImSpinner
         const float hs[] = { bars_kf_eval(kt, h0, 5, t), bars_kf_eval(kt, h1, 5, t), bars_kf_eval(kt, h2, 5, t) };
         for (int i = 0; i < 3; i++) {
           const float hh = hs[i] * halfH;
-          bars_draw_v(window->DrawList, cx[i], centre.y - hh, centre.y + hh, hw, c);
+          bars_draw_v(rects, cx[i], centre.y - hh, centre.y + hh, hw, c);
         }
       }
     }
@@ -359,10 +363,11 @@ namespace ImSpinner
     inline void SpinnerBarsCascadeGrow(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
       static const float h0[] = { 1.f, 0.6f, 0.8f, 1.f, 1.f, 1.f };
       static const float h1[] = { 1.f, 1.f, 0.6f, 0.8f, 1.f, 1.f };
@@ -372,8 +377,8 @@ namespace ImSpinner
       const ImColor c = color_alpha(color, 1.f);
       for (int i = 0; i < 3; i++) {
         const float hh = hs[i] * H;
-        if (mode == 1) bars_draw_v(window->DrawList, cx[i], yt, yt + hh, hw, c);
-        else            bars_draw_v(window->DrawList, cx[i], yb - hh, yb, hw, c);
+        if (mode == 1) bars_draw_v(rects, cx[i], yt, yt + hh, hw, c);
+        else            bars_draw_v(rects, cx[i], yb - hh, yb, hw, c);
       }
     }
 
@@ -382,16 +387,17 @@ namespace ImSpinner
     inline void SpinnerBarsRise(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
       const float barH = H / 3.f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       const ImColor c = color_alpha(color, 1.f);
       for (int i = 0; i < 3; i++) {
         const float ph = ImFmod(t + (float)((mode == 1) ? (3 - i) : (i + 1)) / 6.f, 1.f);
         const float yC = centre.y + halfH - barH * 0.5f - ph * (H - barH);
-        bars_draw_v(window->DrawList, cx[i], yC - barH * 0.5f, yC + barH * 0.5f, hw, c);
+        bars_draw_v(rects, cx[i], yC - barH * 0.5f, yC + barH * 0.5f, hw, c);
       }
     }
 
@@ -400,10 +406,11 @@ namespace ImSpinner
     inline void SpinnerBarsCornerHop(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.33f, 0.5f, 0.66f, 1.f };
       static const float a0[] = { 1.f, 0.5f, 0.f, 0.f, 0.f };
       static const float a1[] = { 1.f, 1.f, 0.5f, 0.f, 0.f };
@@ -413,8 +420,8 @@ namespace ImSpinner
       for (int i = 0; i < 3; i++) {
         const float *av = (i == 0) ? a0 : (i == 1) ? a1 : a2;
         const float ay = bars_kf_eval(kt, av, 5, t);
-        if (mode == 1) bars_draw_v(window->DrawList, cx[i], yt, yt + (1.f - ay) * H, hw, c);
-        else           bars_draw_v(window->DrawList, cx[i], yt + ay * H, yb, hw, c);
+        if (mode == 1) bars_draw_v(rects, cx[i], yt, yt + (1.f - ay) * H, hw, c);
+        else           bars_draw_v(rects, cx[i], yt + ay * H, yb, hw, c);
       }
     }
 
@@ -423,10 +430,11 @@ namespace ImSpinner
     inline void SpinnerBarsDiagonalGrow(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W / 0.75f, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
       static const float axm[] = { 0.f, 0.f, 0.5f, 1.f, 0.5f, 0.f };
       static const float ay0[] = { 1.f, 0.5f, 0.f, 1.f, 1.f, 1.f };
@@ -440,7 +448,7 @@ namespace ImSpinner
         const float ay = bars_kf_eval(kt, ayv, 6, t);
         const float axp = (mode == 1) ? bars_kf_eval(kt, axm, 6, t) : 0.f;
         const float x = cx[i] + (axp - 0.5f) * 0.8f * W;
-        bars_draw_v(window->DrawList, x, yt + ay * (H - bh), yt + ay * (H - bh) + bh, hw, c);
+        bars_draw_v(rects, x, yt + ay * (H - bh), yt + ay * (H - bh) + bh, hw, c);
       }
     }
 
@@ -449,10 +457,11 @@ namespace ImSpinner
     inline void SpinnerBarsBounceCenter(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W / 0.75f, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
       static const float ay0[] = { 0.5f, 0.f, 1.f, 0.5f, 0.5f, 0.5f };
       static const float ay1[] = { 0.5f, 0.5f, 0.f, 1.f, 0.5f, 0.5f };
@@ -464,7 +473,7 @@ namespace ImSpinner
         const float ay = bars_kf_eval(kt, ayv, 6, t);
         const float yC = centre.y - halfH + ay * H;
         const float hwv = (mode == 1) ? hw * (0.35f + 0.65f * ay) : hw;
-        bars_draw_v(window->DrawList, cx[i], yC - bh * 0.5f, yC + bh * 0.5f, hwv, c);
+        bars_draw_v(rects, cx[i], yC - bh * 0.5f, yC + bh * 0.5f, hwv, c);
       }
     }
 
@@ -473,10 +482,11 @@ namespace ImSpinner
     inline void SpinnerBarsScaleAlt(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W / 0.75f, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
       static const float h0[] = { 0.5f, 0.2f, 0.5f, 1.f, 0.5f, 0.5f };
@@ -486,12 +496,12 @@ namespace ImSpinner
       if (mode == 1) {
         const float h = bars_kf_eval(kt, h0, 6, t) * halfH;
         for (int i = 0; i < 3; i++)
-          bars_draw_v(window->DrawList, cx[i], centre.y - h, centre.y + h, hw, c);
+          bars_draw_v(rects, cx[i], centre.y - h, centre.y + h, hw, c);
       } else {
         const float hs[] = { bars_kf_eval(kt, h0, 6, t), bars_kf_eval(kt, h1, 6, t), bars_kf_eval(kt, h2, 6, t) };
         for (int i = 0; i < 3; i++) {
           const float h = hs[i] * halfH;
-          bars_draw_v(window->DrawList, cx[i], centre.y - h, centre.y + h, hw, c);
+          bars_draw_v(rects, cx[i], centre.y - h, centre.y + h, hw, c);
         }
       }
     }
@@ -501,10 +511,11 @@ namespace ImSpinner
     inline void SpinnerBarsCornerWave(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W / 0.75f, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.1667f, 0.3333f, 0.5f, 0.6667f, 0.8333f, 1.f };
       static const float ay0[] = { 1.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
       static const float ay1[] = { 1.f, 1.f, 0.f, 0.f, 0.f, 1.f, 1.f };
@@ -514,7 +525,7 @@ namespace ImSpinner
       for (int i = 0; i < 3; i++) {
         const float *ayv = (mode == 1) ? ay2 : ((i == 0) ? ay0 : (i == 1) ? ay1 : ay2);
         const float ay = bars_kf_eval(kt, ayv, 7, t);
-        bars_draw_v(window->DrawList, cx[i], yt + ay * (H - bh), yt + ay * (H - bh) + bh, hw, c);
+        bars_draw_v(rects, cx[i], yt + ay * (H - bh), yt + ay * (H - bh) + bh, hw, c);
       }
     }
 
@@ -523,10 +534,11 @@ namespace ImSpinner
     inline void SpinnerBarsJump(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W / 0.75f, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.33f, 0.66f, 1.f };
       static const float ay0[] = { 0.f, 1.f, 0.f, 0.f };
       static const float ay1[] = { 1.f, 0.f, 1.f, 1.f };
@@ -538,7 +550,7 @@ namespace ImSpinner
         const float *ayv = (mode == 1) ? ayM : ((i == 0) ? ay0 : (i == 1) ? ay1 : ay2);
         const float ay = bars_kf_eval(kt, ayv, 4, t);
         const float yC = centre.y - halfH + ay * (H - bh) + bh * 0.5f;
-        bars_draw_v(window->DrawList, cx[i], yC - bh * 0.5f, yC + bh * 0.5f, hw, c);
+        bars_draw_v(rects, cx[i], yC - bh * 0.5f, yC + bh * 0.5f, hw, c);
       }
     }
 
@@ -550,12 +562,13 @@ namespace ImSpinner
 
       const float W = radius * 2.f, H = W / 1.2f, halfH = H * 0.5f;
       const float segW = W / 6.f, bh = halfH;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.33f, 0.66f, 1.f };
       static const float px0[] = { 0.5f, 0.f, 1.f, 0.5f };
       static const float px1[] = { 0.5f, 1.f, 0.f, 0.5f };
       const ImColor c = color_alpha(color, 1.f);
       const float left = centre.x - W * 0.5f;
+      detail::RectBatch rects(window->DrawList);
       for (int row = 0; row < 2; row++) {
         const float y0 = centre.y - halfH + row * bh;
         const float y1 = y0 + bh;
@@ -563,9 +576,9 @@ namespace ImSpinner
         const float *pxv = (row == 0) ? px0 : px1;
         const float px = bars_kf_eval(kt, pxv, 4, tr);
         const float x0 = left + px * (W - segW);
-        window->DrawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x0 + segW, y1), c);
-        window->DrawList->AddRectFilled(ImVec2(x0 + segW * 2.f, y0), ImVec2(x0 + segW * 3.f, y1), c);
-        window->DrawList->AddRectFilled(ImVec2(x0 + segW * 4.f, y0), ImVec2(x0 + segW * 5.f, y1), c);
+        rects.Add(ImVec2(x0, y0), ImVec2(x0 + segW, y1), c);
+        rects.Add(ImVec2(x0 + segW * 2.f, y0), ImVec2(x0 + segW * 3.f, y1), c);
+        rects.Add(ImVec2(x0 + segW * 4.f, y0), ImVec2(x0 + segW * 5.f, y1), c);
       }
     }
 
@@ -574,9 +587,10 @@ namespace ImSpinner
     inline void SpinnerBarsSixPulse(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.8f, 0.9f, 1.f };
       static const float hf[] = { 0.5f, 0.3f, 0.5f, 0.5f };
       const ImColor c = color_alpha(color, 1.f);
@@ -587,11 +601,11 @@ namespace ImSpinner
         for (int i = 0; i < 6; i++) {
           const float ti = ImFmod(t + (float)i / 6.f, 1.f);
           const float h = bars_kf_eval(kt, hf, 4, ti);
-          bars_draw_box(window->DrawList, left, top, W, H, ax[i], ay[i], 0.2f, h, c);
+          bars_draw_box(rects, left, top, W, H, ax[i], ay[i], 0.2f, h, c);
         }
       } else {
         const float h = bars_kf_eval(kt, hf, 4, t);
-        bars_draw_six_cols(left, W, top, H, h, c, window->DrawList);
+        bars_draw_six_cols(left, W, top, H, h, c, rects);
       }
     }
 
@@ -600,9 +614,10 @@ namespace ImSpinner
     inline void SpinnerBarsSixStagger(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.1667f, 0.3333f, 0.5f, 0.6667f, 0.8333f, 1.f };
       static const float h0[] = { 0.5f, 0.3f, 0.3f, 0.3f, 0.5f, 0.5f, 0.5f };
       static const float h1[] = { 0.5f, 0.3f, 0.3f, 0.3f, 0.5f, 0.5f, 0.5f };
@@ -617,7 +632,7 @@ namespace ImSpinner
       const float left = centre.x - radius, top = centre.y - radius;
       for (int i = 0; i < 6; i++) {
         const int si = (mode == 1) ? (5 - i) : i;
-        bars_draw_box(window->DrawList, left, top, W, H, ax[i], ay[i], 0.2f,
+        bars_draw_box(rects, left, top, W, H, ax[i], ay[i], 0.2f,
                       bars_kf_eval(kt, hs[si], 7, t), c);
       }
     }
@@ -627,9 +642,10 @@ namespace ImSpinner
     inline void SpinnerBarsMorphPlus(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
       static const float wf[] = { 0.2f, 0.2f, 0.2f, 1.f, 1.f };
@@ -641,7 +657,7 @@ namespace ImSpinner
       for (int i = 0; i < 5; i++) {
         const float ti = (mode == 1) ? ImFmod(t + (float)i * 0.15f, 1.f) : t;
         const float w = bars_kf_eval(kt, wf, 5, ti), h = bars_kf_eval(kt, hf, 5, ti);
-        bars_draw_box(window->DrawList, left, top, W, H, ax[i], ay[i], w, h, c);
+        bars_draw_box(rects, left, top, W, H, ax[i], ay[i], w, h, c);
       }
     }
 
@@ -650,9 +666,10 @@ namespace ImSpinner
     inline void SpinnerBarsFlipSix(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       const float ph = ImFmod(time * 2.f, 2.f);
       const float ts = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float ks[] = { 0.f, 0.1f, 1.f };
@@ -666,7 +683,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(color, 1.f);
       const float left = centre.x - radius, top = centre.y - radius;
       for (int i = 0; i < 6; i++)
-        bars_draw_box(window->DrawList, left, top, W, H,
+        bars_draw_box(rects, left, top, W, H,
                       flip ? ax1[i] : ax0[i], flip ? ay1[i] : ay0[i], 0.2f, hf, c);
     }
 
@@ -675,9 +692,10 @@ namespace ImSpinner
     inline void SpinnerBarsSwapTriBottom(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float ks[] = { 0.f, 0.33f, 0.66f, 1.f };
       static const float hs[] = { 1.f, 0.4f, 0.4f, 1.f };
       const float hf = bars_kf_eval(ks, hs, 4, t);
@@ -689,9 +707,9 @@ namespace ImSpinner
       const float left = centre.x - radius, top = centre.y - radius;
       for (int i = 0; i < 3; i++) {
         if (mode == 1)
-          bars_draw_box(window->DrawList, left, top, W, H, axt[i], ayt[i], 0.2f, hf, c);
+          bars_draw_box(rects, left, top, W, H, axt[i], ayt[i], 0.2f, hf, c);
         else
-          bars_draw_box(window->DrawList, left, top, W, H,
+          bars_draw_box(rects, left, top, W, H,
                         phase2 ? ax1[i] : ax0[i], phase2 ? ay1[i] : ay0[i], 0.2f, hf, c);
       }
     }
@@ -701,9 +719,10 @@ namespace ImSpinner
     inline void SpinnerBarsSwapTriZigzag(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float ks[] = { 0.f, 0.33f, 0.66f, 1.f };
       static const float hs[] = { 1.f, 0.4f, 0.4f, 1.f };
       const float hf = bars_kf_eval(ks, hs, 4, t);
@@ -715,9 +734,9 @@ namespace ImSpinner
       const float left = centre.x - radius, top = centre.y - radius;
       for (int i = 0; i < 3; i++) {
         if (mode == 1)
-          bars_draw_box(window->DrawList, left, top, W, H, axt[i], ayt[i], 0.2f, hf, c);
+          bars_draw_box(rects, left, top, W, H, axt[i], ayt[i], 0.2f, hf, c);
         else
-          bars_draw_box(window->DrawList, left, top, W, H,
+          bars_draw_box(rects, left, top, W, H,
                         phase2 ? ax1[i] : ax0[i], phase2 ? ay1[i] : ay0[i], 0.2f, hf, c);
       }
     }
@@ -727,9 +746,10 @@ namespace ImSpinner
     inline void SpinnerBarsMorphDiagonal(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
       static const float wf[] = { 0.2f, 0.2f, 0.2f, 1.f, 1.f };
@@ -741,7 +761,7 @@ namespace ImSpinner
       for (int i = 0; i < 3; i++) {
         const float ti = (mode == 1) ? ImFmod(t + (float)i / 3.f, 1.f) : t;
         const float w = bars_kf_eval(kt, wf, 5, ti), h = bars_kf_eval(kt, hf, 5, ti);
-        bars_draw_box(window->DrawList, left, top, W, H, ax[i], ay[i], w, h, c);
+        bars_draw_box(rects, left, top, W, H, ax[i], ay[i], w, h, c);
       }
     }
 
@@ -750,9 +770,10 @@ namespace ImSpinner
     inline void SpinnerBarsSlideDiagonal(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float ks[] = { 0.f, 0.33f, 0.66f, 1.f };
       static const float hs[] = { 1.f, 0.2f, 0.2f, 1.f };
       const float hf = bars_kf_eval(ks, hs, 4, t);
@@ -762,7 +783,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(color, 1.f);
       const float left = centre.x - radius, top = centre.y - radius;
       for (int i = 0; i < 3; i++)
-        bars_draw_box(window->DrawList, left, top, W, H,
+        bars_draw_box(rects, left, top, W, H,
                       phase2 ? ax1[i] : ax0[i], phase2 ? ay1[i] : ay0[i], 0.2f, hf, c);
     }
 
@@ -773,7 +794,7 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
       (void)thickness;
       const float W = radius * 2.f, H = W, s = 0.4f * W;
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
       static const float px[] = { 0.f, 0.f, W / 3.f, W / 3.f, 0.f };
@@ -797,7 +818,7 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
       (void)thickness;
       const float W = radius * 2.f, H = W, s = 0.4f * W, third = H / 3.f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.2f, 0.33f, 0.66f, 0.8f, 1.f };
       static const float x0[] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
       static const float y0[] = { 0.f, 0.f, third, third, third, third };
@@ -821,19 +842,20 @@ namespace ImSpinner
     inline void SpinnerBarsMarchIn(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
       const float period = W * 0.4f, bw = W * 0.2f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 1.5f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.5f) / 1.5f, mode);
       const ImColor c = color_alpha(color, 1.f);
       const float left = centre.x - radius, top = centre.y - radius;
       const float rh = bars_rows4_rh(H);
       if (mode == 1) {
         const float px = bars_row_px_cascade(0, t, W);
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh, px, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh, px, period, bw, c);
       } else {
-        bars_draw_rows4_h(window->DrawList, left, top, W, H, period, bw, t, c);
+        bars_draw_rows4_h(rects, left, top, W, H, period, bw, t, c);
       }
     }
 
@@ -842,17 +864,18 @@ namespace ImSpinner
     inline void SpinnerBarsMarchDown(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
       const float rh = bars_rows4_rh(H);
       const float period = W * 0.4f, bw = W * 0.2f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 1.5f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.5f) / 1.5f, mode);
       const ImColor c = color_alpha(color, 1.f);
       const float left = centre.x - radius, top = centre.y - radius;
       for (int r = 0; r < 4; r++) {
         const float py = (mode == 1) ? -bars_row_py_cascade(r, t, H) : bars_row_py_cascade(r, t, H);
         const float y = top + (float)r * rh + py;
-        bars_draw_row_stripes(window->DrawList, left, y, W, rh, 0.f, period, bw, c);
+        bars_draw_row_stripes(rects, left, y, W, rh, 0.f, period, bw, c);
       }
     }
 
@@ -861,11 +884,12 @@ namespace ImSpinner
     inline void SpinnerBarsWaveSkew(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float H = radius * 2.f, W = H * 1.6f;
       const float rh = bars_rows4_rh(H);
       const float period = W * 0.625f * 0.4f, bw = W * 0.625f * 0.2f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.1f, 0.33f, 0.66f, 0.9f, 1.f };
       static const float px0[] = { 0.5f, 0.5f, 1.f, 0.f, 0.5f, 0.5f };
       static const float px1[] = { 0.5f, 0.5f, 1.f - 9.f / 45.f, 9.f / 45.f, 0.5f, 0.5f };
@@ -877,11 +901,11 @@ namespace ImSpinner
       if (mode == 1) {
         const float px = (bars_kf_eval(kt, px1, 6, t) - 0.5f) * W;
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh, px, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh, px, period, bw, c);
       } else {
         for (int r = 0; r < 4; r++) {
           const float px = (bars_kf_eval(kt, pxv[r], 6, t) - 0.5f) * W;
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh, px, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh, px, period, bw, c);
         }
       }
     }
@@ -891,11 +915,12 @@ namespace ImSpinner
     inline void SpinnerBarsRowDrop(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W / 0.8f;
       const float rh = bars_rows4_rh(H);
       const float period = W * 0.4f, bw = W * 0.2f;
-      const float ph = ImFmod((float)ImGui::GetTime() * speed / 0.75f, 2.f);
+      const float ph = detail::AnimTime(speed, 1.5f) / 0.75f;
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.1f, 0.25f, 0.5f, 0.75f, 0.9f, 1.f };
       static const float py0[] = { 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f };
@@ -908,11 +933,11 @@ namespace ImSpinner
       if (mode == 1) {
         const float band = bars_kf_eval(kt, py0, 7, t) * rh;
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh - band, W, rh, 0.f, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh - band, W, rh, 0.f, period, bw, c);
       } else {
         for (int r = 0; r < 4; r++) {
           const float band = bars_kf_eval(kt, pyv[r], 7, t) * rh;
-          bars_draw_row_stripes(window->DrawList, left, top + band, W, rh, 0.f, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + band, W, rh, 0.f, period, bw, c);
         }
       }
     }
@@ -922,11 +947,12 @@ namespace ImSpinner
     inline void SpinnerBarsZigzagRows(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
       const float rh = bars_rows4_rh(H);
       const float period = W * 1.4f * (2.f / 7.f), bw = W * 1.4f / 7.f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 0.75f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 0.75f) / 0.75f, mode);
       static const float kt[] = { 0.f, 0.25f, 0.5f, 0.75f, 1.f };
       static const float px0[] = { 0.f, 1.f, 1.f, 1.f, 1.f };
       static const float px1[] = { 1.f, 1.f, 0.f, 0.f, 0.f };
@@ -938,11 +964,11 @@ namespace ImSpinner
       if (mode == 1) {
         const float align = bars_kf_eval(kt, px0, 5, t);
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 align * (W - bw), period, bw, c);
       } else {
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 bars_kf_eval(kt, pxv[r], 5, t) * (W - bw), period, bw, c);
       }
     }
@@ -952,11 +978,12 @@ namespace ImSpinner
     inline void SpinnerBarsFillCascade(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
       const float rh = bars_rows4_rh(H);
       const float period = W * 1.4f * (2.f / 7.f), bw = W * 1.4f / 7.f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 0.75f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 0.75f) / 0.75f, mode);
       static const float kt[] = { 0.f, 0.05f, 0.2f, 0.4f, 0.6f, 0.8f, 0.95f, 1.f };
       static const float px0[] = { 0.f, 0.f, 0.5f, 1.f, 1.f, 1.f, 1.f, 1.f };
       static const float px1[] = { 0.f, 0.f, 0.f, 0.5f, 1.f, 1.f, 1.f, 1.f };
@@ -968,11 +995,11 @@ namespace ImSpinner
       if (mode == 1) {
         const float align = bars_kf_eval(kt, px0, 8, t);
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 align * (W - bw), period, bw, c);
       } else {
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 bars_kf_eval(kt, pxv[r], 8, t) * (W - bw), period, bw, c);
       }
     }
@@ -982,11 +1009,12 @@ namespace ImSpinner
     inline void SpinnerBarsPingPongRows(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float W = radius * 2.f, H = W;
       const float rh = bars_rows4_rh(H);
       const float period = W * 1.4f * (2.f / 7.f), bw = W * 1.4f / 7.f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 0.75f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 0.75f) / 0.75f, mode);
       static const float px0[] = { 0.f, 1.f }, px1[] = { 1.f, 0.f }, px2[] = { 0.f, 1.f }, px3[] = { 1.f, 0.f };
       const float *pxv[] = { px0, px1, px2, px3 };
       static const float kt2[] = { 0.f, 1.f };
@@ -995,12 +1023,12 @@ namespace ImSpinner
       if (mode == 1) {
         const float align = bars_kf_eval(kt2, px0, 2, t);
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 align * (W - bw), period, bw, c);
       } else {
         const float u = (t < 0.2f) ? 0.f : (t > 0.8f) ? 1.f : (t - 0.2f) / 0.6f;
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh,
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh,
                                 bars_kf_eval(kt2, pxv[r], 2, u) * (W - bw), period, bw, c);
       }
     }
@@ -1010,11 +1038,12 @@ namespace ImSpinner
     inline void SpinnerBarsWaveRowsWide(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
       (void)thickness;
       const float H = radius * 2.f, W = H * 1.4f;
       const float rh = bars_rows4_rh(H);
       const float period = W * 0.72f * 0.4f, bw = W * 0.72f * 0.2f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 1.f), mode);
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
       static const float px0[] = { 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f };
       static const float px1[] = { 0.5f, 0.5f, 1.f, 0.f, 0.5f, 0.5f };
@@ -1026,11 +1055,11 @@ namespace ImSpinner
       if (mode == 1) {
         const float px = (bars_kf_eval(kt, px1, 6, t) - 0.5f) * W;
         for (int r = 0; r < 4; r++)
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh, px, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh, px, period, bw, c);
       } else {
         for (int r = 0; r < 4; r++) {
           const float px = (bars_kf_eval(kt, pxv[r], 6, t) - 0.5f) * W;
-          bars_draw_row_stripes(window->DrawList, left, top + (float)r * rh, W, rh, px, period, bw, c);
+          bars_draw_row_stripes(rects, left, top + (float)r * rh, W, rh, px, period, bw, c);
         }
       }
     }
@@ -1042,7 +1071,7 @@ namespace ImSpinner
       SPINNER_HEADER(pos, size, centre, num_segments);
       const float cell = (radius * 2.f) / 5.f;
       const float dot_r = thickness * 0.5f;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 2.f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 2.f) / 2.f, mode);
       static const uint16_t masks[] = {
         0x1FF, 0x0BF, 0x0B7, 0x077, 0x0EE, 0x1D9, 0x1B6, 0x16F, 0x1FD, 0x1FF
       };
@@ -1059,7 +1088,7 @@ namespace ImSpinner
       const float cell = (radius * 2.f) / 5.f;
       const float dot_r = thickness * 0.5f;
       const float spread_u = (2.f / 15.f) * thickness;
-      const float t = bars_anim_t(ImFmod((float)ImGui::GetTime() * speed / 2.f, 1.f), mode);
+      const float t = bars_anim_t(detail::AnimTime(speed, 2.f) / 2.f, mode);
       static const uint16_t spread_mask[] = {
         0x000, 0x124, 0x092, 0x049, 0x092, 0x124, 0x248, 0x091, 0x122, 0x000
       };
@@ -1081,7 +1110,7 @@ namespace ImSpinner
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.1f, 0.9f, 1.f };
       static const float hf[] = { 0.f, 0.f, 1.f, 1.f };
@@ -1103,7 +1132,7 @@ namespace ImSpinner
 
       const float W = radius * 2.f, H = W, halfH = H * 0.5f, hw = thickness * 0.5f;
       const float cx[] = { centre.x - 0.4f * W, centre.x, centre.x + 0.4f * W };
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
       static const float kt[] = { 0.f, 0.25f, 0.5f, 0.75f, 0.95f, 1.f };
       static const float h0[] = { 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
@@ -1126,6 +1155,7 @@ namespace ImSpinner
     inline void SpinnerBarsBounceBall(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W * 0.65f, hw = thickness * 0.5f;
       const float left = centre.x - W * 0.5f, top = centre.y - H * 0.5f;
@@ -1133,9 +1163,9 @@ namespace ImSpinner
       const float cx[] = { left + hw, centre.x, left + W - hw };
       const ImColor c = color_alpha(color, 1.f);
       for (int i = 0; i < 3; i++)
-        bars_draw_v(window->DrawList, cx[i], barTop, barBot, hw, c);
+        bars_draw_v(rects, cx[i], barTop, barBot, hw, c);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 3.f);
       const float txph = ImFmod(time / 1.5f, 2.f);
       float tx = (txph <= 1.f) ? txph : 2.f - txph;
       if (mode == 2) tx = 1.f - tx;
@@ -1146,6 +1176,7 @@ namespace ImSpinner
       const float restY = barTop - hw, topY = top + hw;
       const float byc = restY - arch * (restY - topY);
 
+      rects.Flush();
       window->DrawList->AddCircleFilled(ImVec2(bxc, byc), hw, c, num_segments);
     }
 
@@ -1164,7 +1195,7 @@ namespace ImSpinner
       const float dotY = top + rdot, dropY = top + H - rdot;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       const float txph = ImFmod(time, 2.f);
       float tx = (txph <= 1.f) ? txph : 2.f - txph;
       if (mode == 2) tx = 1.f - tx;
@@ -1194,6 +1225,7 @@ namespace ImSpinner
     inline void SpinnerBarsStaircase(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W * 0.75f, hw = thickness * 0.5f;
       const float left = centre.x - W * 0.5f, top = centre.y - H * 0.5f, bot = top + H;
@@ -1201,9 +1233,9 @@ namespace ImSpinner
       static const float hf[] = { 1.f, 2.f / 3.f, 1.f / 3.f };
       const ImColor c = color_alpha(color, 1.f);
       for (int i = 0; i < 3; i++)
-        bars_draw_v(window->DrawList, cx[i], bot - hf[i] * H, bot, hw, c);
+        bars_draw_v(rects, cx[i], bot - hf[i] * H, bot, hw, c);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float p = ImFmod(time / 2.f, 1.f);
       if (mode == 2) p = 1.f - p;
       const float bx = (left - 1.5f * thickness) + p * (W + 3.f * thickness);
@@ -1212,6 +1244,7 @@ namespace ImSpinner
       const float arch = ImAbs(ImSin(p * n * IM_PI));
       const float by = yBase - arch * 0.3f * H;
 
+      rects.Flush();
       window->DrawList->AddCircleFilled(ImVec2(bx, by), hw, c, num_segments);
     }
 
@@ -1230,7 +1263,7 @@ namespace ImSpinner
       const float dotY = top + rdot, dropY = top + H - rdot;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.5f);
       float p = ImFmod(time / 1.5f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1264,6 +1297,7 @@ namespace ImSpinner
     inline void SpinnerBarsGates(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, hw = thickness * 0.5f;
       const float left = centre.x - W * 0.5f, top = centre.y - H * 0.5f, bot = top + H;
@@ -1271,7 +1305,7 @@ namespace ImSpinner
       const float ccen[] = { 0.2f, 0.4f, 0.6f };
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.f);
       float p = ImFmod(time, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1279,8 +1313,8 @@ namespace ImSpinner
         const float d = ImAbs(p - ccen[i]);
         const float sh = (d < 0.22f) ? (1.f - d / 0.22f) : 0.f;
         const float barH = (0.5f - sh * 0.2f) * H;
-        bars_draw_v(window->DrawList, cx[i], top, top + barH, hw, c);
-        bars_draw_v(window->DrawList, cx[i], bot - barH, bot, hw, c);
+        bars_draw_v(rects, cx[i], top, top + barH, hw, c);
+        bars_draw_v(rects, cx[i], bot - barH, bot, hw, c);
       }
 
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
@@ -1288,6 +1322,7 @@ namespace ImSpinner
       const float bx = left + bars_kf_eval(kt, bxv, 6, p) * W;
       float by = centre.y;
       if (mode == 1) by += ImSin(p * 3.f * IM_PI) * 0.12f * H;
+      rects.Flush();
       window->DrawList->AddCircleFilled(ImVec2(bx, by), hw, c, num_segments);
     }
 
@@ -1298,13 +1333,14 @@ namespace ImSpinner
     inline void SpinnerBarsCapture(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, hw = thickness * 0.5f;
       const float left = centre.x - W * 0.5f, top = centre.y - H * 0.5f, bot = top + H;
       const float cx[] = { left + hw, centre.x, left + W - hw };
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float p = ImFmod(time / 2.f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1315,8 +1351,8 @@ namespace ImSpinner
       const float sh[] = { bars_kf_eval(kt0, sv0, 5, p), bars_kf_eval(kt1, sv1, 6, p), 0.f };
       for (int i = 0; i < 3; i++) {
         const float barH = (0.5f - sh[i] * 0.2f) * H;
-        bars_draw_v(window->DrawList, cx[i], top, top + barH, hw, c);
-        bars_draw_v(window->DrawList, cx[i], bot - barH, bot, hw, c);
+        bars_draw_v(rects, cx[i], top, top + barH, hw, c);
+        bars_draw_v(rects, cx[i], bot - barH, bot, hw, c);
       }
 
       static const float ktb[] = { 0.f, 0.2f, 0.4f, 1.f };
@@ -1324,6 +1360,7 @@ namespace ImSpinner
       const float bx = left + bars_kf_eval(ktb, bxv, 4, p) * W;
       float rb = hw;
       if (mode == 1 && p > 0.4f) rb = hw * (1.f + 0.4f * ImAbs(ImSin((p - 0.4f) * 5.f * IM_PI)));
+      rects.Flush();
       window->DrawList->AddCircleFilled(ImVec2(bx, centre.y), rb, c, num_segments);
     }
 
@@ -1334,13 +1371,14 @@ namespace ImSpinner
     inline void SpinnerBarsEscape(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::RectBatch rects(window->DrawList);
 
       const float W = radius * 2.f, H = W, hw = thickness * 0.5f;
       const float left = centre.x - W * 0.5f, top = centre.y - H * 0.5f, bot = top + H;
       const float cx[] = { left + hw, centre.x, left + W - hw };
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float p = ImFmod(time / 2.f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1351,8 +1389,8 @@ namespace ImSpinner
       const float sh[] = { bars_kf_eval(kt0, sv0, 5, p), bars_kf_eval(kt1, sv1, 6, p), 0.f };
       for (int i = 0; i < 3; i++) {
         const float barH = (0.5f - sh[i] * 0.2f) * H;
-        bars_draw_v(window->DrawList, cx[i], top, top + barH, hw, c);
-        bars_draw_v(window->DrawList, cx[i], bot - barH, bot, hw, c);
+        bars_draw_v(rects, cx[i], top, top + barH, hw, c);
+        bars_draw_v(rects, cx[i], bot - barH, bot, hw, c);
       }
 
       static const float ktb[] = { 0.f, 0.2f, 0.4f, 0.7f, 0.8f, 0.85f, 1.f };
@@ -1360,6 +1398,7 @@ namespace ImSpinner
       const float bx = left + bars_kf_eval(ktb, bxv, 7, p) * W;
       const float dir = (mode == 1) ? 1.f : -1.f;
       const float by = centre.y + ((p > 0.85f) ? (p - 0.85f) / 0.15f * 0.7f * H * dir : 0.f);
+      rects.Flush();
       window->DrawList->AddCircleFilled(ImVec2(bx, by), hw, c, num_segments);
     }
 
@@ -1374,7 +1413,7 @@ namespace ImSpinner
       const float W = radius * 3.2f, H = radius * 1.4f, hw = thickness * 0.5f;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 3.f);
       float p = ImFmod(time / 3.f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1420,7 +1459,7 @@ namespace ImSpinner
       const float barH = 0.5f * H + thickness;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
 
       static const float kt0[] = { 0.f, 0.1f, 0.25f, 0.5f, 1.f };
@@ -1454,7 +1493,7 @@ namespace ImSpinner
       const float barTop = centre.y - barH * 0.5f, barBot = centre.y + barH * 0.5f;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
 
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
@@ -1486,7 +1525,7 @@ namespace ImSpinner
       const float barhh = 0.15f * H, dotR = hw;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
 
       static const float kt[] = { 0.f, 0.2f, 0.4f, 0.6f, 0.8f, 1.f };
@@ -1517,7 +1556,7 @@ namespace ImSpinner
       const float barhh = 0.19f * H, dotR = hw;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
 
       static const float kt[] = { 0.f, 0.1f, 0.33f, 0.66f, 0.9f, 1.f };
@@ -1548,7 +1587,7 @@ namespace ImSpinner
       const float bh = 0.375f * H, dotR = hw;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float p = ImFmod(time / 2.f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1585,7 +1624,7 @@ namespace ImSpinner
       const float barhh = 0.15f * H, dotR = hw;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float ph = detail::AnimTime(speed, 2.f);
       const float t = bars_anim_t((ph <= 1.f) ? ph : 2.f - ph, mode);
 
       static const float kt[] = { 0.f, 0.05f, 0.1667f, 0.3333f, 0.5f, 0.6667f, 0.8333f, 0.95f, 1.f };
@@ -1632,7 +1671,7 @@ namespace ImSpinner
       const float barhh = 0.15f * H, dotR = hw;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.f);
       float p = ImFmod(time, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1667,7 +1706,7 @@ namespace ImSpinner
       const float halfLen = 0.2f * W, outDist = 0.85f * W, centerR = 0.15f * W;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 1.5f);
       float p = ImFmod(time / 1.5f, 1.f);
       if (mode == 2) p = 1.f - p;
 
@@ -1707,7 +1746,7 @@ namespace ImSpinner
       const float halfLen = 0.2f * W, centerR = 0.125f * W;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 4.f);
       const float phs = ImFmod(time / 0.5f, 2.f);
       const float ts = (phs <= 1.f) ? phs : 2.f - phs;
       static const float kt[] = { 0.f, 0.1f, 0.8f, 1.f };
@@ -1744,7 +1783,7 @@ namespace ImSpinner
       const float halfLen = 0.2f * W, centerR = 0.125f * W;
       const ImColor c = color_alpha(color, 1.f);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 4.f);
       const float p = ImFmod(time, 1.f);
 
       static const float kt[] = { 0.f, 0.1f, 0.33f, 0.66f, 0.8f, 1.f };
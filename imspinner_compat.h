@@ -4,14 +4,21 @@
 /*
  * imspinner compat layer
  *
- * Wires add-on spinners into the core Spinner<> dispatcher (spinner_draw_funcs)
- * and provides Spinner() / Spinner<Type>() entry points.
- * Included after imspinner_bars.h (or include this header directly for Spinner<>).
- * imspinner_demo.h pulls it in for Spinner<e_st_*> cases in the gallery.
+ * The spinner registry: one entry per SpinnerTypeT with its function name, the
+ * gallery category, the default parameters and a draw function that maps a
+ * SpinnerConfig onto the spinner's arguments (GetSpinnerInfo). Spinner() and
+ * Spinner<Type>() dispatch through it, so every spinner of the core header and
+ * the add-ons can be drawn from a type and a config, e.g.
+ *   ImSpinner::Spinner<e_st_fade_pulsar>("##busy", Radius{12.f}, Color{red});
+ * Fields not given keep the registry defaults. Pulls in all add-on headers.
+ * imspinner_demo.h builds its gallery on this table.
  */
 
 #ifndef _IMSPINNER_COMPAT_INTERNAL_
 #include "imspinner.h"
+#include "imspinner_text.h"
+#include "imspinner_dots.h"
+#include "imspinner_shapes.h"
 namespace ImSpinner
 {
 #endif
@@ -20,33 +27,743 @@ namespace ImSpinner
 #include "imspinner_bars.h"
 #undef _IMSPINNER_BARS_INTERNAL_
 
-    namespace detail {
-      static struct SpinnerDraw { SpinnerTypeT type; void (*func)(const char *, const detail::SpinnerConfig &); } spinner_draw_funcs[e_st_count] = {
-        { e_st_rainbow, [] (const char *label, const detail::SpinnerConfig &c) { SpinnerRainbow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_AngleMin, c.m_AngleMax, c.m_Dots, c.m_Mode); } },
-        { e_st_angle,   [] (const char *label, const detail::SpinnerConfig &c) { SpinnerAng(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
-        { e_st_dots,    [] (const char *label, const detail::SpinnerConfig &c) { SpinnerDots(label, c.m_FloatPtr, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MinThickness, c.m_Mode); } },
-        { e_st_ang,     [] (const char *label, const detail::SpinnerConfig &c) { SpinnerAng(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
-        { e_st_vdots,   [] (const char *label, const detail::SpinnerConfig &c) { SpinnerVDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots, c.m_MiddleDots, c.m_Mode); } },
-        { e_st_bounce_ball, [] (const char *label,const detail::SpinnerConfig &c) { SpinnerBounceBall(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
-        { e_st_eclipse, [] (const char *label, const detail::SpinnerConfig &c) { SpinnerAngEclipse(label , c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
-        { e_st_ingyang, [] (const char *label, const detail::SpinnerConfig &c) { SpinnerIngYang(label, c.m_Radius, c.m_Thickness, c.m_Reverse, c.m_Delta, c.m_AltColor, c.m_Color, c.m_Speed, c.m_Angle); } },
-        { e_st_barchartsine, [] (const char *label, const detail::SpinnerConfig &c) { SpinnerBarChartSine(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } }
+    enum SpinnerCategoryT { e_sc_spinners, e_sc_text, e_sc_dots, e_sc_bars, e_sc_shapes, e_sc_count };
+
+    struct SpinnerInfo {
+      SpinnerTypeT type;
+      const char *name;
+      SpinnerCategoryT category;
+      detail::SpinnerConfig defaults;
+      void (*draw)(const char *label, const detail::SpinnerConfig &config);
+    };
+
+    // Registry entry of a spinner type. The table is indexed by SpinnerTypeT and must stay in enum order.
+    // Config fields map onto the arguments by meaning: Radius / Thickness / Speed / Angle, Color for the main
+    // colour and BgColor / AltColor for the others, Dots and MiddleDots for counts, Mode for the variant and
+    // Ext for a second int, Radius2 / Speed2 / ... for the second of a pair, Text for the caption.
+    inline const SpinnerInfo &GetSpinnerInfo(SpinnerTypeT type)
+    {
+      using detail::SpinnerConfig;
+      static const SpinnerInfo infos[] = {
+        { e_st_rainbow, "SpinnerRainbow", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{8}, AngleMin{0.f}, AngleMax{PI_2}, Dots{1}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRainbow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_AngleMin, c.m_AngleMax, c.m_Dots, c.m_Mode); } },
+        { e_st_angle, "SpinnerAng", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{white}, Speed{2.8f}, Angle{IM_PI}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAng(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_dots, "SpinnerDots", e_sc_dots, SpinnerConfig(FloatPtr{nullptr}, Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{12}, MinThickness{-1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDots(label, c.m_FloatPtr, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MinThickness, c.m_Mode); } },
+        { e_st_ang, "SpinnerAng", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{white}, Speed{2.8f}, Angle{IM_PI}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAng(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_vdots, "SpinnerVDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, BgColor{white}, Speed{2.8f}, Dots{12}, MiddleDots{6}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerVDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots, c.m_MiddleDots, c.m_Mode); } },
+        { e_st_bounce_ball, "SpinnerBounceBall", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{1}, Reverse{false}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBounceBall(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Reverse); } },
+        { e_st_eclipse, "SpinnerAngEclipse", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{5}, Color{white}, Speed{2.8f}, Angle{IM_PI}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAngEclipse(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Angle); } },
+        { e_st_ingyang, "SpinnerIngYang", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{5}, Reverse{true}, Delta{0.1f}, AltColor{white}, Color{white}, Speed{2.8f}, Angle{IM_PI * 0.7f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerIngYang(label, c.m_Radius, c.m_Thickness, c.m_Reverse, c.m_Delta, c.m_AltColor, c.m_Color, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_barchartsine, "SpinnerBarChartSine", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{4.8f}, Dots{5}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarChartSine(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_rainbow_mix, "SpinnerRainbowMix", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{ImColor::HSV(0.005f, 0.8f, 0.8f)}, Speed{8}, AngleMin{0.f}, AngleMax{PI_2}, Dots{1}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRainbowMix(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_AngleMin, c.m_AngleMax, c.m_Dots, c.m_Mode); } },
+        { e_st_rotating_heart, "SpinnerRotatingHeart", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{red}, Speed{8}, AngleMin{0.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotatingHeart(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_AngleMin); } },
+        { e_st_ang8, "SpinnerAng8", e_sc_spinners, SpinnerConfig(Radius{21}, Thickness{2}, Color{white}, BgColor{white}, Speed{2.8f}, Angle{IM_PI}, Mode{0}, Delta{0.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAng8(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode, c.m_Delta); } },
+        { e_st_ang_mix, "SpinnerAngMix", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{2.8f}, Angle{IM_PI}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAngMix(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Angle, c.m_Dots, c.m_Mode); } },
+        { e_st_loading_ring, "SpinnerLoadingRing", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerLoadingRing(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_clock, "SpinnerClock", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, BgColor{half_white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerClock(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_pulsar, "SpinnerPulsar", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{half_white}, Speed{2.8f}, Reverse{true}, Angle{0.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPulsar(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Reverse, c.m_Angle, c.m_Mode); } },
+        { e_st_double_fade_pulsar, "SpinnerDoubleFadePulsar", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{half_white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDoubleFadePulsar(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_twin_pulsar, "SpinnerTwinPulsar", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinPulsar(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_fade_pulsar, "SpinnerFadePulsar", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.8f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFadePulsar(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_fade_pulsar_square, "SpinnerFadePulsarSquare", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.8f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFadePulsarSquare(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_circular_lines, "SpinnerCircularLines", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{1.8f}, Dots{8}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCircularLines(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_4_caleidospcope, "Spinner4Caleidospcope", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{0xffffffff}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { Spinner4Caleidospcope(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_thick_to_sin, "SpinnerThickToSin", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, MiddleDots{1}, Dots{8}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerThickToSin(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_MiddleDots, c.m_Dots, c.m_Mode); } },
+        { e_st_square_spins, "SpinnerSquareSpins", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareSpins(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_twin_ang, "SpinnerTwinAng", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{16}, Thickness{6}, Color{white}, BgColor{red}, Speed{2.8f}, Angle{IM_PI}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinAng(label, c.m_Radius, c.m_Radius2, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_filling, "SpinnerFilling", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{red}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFilling(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_filling_mem, "SpinnerFillingMem", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{half_white}, Speed{4}),
+          [] (const char *label, const SpinnerConfig &c) { ImColor bg = c.m_BgColor; SpinnerFillingMem(label, c.m_Radius, c.m_Thickness, c.m_Color, bg, c.m_Speed); } },
+        { e_st_topup, "SpinnerTopup", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{12}, Color{red}, AltColor{white}, BgColor{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTopup(label, c.m_Radius, c.m_Radius2, c.m_Color, c.m_AltColor, c.m_BgColor, c.m_Speed); } },
+        { e_st_twin_ang180, "SpinnerTwinAng180", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{12}, Thickness{4}, Color{white}, BgColor{red}, Speed{2.8f}, Angle{PI_DIV_4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinAng180(label, c.m_Radius, c.m_Radius2, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_twin_ang360, "SpinnerTwinAng360", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{11}, Thickness{2}, Color{white}, BgColor{red}, Speed{2.8f}, Speed2{2.5f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinAng360(label, c.m_Radius, c.m_Radius2, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Speed2, c.m_Mode); } },
+        { e_st_fade_tris, "SpinnerFadeTris", e_sc_spinners, SpinnerConfig(Radius{20}, Color{white}, Speed{2.8f}, Dots{2}, Reverse{false}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFadeTris(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Reverse, c.m_Mode); } },
+        { e_st_ang_twin, "SpinnerAngTwin", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{13}, Thickness{2}, Color{white}, BgColor{half_white}, Speed{2.8f}, Angle{IM_PI}, Dots{1}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAngTwin(label, c.m_Radius, c.m_Radius2, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Dots, c.m_Mode); } },
+        { e_st_arc_rotation, "SpinnerArcRotation", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{5}, Color{white}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcRotation(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_arc_fade, "SpinnerArcFade", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{5}, Color{white}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcFade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_simple_arc_fade, "SpinnerSimpleArcFade", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{2}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSimpleArcFade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_square_stroke_fade, "SpinnerSquareStrokeFade", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{5}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareStrokeFade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_ascii_symbol_points, "SpinnerAsciiSymbolPoints", e_sc_text, SpinnerConfig(Text{"012345679ABCDEF"}, Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAsciiSymbolPoints(label, c.m_Text, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_seven_segments, "SpinnerSevenSegments", e_sc_spinners, SpinnerConfig(Text{"012345679ABCDEF"}, Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSevenSegments(label, c.m_Text, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_square_stroke_fill, "SpinnerSquareStrokeFill", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{5}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareStrokeFill(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_square_stroke_loading, "SpinnerSquareStrokeLoading", e_sc_spinners, SpinnerConfig(Radius{13}, Thickness{5}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareStrokeLoading(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_square_loading, "SpinnerSquareLoading", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareLoading(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_filled_arc_fade, "SpinnerFilledArcFade", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFilledArcFade(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_points_roller, "SpinnerPointsRoller", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{3.5}, Color{white}, Speed{2.8f}, Dots{8}, MiddleDots{2}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPointsRoller(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MiddleDots); } },
+        { e_st_points_arc_bounce, "SpinnerPointsArcBounce", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{4}, MiddleDots{2}, Speed2{0.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPointsArcBounce(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MiddleDots, c.m_Speed2); } },
+        { e_st_filled_arc_color, "SpinnerFilledArcColor", e_sc_spinners, SpinnerConfig(Radius{16}, Color{red}, BgColor{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFilledArcColor(label, c.m_Radius, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_filled_arc_ring, "SpinnerFilledArcRing", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{red}, BgColor{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFilledArcRing(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_arc_wedges, "SpinnerArcWedges", e_sc_spinners, SpinnerConfig(Radius{16}, Color{red}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcWedges(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_twin_ball, "SpinnerTwinBall", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{11}, Thickness{2}, Thickness2{2.5f}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinBall(label, c.m_Radius, c.m_Radius2, c.m_Thickness, c.m_Thickness2, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_solar_balls, "SpinnerSolarBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSolarBalls(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_solar_scale_balls, "SpinnerSolarScaleBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.3f}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSolarScaleBalls(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_solar_arcs, "SpinnerSolarArcs", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSolarArcs(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_moving_arcs, "SpinnerMovingArcs", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMovingArcs(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_rainbow_circle, "SpinnerRainbowCircle", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{4}, Delta{1}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRainbowCircle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Delta); } },
+        { e_st_pulsar_ball, "SpinnerPulsarBall", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{(int)(false)}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPulsarBall(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_ang_triple, "SpinnerAngTriple", e_sc_spinners, SpinnerConfig(Radius{16}, Radius2{13}, Radius3{10}, Thickness{1.3f}, Color{white}, BgColor{half_white}, AltColor{white}, Speed{2.8f}, Angle{IM_PI}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAngTriple(label, c.m_Radius, c.m_Radius2, c.m_Radius3, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_AltColor, c.m_Speed, c.m_Angle); } },
+        { e_st_gooey_balls, "SpinnerGooeyBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerGooeyBalls(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_rotate_gooey_balls, "SpinnerRotateGooeyBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{5}, Color{white}, Speed{6.f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateGooeyBalls(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_herbert_balls, "SpinnerHerbertBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2.3f}, Color{white}, Speed{2.f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerHerbertBalls(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_herbert_balls3_d, "SpinnerHerbertBalls3D", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{3.f}, Color{white}, Speed{1.4f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerHerbertBalls3D(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_rotate_triangles, "SpinnerRotateTriangles", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{6.f}, Dots{3}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateTriangles(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_rotate_shapes, "SpinnerRotateShapes", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{6.f}, Dots{4}, MiddleDots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateShapes(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MiddleDots); } },
+        { e_st_sin_squares, "SpinnerSinSquares", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSinSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_moon_line, "SpinnerMoonLine", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, BgColor{red}, Speed{2.8f}, Angle{IM_PI}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMoonLine(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle); } },
+        { e_st_circle_drop, "SpinnerCircleDrop", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.5f}, Thickness2{4.f}, Color{white}, BgColor{half_white}, Speed{2.8f}, Angle{IM_PI}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCircleDrop(label, c.m_Radius, c.m_Thickness, c.m_Thickness2, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle); } },
+        { e_st_surrounded_indicator, "SpinnerSurroundedIndicator", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{5}, Color{white}, BgColor{half_white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSurroundedIndicator(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_wifi_indicator, "SpinnerWifiIndicator", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.5f}, Color{red}, BgColor{half_white}, Speed{2.8f}, AngleMin{0.f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerWifiIndicator(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_AngleMin, c.m_Dots); } },
+        { e_st_triangles_selector, "SpinnerTrianglesSelector", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{8}, Color{white}, BgColor{half_white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTrianglesSelector(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_camera, "SpinnerCamera", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{8}, Speed{2.8f}, Dots{8}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCamera(label, c.m_Radius, c.m_Thickness, [] (int i) { return ImColor::HSV(i * 0.25f, 0.8f, 0.8f); }, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_flowing_gradient, "SpinnerFlowingGradient", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, BgColor{red}, Speed{2.8f}, Angle{IM_PI}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFlowingGradient(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle); } },
+        { e_st_rotate_segments, "SpinnerRotateSegments", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{4}, MiddleDots{1}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateSegments(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MiddleDots, c.m_Mode); } },
+        { e_st_lemniscate, "SpinnerLemniscate", e_sc_spinners, SpinnerConfig(Radius{20}, Thickness{3}, Color{white}, Speed{2.8f}, Angle{IM_PI / 2.0f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerLemniscate(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Angle); } },
+        { e_st_rotate_gear, "SpinnerRotateGear", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{12}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateGear(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_rotate_wheel, "SpinnerRotateWheel", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{10}, BgColor{white}, Color{white}, Speed{2.8f}, Dots{12}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateWheel(label, c.m_Radius, c.m_Thickness, c.m_BgColor, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_atom, "SpinnerAtom", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerAtom(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_pattern_rings, "SpinnerPatternRings", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPatternRings(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_pattern_eclipse, "SpinnerPatternEclipse", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}, AngleMin{2.f}, AngleMax{0.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPatternEclipse(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_AngleMin, c.m_AngleMax); } },
+        { e_st_pattern_sphere, "SpinnerPatternSphere", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPatternSphere(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_ring_synchronous, "SpinnerRingSynchronous", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRingSynchronous(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_ring_watermarks, "SpinnerRingWatermarks", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRingWatermarks(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_rotated_atom, "SpinnerRotatedAtom", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{3}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotatedAtom(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_rainbow_balls, "SpinnerRainbowBalls", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{1.5f}, Dots{5}, Mode{0}, MiddleDots{1}, Ext{1}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRainbowBalls(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode, c.m_MiddleDots, c.m_Ext); } },
+        { e_st_rainbow_shot, "SpinnerRainbowShot", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{1.5f}, Dots{5}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRainbowShot(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_spiral, "SpinnerSpiral", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSpiral(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_spiral_eye, "SpinnerSpiralEye", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSpiralEye(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_blocks, "SpinnerBlocks", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{7}, Color{ImColor(255, 255, 255, 30)}, BgColor{half_white}, Speed{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBlocks(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_twin_blocks, "SpinnerTwinBlocks", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{7}, Color{ImColor(255, 255, 255, 30)}, BgColor{half_white}, Speed{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinBlocks(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_scale_blocks, "SpinnerScaleBlocks", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{8}, Color{white}, Speed{5}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerScaleBlocks(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_scale_squares, "SpinnerScaleSquares", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{8}, Color{white}, Speed{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerScaleSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_squish_square, "SpinnerSquishSquare", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{8.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquishSquare(label, c.m_Radius, c.m_Color, c.m_Speed); } },
+        { e_st_arc_polar_fade, "SpinnerArcPolarFade", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcPolarFade(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_arc_polar_radius, "SpinnerArcPolarRadius", e_sc_spinners, SpinnerConfig(Radius{16}, Color{white}, Speed{2.8f}, Dots{4}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcPolarRadius(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_caleidoscope, "SpinnerCaleidoscope", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{6}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCaleidoscope(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_sine_arcs, "SpinnerSineArcs", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSineArcs(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_triangles_shift, "SpinnerTrianglesShift", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{8}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTrianglesShift(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_points_shift, "SpinnerPointsShift", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, BgColor{half_white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPointsShift(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Dots); } },
+        { e_st_circular_points, "SpinnerCircularPoints", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.2f}, Color{white}, Speed{1.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCircularPoints(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_curved_circle, "SpinnerCurvedCircle", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.2f}, Color{white}, Speed{2.8f}, Dots{1}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCurvedCircle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_mod_circle, "SpinnerModCircle", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{1.2f}, Color{white}, AngleMin{1.f}, AngleMax{1.f}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerModCircle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_AngleMin, c.m_AngleMax, c.m_Speed); } },
+        { e_st_rotate_segments_pulsar, "SpinnerRotateSegmentsPulsar", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{4}, MiddleDots{1}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateSegmentsPulsar(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_MiddleDots); } },
+        { e_st_spline_ang, "SpinnerSplineAng", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, BgColor{white}, Speed{2.8f}, Angle{IM_PI}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSplineAng(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Angle, c.m_Mode); } },
+        { e_st_conic_grid, "SpinnerConicGrid", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerConicGrid(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_arc_arrow, "SpinnerArcArrow", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerArcArrow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_orbit_moon, "SpinnerOrbitMoon", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerOrbitMoon(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_conic_wheels, "SpinnerConicWheels", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerConicWheels(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_dot_ring, "SpinnerDotRing", e_sc_spinners, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotRing(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_text_fade, "SpinnerTextFade", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextFade(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_fading, "SpinnerTextFading", e_sc_text, SpinnerConfig(Text{"Loading"}, Radius{16}, Thickness{15}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextFading(label, c.m_Text, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_text_underline, "SpinnerTextUnderline", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Thickness{3.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextUnderline(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Thickness, c.m_Text); } },
+        { e_st_text_underline_dots, "SpinnerTextUnderlineDots", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Thickness{3.f}, Dots{6}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextUnderlineDots(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Thickness, c.m_Dots, c.m_Text); } },
+        { e_st_text_typing, "SpinnerTextTyping", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Dots{3}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextTyping(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots, c.m_Text); } },
+        { e_st_text_scroll, "SpinnerTextScroll", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextScroll(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_color_fill, "SpinnerTextColorFill", e_sc_text, SpinnerConfig(Radius{30}, Color{ImColor(0xC0, 0x29, 0x42)}, BgColor{white}, Speed{0.5f}, Mode{0}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextColorFill(label, c.m_Radius, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Mode, c.m_Text); } },
+        { e_st_text_scroll_colors, "SpinnerTextScrollColors", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.2f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextScrollColors(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_color_cycle, "SpinnerTextColorCycle", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.2f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextColorCycle(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_bounce, "SpinnerTextBounce", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextBounce(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_split, "SpinnerTextSplit", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Mode{0}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSplit(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Mode, c.m_Text); } },
+        { e_st_text_underline_scroll, "SpinnerTextUnderlineScroll", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.66f}, Thickness{3.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextUnderlineScroll(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Thickness, c.m_Text); } },
+        { e_st_text_roll, "SpinnerTextRoll", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextRoll(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_colorful, "SpinnerTextColorful", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextColorful(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_cascade, "SpinnerTextCascade", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextCascade(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_conveyor, "SpinnerTextConveyor", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.33f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextConveyor(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_reveal, "SpinnerTextReveal", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextReveal(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_wave, "SpinnerTextWave", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextWave(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_sweep, "SpinnerTextSweep", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, BgColor{ImColor(0, 0, 0)}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSweep(label, c.m_Radius, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Text); } },
+        { e_st_text_shine, "SpinnerTextShine", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, BgColor{ImColor(0, 0, 0)}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextShine(label, c.m_Radius, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Text); } },
+        { e_st_text_scroll_sweep, "SpinnerTextScrollSweep", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, BgColor{ImColor(0, 0, 0)}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextScrollSweep(label, c.m_Radius, c.m_Color, c.m_BgColor, c.m_Speed, c.m_Text); } },
+        { e_st_text_spotlight, "SpinnerTextSpotlight", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSpotlight(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_shake, "SpinnerTextShake", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Mode{0}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextShake(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Mode, c.m_Text); } },
+        { e_st_text_flip, "SpinnerTextFlip", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextFlip(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_spin, "SpinnerTextSpin", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSpin(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_tumble, "SpinnerTextTumble", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Mode{0}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextTumble(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Mode, c.m_Text); } },
+        { e_st_text_swirl, "SpinnerTextSwirl", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSwirl(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_roll_wave, "SpinnerTextRollWave", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextRollWave(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_vibrate, "SpinnerTextVibrate", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextVibrate(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_glitch, "SpinnerTextGlitch", e_sc_text, SpinnerConfig(Radius{30}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextGlitch(label, c.m_Radius, c.m_Speed, c.m_Text); } },
+        { e_st_text_blur, "SpinnerTextBlur", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextBlur(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_dropout, "SpinnerTextDropout", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextDropout(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_scanline, "SpinnerTextScanline", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Mode{0}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextScanline(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Mode, c.m_Text); } },
+        { e_st_text_squash, "SpinnerTextSquash", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextSquash(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_scramble, "SpinnerTextScramble", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextScramble(label, c.m_Radius, c.m_Color, c.m_Speed); } },
+        { e_st_text_decode, "SpinnerTextDecode", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextDecode(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_text_vanish, "SpinnerTextVanish", e_sc_text, SpinnerConfig(Radius{30}, Color{white}, Speed{0.5f}, Text{"Loading..."}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTextVanish(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Text); } },
+        { e_st_bounce_dots, "SpinnerBounceDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{3}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBounceDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_zip_dots, "SpinnerZipDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, Speed{2.8f}, Dots{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerZipDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_dots_to_points, "SpinnerDotsToPoints", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Delta{0.5f}, Color{white}, Speed{1.8f}, Dots{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsToPoints(label, c.m_Radius, c.m_Thickness, c.m_Delta, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_dots_to_bar, "SpinnerDotsToBar", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Delta{0.5f}, Color{white}, Speed{2.8f}, Dots{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsToBar(label, c.m_Radius, c.m_Thickness, c.m_Delta, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_wave_dots, "SpinnerWaveDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerWaveDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_fade_dots, "SpinnerFadeDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{8}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFadeDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_three_dots, "SpinnerThreeDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerThreeDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_five_dots, "SpinnerFiveDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{0xffffffff}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFiveDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_multi_fade_dots, "SpinnerMultiFadeDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{2}, Color{white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMultiFadeDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_scale_dots, "SpinnerScaleDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{8}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerScaleDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_moving_dots, "SpinnerMovingDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMovingDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_rotate_dots, "SpinnerRotateDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}, Dots{2}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerRotateDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_orion_dots, "SpinnerOrionDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{1.3f}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerOrionDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_galaxy_dots, "SpinnerGalaxyDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{1.3f}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerGalaxyDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_inc_dots, "SpinnerIncDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{6}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerIncDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_inc_full_dots, "SpinnerIncFullDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{4}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerIncFullDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_inc_scale_dots, "SpinnerIncScaleDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{6}, Angle{0.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerIncScaleDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Angle, c.m_Mode); } },
+        { e_st_some_scale_dots, "SpinnerSomeScaleDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{6}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSomeScaleDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_dots_loading, "SpinnerDotsLoading", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4.f}, Color{white}, BgColor{white}, Speed{2.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsLoading(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_square_random_dots, "SpinnerSquareRandomDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{2.8f}, Color{ImColor(255, 255, 255, 30)}, BgColor{half_white}, Speed{5}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSquareRandomDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_hbo_dots, "SpinnerHboDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, MinFade{0.0f}, ScaleY{0.f}, Speed{1.1f}, Dots{6}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerHboDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_MinFade, c.m_ScaleY, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_moon_dots, "SpinnerMoonDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{8}, Color{white}, BgColor{ImColor(0, 0, 0)}, Speed{1.1f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMoonDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_BgColor, c.m_Speed); } },
+        { e_st_twin_hbo_dots, "SpinnerTwinHboDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, MinFade{0.0f}, ScaleY{0.f}, Speed{1.1f}, Dots{6}, Delta{0.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinHboDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_MinFade, c.m_ScaleY, c.m_Speed, c.m_Dots, c.m_Delta); } },
+        { e_st_three_dots_star, "SpinnerThreeDotsStar", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, MinFade{0.0f}, ScaleY{0.f}, Speed{1.1f}, Delta{0.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerThreeDotsStar(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_MinFade, c.m_ScaleY, c.m_Speed, c.m_Delta); } },
+        { e_st_swing_dots, "SpinnerSwingDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{2.8f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSwingDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dna_dots, "SpinnerDnaDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, Speed{2.8f}, Dots{8}, Delta{0.5f}, Reverse{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDnaDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Delta, c.m_Reverse); } },
+        { e_st_3_smuggle_dots, "Spinner3SmuggleDots", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{3}, Color{white}, Speed{4.8f}, Dots{8}, Delta{0.5f}, Reverse{0}),
+          [] (const char *label, const SpinnerConfig &c) { Spinner3SmuggleDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Delta, c.m_Reverse); } },
+        { e_st_dots_typing, "SpinnerDotsTyping", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTyping(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_dots_step, "SpinnerDotsStep", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsStep(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_dots_gather, "SpinnerDotsGather", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.5f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsGather(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_dots_shift, "SpinnerDotsShift", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsShift(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_orbit, "SpinnerDotsOrbit", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.66f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsOrbit(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_circle, "SpinnerDotsCircle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.66f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsCircle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_square, "SpinnerDotsSquare", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_shuffle, "SpinnerDotsShuffle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsShuffle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_split, "SpinnerDotsSplit", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSplit(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_leader, "SpinnerDotsLeader", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsLeader(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_rolling, "SpinnerDotsRolling", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsRolling(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_triangle, "SpinnerDotsTriangle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTriangle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_cascade, "SpinnerDotsCascade", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsCascade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_swap, "SpinnerDotsSwap", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSwap(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_spread, "SpinnerDotsSpread", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSpread(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_twin, "SpinnerDotsTwin", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTwin(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_hop, "SpinnerDotsHop", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f / 1.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsHop(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_jiggle, "SpinnerDotsJiggle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsJiggle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_vibrate, "SpinnerDotsVibrate", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsVibrate(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_wiper, "SpinnerDotsWiper", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsWiper(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_collapse, "SpinnerDotsCollapse", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsCollapse(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_flip, "SpinnerDotsFlip", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsFlip(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_turn, "SpinnerDotsTurn", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTurn(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_carousel, "SpinnerDotsCarousel", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsCarousel(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_half_turn, "SpinnerDotsHalfTurn", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsHalfTurn(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_slide_flip, "SpinnerDotsSlideFlip", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSlideFlip(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_stagger_turn, "SpinnerDotsStaggerTurn", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsStaggerTurn(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_stretch, "SpinnerDotsStretch", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsStretch(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_mirror_stretch, "SpinnerDotsMirrorStretch", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsMirrorStretch(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_pinch, "SpinnerDotsPinch", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsPinch(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_corners, "SpinnerDotsCorners", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{2.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsCorners(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_nudge_rotate, "SpinnerDotsNudgeRotate", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsNudgeRotate(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_unfold, "SpinnerDotsUnfold", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsUnfold(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_shuttle, "SpinnerDotsShuttle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsShuttle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_spread_shuttle, "SpinnerDotsSpreadShuttle", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSpreadShuttle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_triad, "SpinnerDotsTriad", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTriad(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_satellite, "SpinnerDotsSatellite", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsSatellite(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_dots_track, "SpinnerDotsTrack", e_sc_dots, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{0.5f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDotsTrack(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed); } },
+        { e_st_fade_bars, "SpinnerFadeBars", e_sc_bars, SpinnerConfig(Thickness{10}, Color{white}, Speed{2.8f}, Dots{3}, Reverse{false}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFadeBars(label, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Reverse); } },
+        { e_st_bars_rotate_fade, "SpinnerBarsRotateFade", e_sc_bars, SpinnerConfig(Radius2{8}, Radius{18}, Thickness{4}, Color{white}, Speed{2.8f}, Dots{6}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsRotateFade(label, c.m_Radius2, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_bars_scale_middle, "SpinnerBarsScaleMiddle", e_sc_bars, SpinnerConfig(Thickness{6}, Color{white}, Speed{2.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsScaleMiddle(label, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_bar_chart_adv_sine, "SpinnerBarChartAdvSine", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{5}, Color{white}, Speed{4.8f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarChartAdvSine(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bar_chart_adv_sine_fade, "SpinnerBarChartAdvSineFade", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{5}, Color{white}, Speed{4.8f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarChartAdvSineFade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bar_chart_rainbow, "SpinnerBarChartRainbow", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{6.8f}, Dots{5}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarChartRainbow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Mode); } },
+        { e_st_fluid, "SpinnerFluid", e_sc_bars, SpinnerConfig(Radius{16}, Color{ImColor(0, 0, 255)}, Speed{3.8f}, Dots{3}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFluid(label, c.m_Radius, c.m_Color, c.m_Speed, c.m_Dots); } },
+        { e_st_fluid_points, "SpinnerFluidPoints", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{2.8f}, Color{ImColor(0, 0, 255)}, Speed{3.8f}, Dots{6}, Delta{0.35f}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFluidPoints(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Dots, c.m_Delta); } },
+        { e_st_bars_seq_pulse, "SpinnerBarsSeqPulse", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSeqPulse(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_cascade_grow, "SpinnerBarsCascadeGrow", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsCascadeGrow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_rise, "SpinnerBarsRise", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsRise(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_corner_hop, "SpinnerBarsCornerHop", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsCornerHop(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_diagonal_grow, "SpinnerBarsDiagonalGrow", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsDiagonalGrow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_bounce_center, "SpinnerBarsBounceCenter", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsBounceCenter(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_scale_alt, "SpinnerBarsScaleAlt", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsScaleAlt(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_corner_wave, "SpinnerBarsCornerWave", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsCornerWave(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_jump, "SpinnerBarsJump", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsJump(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_double_row, "SpinnerBarsDoubleRow", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsDoubleRow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_six_pulse, "SpinnerBarsSixPulse", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSixPulse(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_six_stagger, "SpinnerBarsSixStagger", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSixStagger(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_morph_plus, "SpinnerBarsMorphPlus", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsMorphPlus(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_flip_six, "SpinnerBarsFlipSix", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsFlipSix(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_swap_tri_bottom, "SpinnerBarsSwapTriBottom", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSwapTriBottom(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_swap_tri_zigzag, "SpinnerBarsSwapTriZigzag", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSwapTriZigzag(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_morph_diagonal, "SpinnerBarsMorphDiagonal", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsMorphDiagonal(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_slide_diagonal, "SpinnerBarsSlideDiagonal", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSlideDiagonal(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_conic_alternate, "SpinnerBarsConicAlternate", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsConicAlternate(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_conic_walk, "SpinnerBarsConicWalk", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsConicWalk(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_march_in, "SpinnerBarsMarchIn", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsMarchIn(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_march_down, "SpinnerBarsMarchDown", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsMarchDown(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_wave_skew, "SpinnerBarsWaveSkew", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsWaveSkew(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_row_drop, "SpinnerBarsRowDrop", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsRowDrop(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_zigzag_rows, "SpinnerBarsZigzagRows", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsZigzagRows(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_fill_cascade, "SpinnerBarsFillCascade", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsFillCascade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_ping_pong_rows, "SpinnerBarsPingPongRows", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsPingPongRows(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_wave_rows_wide, "SpinnerBarsWaveRowsWide", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsWaveRowsWide(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_grid_fade, "SpinnerBarsGridFade", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsGridFade(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_grid_spread, "SpinnerBarsGridSpread", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{4}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsGridSpread(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_stretch, "SpinnerBarsStretch", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsStretch(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_stretch_seq, "SpinnerBarsStretchSeq", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsStretchSeq(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_bounce_ball, "SpinnerBarsBounceBall", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsBounceBall(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_knock_dots, "SpinnerBarsKnockDots", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsKnockDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_staircase, "SpinnerBarsStaircase", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsStaircase(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_knock_away, "SpinnerBarsKnockAway", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsKnockAway(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_gates, "SpinnerBarsGates", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsGates(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_capture, "SpinnerBarsCapture", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsCapture(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_escape, "SpinnerBarsEscape", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsEscape(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_devour, "SpinnerBarsDevour", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsDevour(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_lift, "SpinnerBarsLift", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsLift(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_gap_slide, "SpinnerBarsGapSlide", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsGapSlide(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_converge, "SpinnerBarsConverge", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsConverge(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_swap_ends, "SpinnerBarsSwapEnds", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSwapEnds(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_relay, "SpinnerBarsRelay", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsRelay(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_push, "SpinnerBarsPush", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsPush(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_push_wave, "SpinnerBarsPushWave", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsPushWave(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_gather, "SpinnerBarsGather", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsGather(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_split, "SpinnerBarsSplit", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSplit(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_bars_slot, "SpinnerBarsSlot", e_sc_bars, SpinnerConfig(Radius{16}, Thickness{6}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerBarsSlot(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_morph_shape, "SpinnerMorphShape", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMorphShape(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_flip_triangle, "SpinnerFlipTriangle", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFlipTriangle(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_fold_square, "SpinnerFoldSquare", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFoldSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_pinwheel, "SpinnerPinwheel", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPinwheel(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_corner_squares, "SpinnerCornerSquares", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCornerSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_split_square, "SpinnerSplitSquare", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSplitSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_corner_burst, "SpinnerCornerBurst", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCornerBurst(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_skew_square, "SpinnerSkewSquare", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSkewSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_tumble_square, "SpinnerTumbleSquare", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTumbleSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_tri_diamond, "SpinnerTriDiamond", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTriDiamond(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_twin_blades, "SpinnerTwinBlades", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTwinBlades(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_cross_blades, "SpinnerCrossBlades", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCrossBlades(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_drift_square, "SpinnerDriftSquare", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDriftSquare(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_pie_bounce, "SpinnerPieBounce", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPieBounce(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_leap_frog, "SpinnerLeapFrog", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerLeapFrog(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_plus_squares, "SpinnerPlusSquares", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPlusSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_seven_march, "SpinnerSevenMarch", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSevenMarch(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_corner_arcs, "SpinnerCornerArcs", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCornerArcs(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_walk_blocks, "SpinnerWalkBlocks", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerWalkBlocks(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_tumble_half_disc, "SpinnerTumbleHalfDisc", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTumbleHalfDisc(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_fold_half_disc, "SpinnerFoldHalfDisc", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerFoldHalfDisc(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_wiper_arrow, "SpinnerWiperArrow", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerWiperArrow(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_skew_squares, "SpinnerSkewSquares", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSkewSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_stretch_squares, "SpinnerStretchSquares", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerStretchSquares(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_tri_pie, "SpinnerTriPie", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerTriPie(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_shuffle_bars, "SpinnerShuffleBars", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerShuffleBars(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_hinge_tumble, "SpinnerHingeTumble", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerHingeTumble(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_diagonal_flip, "SpinnerDiagonalFlip", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerDiagonalFlip(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_pulse_grid, "SpinnerPulseGrid", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerPulseGrid(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_march_grid, "SpinnerMarchGrid", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMarchGrid(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_spin_bars, "SpinnerSpinBars", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerSpinBars(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_morph_dots, "SpinnerMorphDots", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerMorphDots(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_comb_discs, "SpinnerCombDiscs", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerCombDiscs(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
+        { e_st_orbit_disc, "SpinnerOrbitDisc", e_sc_shapes, SpinnerConfig(Radius{16}, Thickness{1}, Color{white}, Speed{1.f}, Mode{0}),
+          [] (const char *label, const SpinnerConfig &c) { SpinnerOrbitDisc(label, c.m_Radius, c.m_Thickness, c.m_Color, c.m_Speed, c.m_Mode); } },
       };
+      static_assert(IM_ARRAYSIZE(infos) == e_st_count, "one registry entry per SpinnerTypeT");
+      IM_ASSERT(type >= 0 && type < e_st_count && infos[type].type == type);
+      return infos[type];
     }
 
     inline void Spinner(const char *label, const detail::SpinnerConfig& config)
     {
-        if (config.m_SpinnerType < sizeof(detail::spinner_draw_funcs) / sizeof(detail::spinner_draw_funcs[0]))
-            detail::spinner_draw_funcs[config.m_SpinnerType].func(label, config);
+        if (config.m_SpinnerType >= 0 && config.m_SpinnerType < e_st_count)
+            GetSpinnerInfo(config.m_SpinnerType).draw(label, config);
     }
 
+    // Draws spinner Type with its registry defaults overridden by args.
     template<SpinnerTypeT Type, typename... Args>
     inline void Spinner(const char *label, const Args&... args)
     {
-      detail::SpinnerConfig config(SpinnerType{Type}, args...);
+      detail::SpinnerConfig config = GetSpinnerInfo(Type).defaults;
+      config.set<SpinnerType, Args...>(SpinnerType{Type}, args...);
       Spinner(label, config);
     }
 
+    namespace detail {
+      struct InstancedGeometry {
+        float phase = 0.f;
+        ImVec2 size;
+        DrawSlice slice;
+      };
+
+      struct InstancedState {
+        bool active = false;
+        SpinnerConfig config;
+        int count = 0;                          // prototypes captured since BeginInstanced
+        std::vector<InstancedGeometry> protos;  // kept across blocks to reuse the buffers
+      };
+
+      inline InstancedState &GetInstancedState() { static InstancedState state; return state; }
+
+      // Draws the spinner live, with its clock shifted by phase, and captures what it appended.
+      inline bool CaptureInstance(InstancedGeometry &geo, const char *label, const SpinnerConfig &config, float phase)
+      {
+        ImGuiWindow *window = ImGui::GetCurrentWindow();
+        const DrawSliceMark mark = MarkDrawSlice(window->DrawList);
+        const ImVec2 origin = window->DC.CursorPos;
+
+        {
+          ClockScope clock(Now() + phase);
+          Spinner(label, config);
+        }
+
+        if (!CaptureDrawSlice(geo.slice, window->DrawList, mark, origin))
+          return false;
+
+        geo.phase = phase;
+        geo.size = ImGui::GetItemRectSize();
+        return true;
+      }
+    }
+
+    // Instanced drawing for many identical spinners (same type and config), e.g. one per table row:
+    //   ImSpinner::BeginInstanced<e_st_ang>(Radius{8.f}, Speed{4.f});
+    //   for (row ...) { ...; ImSpinner::Instance("##busy"); }
+    //   ImSpinner::EndInstanced();
+    // The first visible instance of every phase is drawn normally and its geometry captured; the rest lay out
+    // like the spinner would and append a translated copy of it. phase shifts the animation time in seconds.
+    // Spinners that keep state between frames (detail::GetState) all show the prototype's state.
+    inline void BeginInstanced(const detail::SpinnerConfig &config)
+    {
+      detail::InstancedState &state = detail::GetInstancedState();
+      IM_ASSERT(!state.active && "Missing EndInstanced()");
+      state.active = true;
+      state.config = config;
+      state.count = 0;
+    }
+
+    template<SpinnerTypeT Type, typename... Args>
+    inline void BeginInstanced(const Args&... args)
+    {
+      detail::SpinnerConfig config = GetSpinnerInfo(Type).defaults;
+      config.set<SpinnerType, Args...>(SpinnerType{Type}, args...);
+      BeginInstanced(config);
+    }
+
+    inline void Instance(const char *label, float phase = 0.f)
+    {
+      detail::InstancedState &state = detail::GetInstancedState();
+      IM_ASSERT(state.active && "Instance() outside BeginInstanced()/EndInstanced()");
+
+      ImGuiWindow *window = ImGui::GetCurrentWindow();
+      if (window->SkipItems)
+        return;
+
+      detail::InstancedGeometry *geo = nullptr;
+      for (int i = 0; i < state.count && !geo; i++)
+        if (state.protos[i].phase == phase)
+          geo = &state.protos[i];
+
+      if (!geo) {
+        if ((int)state.protos.size() == state.count)
+          state.protos.emplace_back();
+        if (detail::CaptureInstance(state.protos[state.count], label, state.config, phase))
+          state.count++;
+        return;
+      }
+
+      const ImGuiStyle &style = ImGui::GetStyle();
+      const ImVec2 pos = window->DC.CursorPos;
+      const ImRect bb(pos, ImVec2(pos.x + geo->size.x, pos.y + geo->size.y));
+      ImGui::ItemSize(bb, style.FramePadding.y);
+      if (!ImGui::ItemAdd(bb, window->GetID(label)))
+        return;
+
+      detail::ReplayDrawSlice(window->DrawList, geo->slice, pos);
+    }
+
+    inline void EndInstanced()
+    {
+      detail::InstancedState &state = detail::GetInstancedState();
+      IM_ASSERT(state.active && "Missing BeginInstanced()");
+      state.active = false;
+    }
+
 #ifndef _IMSPINNER_COMPAT_INTERNAL_
 } // namespace ImSpinner
 #endif
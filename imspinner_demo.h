@@ -8,6 +8,8 @@
  * to get the demo; it pulls in "imspinner_text.h", "imspinner_dots.h",
  * "imspinner_bars.h", and "imspinner_compat.h" (Spinner<> dispatcher).
  * Call ImSpinner::demoSpinners() once per frame inside your ImGui loop.
+ * Passing a DemoCellQuery skips the UI and runs single cells, for headless
+ * benchmarks and tests (tests/imspinner_bench.cpp).
  */
 
 #include "imspinner_text.h"
@@ -16,15 +18,29 @@
 #include "imspinner_shapes.h"
 #include "imspinner_compat.h"
 
+#include <chrono>
+
 namespace ImSpinner
 {
-    inline void demoSpinners() {
+    // Headless access to the gallery registry. With a query passed in, demoSpinners() builds no UI: it fills
+    // in the number of cells and the name and view of 'cell', and with 'draw' set draws that cell at the cursor
+    // with the parameters the gallery would use.
+    struct DemoCellQuery {
+      int cell = -1;
+      bool draw = false;
+      int count = 0;                // out
+      const char *name = nullptr;   // out
+      int category = -1;            // out: SpinnerCategoryT, 0 = spinners, 1 = text, 2 = dots, 3 = bars, 4 = shapes
+    };
+
+    inline void demoSpinners(DemoCellQuery *query = nullptr) {
       static int hue = 0;
       static float nextdot = 0, nextdot2;
       static bool show_number = false;
       static int view_mode = 0;   // 0 = spinners, 1 = text, 2 = dots, 3 = bars, 4 = shapes
 
-      nextdot -= 0.07f;
+      if (!query)
+        nextdot -= 0.07f;   // once per gallery frame
 
       static float velocity = 1.f;
       static float widget_size = 50.f;
@@ -32,25 +48,982 @@ namespace ImSpinner
       static int selected_idx = 0;
       static ImColor spinner_filling_meb_bg;
 
-      constexpr int num_spinners = 452;
-
       static int cci = 0, last_cci = 0;
-      static std::map<int, const char*> __nn; auto Name = [] (const char* v) { if (!__nn.count(cci)) { __nn[cci] = v; }; return __nn[cci]; };
-      static std::map<int, float> __rr; auto R = [] (float v) { if (!__rr.count(cci)) { __rr[cci] = v; }; return __rr[cci]; };
-      static std::map<int, float> __tt; auto T = [] (float v) { if (!__tt.count(cci)) { __tt[cci] = v; }; return __tt[cci];  };
-      static std::map<int, ImColor> __cc; auto C = [] (ImColor v) { if (!__cc.count(cci)) { __cc[cci] = v; }; return __cc[cci];  };
-      static std::map<int, ImColor> __cb; auto CB = [] (ImColor v) { if (!__cb.count(cci)) { __cb[cci] = v; }; return __cb[cci];  };
-      static std::map<int, bool> __hc; auto HC = [] (bool v) { if (!__hc.count(cci)) { __hc[cci] = v; }; return __hc[cci];  };
-      static std::map<int, bool> __hcb; auto HCB = [] (bool v) { if (!__hcb.count(cci)) { __hcb[cci] = v; }; return __hcb[cci];  };
-      static std::map<int, float> __ss; auto S = [] (float v) { if (!__ss.count(cci)) { __ss[cci] = v; }; return __ss[cci];  };
-      static std::map<int, float> __aa; auto A = [] (float v) { if (!__aa.count(cci)) { __aa[cci] = v; }; return __aa[cci];  };
-      static std::map<int, float> __amn; auto AMN = [] (float v) { if (!__amn.count(cci)) { __amn[cci] = v; }; return __amn[cci];  };
-      static std::map<int, float> __amx; auto AMX = [] (float v) { if (!__amx.count(cci)) { __amx[cci] = v; }; return __amx[cci];  };
-      static std::map<int, int> __dt; auto DT = [] (int v) { if (!__dt.count(cci)) { __dt[cci] = v; }; return __dt[cci];  };
-      static std::map<int, int> __mdt; auto MDT = [] (int v) { if (!__mdt.count(cci)) { __mdt[cci] = v; }; return __mdt[cci];  };
-      static std::map<int, float> __dd; auto D = [] (float v) { if (!__dd.count(cci)) { __dd[cci] = v; }; return __dd[cci];  };
-      static std::map<int, int> __mm; auto M = [] (float v) { if (!__mm.count(cci)) { __mm[cci] = v; }; return __mm[cci];  };
-      static std::map<int, int> __mx; auto MX = [] (float v) { if (!__mx.count(cci)) { __mx[cci] = v; }; return __mx[cci];  };
+      // Tweakable parameters of the gallery cells as flat arrays indexed by cell number. A cell registers a
+      // field the first time its draw function asks for it (R(16), T(2), ...): 'has' keeps one bit per field,
+      // plus the two "cycle color" toggles of the options panel.
+      enum { pf_r = 1 << 0, pf_t = 1 << 1, pf_c = 1 << 2, pf_cb = 1 << 3, pf_s = 1 << 4, pf_a = 1 << 5, pf_amn = 1 << 6, pf_amx = 1 << 7,
+             pf_dt = 1 << 8, pf_mdt = 1 << 9, pf_d = 1 << 10, pf_m = 1 << 11, pf_mx = 1 << 12, pf_hc = 1 << 13, pf_hcb = 1 << 14 };
+      struct ParamStore {
+        std::vector<unsigned> has;
+        std::vector<float> r, t, s, a, amn, amx, d;
+        std::vector<ImColor> c, cb;
+        std::vector<int> dt, mdt, m, mx;
+
+        void resize(int n) {
+          has.resize(n, 0u);
+          for (auto *v : { &r, &t, &s, &a, &amn, &amx, &d }) v->resize(n);
+          for (auto *v : { &c, &cb }) v->resize(n);
+          for (auto *v : { &dt, &mdt, &m, &mx }) v->resize(n);
+        }
+      };
+      static ParamStore params;
+      static const auto Param = [] (unsigned field, auto &values, auto v) {
+        if (!(params.has[cci] & field)) { params.has[cci] |= field; values[cci] = v; }
+        return values[cci];
+      };
+      static const auto R = [] (float v) { return Param(pf_r, params.r, v); };
+      static const auto T = [] (float v) { return Param(pf_t, params.t, v); };
+      static const auto C = [] (ImColor v) { return Param(pf_c, params.c, v); };
+      static const auto CB = [] (ImColor v) { return Param(pf_cb, params.cb, v); };
+      static const auto S = [] (float v) { return Param(pf_s, params.s, v); };
+      static const auto A = [] (float v) { return Param(pf_a, params.a, v); };
+      static const auto AMN = [] (float v) { return Param(pf_amn, params.amn, v); };
+      static const auto AMX = [] (float v) { return Param(pf_amx, params.amx, v); };
+      static const auto DT = [] (int v) { return Param(pf_dt, params.dt, v); };
+      static const auto MDT = [] (int v) { return Param(pf_mdt, params.mdt, v); };
+      static const auto D = [] (float v) { return Param(pf_d, params.d, v); };
+      static const auto M = [] (float v) { return Param(pf_m, params.m, (int)v); };
+      static const auto MX = [] (float v) { return Param(pf_mx, params.mx, (int)v); };
+
+      // Gallery cells, one per entry: the cell number is the position in this table, the spinner type picks
+      // the view (view_mode) through its registry category (GetSpinnerInfo, imspinner_compat.h). draw()
+      // renders the cell through Spinner<Type>; the R(), T(), ... wrappers register the tweakable parameters
+      // of the cell on first use and return their current values.
+      struct SpinnerEntry { const char *name; SpinnerTypeT type; void (*draw)(const char *label); };
+      static const SpinnerEntry entries[] = {
+          /*  0 */ { "Spinner", e_st_rainbow, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(1)}, Mode{M(0)}); } },
+          /*  1 */ { "Spinner", e_st_rainbow, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(4)}, Mode{M(1)}); } },
+          /*  2 */ { "SpinnerDots", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(0)}); } },
+          /*  3 */ { "SpinnerDots", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(1)}); } },
+          /*  4 */ { "SpinnerAng270", e_st_ang, [] (const char *label) { ImSpinner::Spinner<e_st_ang>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(6) * velocity}, Angle{A(0.75f * PI_2)}, Mode{M(0)}); } },
+          /*  5 */ { "SpinnerAng270NoBg", e_st_ang, [] (const char *label) { ImSpinner::Spinner<e_st_ang>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(6) * velocity}, Angle{A(0.75f * PI_2)}); } },
+          /*  6 */ { "SpinnerVDots", e_st_vdots, [] (const char *label) { ImSpinner::Spinner<e_st_vdots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.7f) * velocity}, Dots{DT(12)}, MiddleDots{MDT(6)}, Mode{M(0)}); } },
+          /*  7 */ { "SpinnerBounceBall", e_st_bounce_ball, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(1)}, Mode{M(0)}); } },
+          /*  8 */ { "SpinnerAngEclipse", e_st_eclipse, [] (const char *label) { ImSpinner::Spinner<e_st_eclipse>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(6) * velocity}); } },
+          /*  9 */ { "SpinnerIngYang", e_st_ingyang, [] (const char *label) { ImSpinner::Spinner<e_st_ingyang>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Reverse{false}, Delta{D(0.f)}, Color{C(white)}, AltColor{ImColor(255, 0, 0)}, Speed{S(4) * velocity}, Angle{A(IM_PI * 0.8f)}); } },
+          /* 10 */ { "SpinnerBarChartSine", e_st_barchartsine, [] (const char *label) { ImSpinner::Spinner<e_st_barchartsine>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(6.8f) * velocity}, Dots{DT(4)}, Mode{M(0)}); } },
+          /* 11 */ { "SpinnerBounceDots", e_st_bounce_dots, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(3)}, Mode{M(0)}); } },
+          /* 12 */ { "SpinnerFadeDots", e_st_fade_dots, [] (const char *label) { ImSpinner::Spinner<e_st_fade_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(8) * velocity}, Dots{DT(8)}); } },
+          /* 13 */ { "SpinnerScaleDots", e_st_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(7) * velocity}, Dots{DT(8)}); } },
+          /* 14 */ { "SpinnerMovingDots", e_st_moving_dots, [] (const char *label) { ImSpinner::Spinner<e_st_moving_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(30) * velocity}, Dots{DT(3)}); } },
+          /* 15 */ { "SpinnerRotateDots", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 16 */ { "SpinnerTwinAng", e_st_twin_ang, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang>(label,
+                                                          Radius{R(16)}, Radius2{16}, Thickness{T(6)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}, Angle{A(IM_PI)}, Mode{M(0)}); } },
+          /* 17 */ { "SpinnerClock", e_st_clock, [] (const char *label) { ImSpinner::Spinner<e_st_clock>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(4) * velocity}); } },
+          /* 18 */ { "SpinnerIngYangR", e_st_ingyang, [] (const char *label) { ImSpinner::Spinner<e_st_ingyang>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Reverse{true}, Delta{0.1f}, AltColor{C(white)}, Color{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}, Angle{A(IM_PI * 0.8f)}, Mode{M(0)}); } },
+          /* 19 */ { "SpinnerBarChartSine2", e_st_barchartsine, [] (const char *label) { ImSpinner::Spinner<e_st_barchartsine>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)}, Speed{S(4.8f) * velocity}, Dots{DT(4)}, Mode{M(4)}); } },
+          /* 20 */ { "SpinnerTwinAng", e_st_twin_ang180, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang180>(label,
+                                                          Radius{R(16)}, Radius2{12}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}, Angle{A(PI_DIV_4)}, Mode{M(0)}); } },
+          /* 21 */ { "SpinnerTwinAng2", e_st_twin_ang180, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang180>(label,
+                                                          Radius{R(16)}, Radius2{12}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}, Angle{A(IM_PI)}, Mode{M(1)}); } },
+          /* 22 */ { "SpinnerIncDots", e_st_inc_dots, [] (const char *label) { ImSpinner::Spinner<e_st_inc_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(5.6f) * velocity}, Dots{6}); } },
+          /* 23 */ { "SpinnerDotsWoBg", e_st_dots, [] (const char *label) { nextdot2 -= 0.2f * velocity; ImSpinner::Spinner<e_st_dots>(label,
+                                                          FloatPtr{&nextdot2}, Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.3f) * velocity}, Dots{DT(12)}, MinThickness{A(0.f)}, Mode{M(0)}); } },
+          /* 24 */ { "SpinnerIncScaleDots", e_st_inc_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_inc_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(6.6f) * velocity}, Dots{DT(6)}, Angle{A(0)}, Mode{M(0)}); } },
+          /* 25 */ { "SpinnerAng90", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(0)}); } },
+          /* 26 */ { "SpinnerAng90", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{6}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(8.5f) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(0)}); } },
+          /* 27 */ { "SpinnerFadeBars", e_st_fade_bars, [] (const char *label) { ImSpinner::Spinner<e_st_fade_bars>(label,
+                                                          Thickness{10}, Color{C(white)}, Speed{S(4.8f) * velocity}, Dots{3}); } },
+          /* 28 */ { "SpinnerPulsar", e_st_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1) * velocity}, Reverse{true}, Angle{A(0)}, Mode{M(0)}); } },
+          /* 29 */ { "SpinnerIngYangR2", e_st_ingyang, [] (const char *label) { ImSpinner::Spinner<e_st_ingyang>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Reverse{true}, Delta{3.f}, AltColor{C(white)}, Color{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}, Angle{A(IM_PI * 0.8f)}); } },
+          /* 30 */ { "SpinnerBarChartRainbow", e_st_bar_chart_rainbow, [] (const char *label) { ImSpinner::Spinner<e_st_bar_chart_rainbow>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)}, Speed{S(6.8f) * velocity}, Dots{DT(4)}, Mode{M(0)}); } },
+          /* 31 */ { "SpinnerBarsRotateFade", e_st_bars_rotate_fade, [] (const char *label) { ImSpinner::Spinner<e_st_bars_rotate_fade>(label,
+                                                          Radius2{8}, Radius{18}, Thickness{T(4)}, Color{C(white)}, Speed{S(7.6f) * velocity}, Dots{DT(6)}); } },
+          /* 32 */ { "SpinnerFadeScaleBars", e_st_fade_bars, [] (const char *label) { ImSpinner::Spinner<e_st_fade_bars>(label,
+                                                          Thickness{10}, Color{C(white)}, Speed{S(6.8f) * velocity}, Dots{3}, Reverse{true}); } },
+          /* 33 */ { "SpinnerBarsScaleMiddle", e_st_bars_scale_middle, [] (const char *label) { ImSpinner::Spinner<e_st_bars_scale_middle>(label,
+                                                          Thickness{6}, Color{C(white)}, Speed{S(8.8f) * velocity}, Dots{3}); } },
+          /* 34 */ { "SpinnerAngTwin1", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(16)}, Radius2{13}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Angle{A(PI_DIV_2)}, Dots{DT(1)}, Mode{M(0)}); } },
+          /* 35 */ { "SpinnerAngTwin2", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{13}, Radius2{16}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Angle{A(PI_DIV_2)}, Dots{DT(1)}, Mode{M(0)}); } },
+          /* 36 */ { "SpinnerAngTwin3", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{13}, Radius2{16}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Angle{A(PI_DIV_2)}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 37 */ { "SpinnerAngTwin4", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(16)}, Radius2{13}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Angle{A(PI_DIV_2)}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 38 */ { "SpinnerTwinPulsar", e_st_twin_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_twin_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 39 */ { "SpinnerAngTwin4", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(14)}, Radius2{13}, Thickness{T(3)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(ImColor(0, 0, 0, 0))}, Speed{S(5) * velocity}, Angle{A(IM_PI / 1.5f)}, Dots{2}); } },
+          /* 40 */ { "SpinnerBlocks", e_st_blocks, [] (const char *label) { ImSpinner::Spinner<e_st_blocks>(label,
+                                                          Radius{R(16)}, Thickness{T(7)}, Color{C(ImColor(255, 255, 255, 30))}, BgColor{CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f))}, Speed{S(5) * velocity}); } },
+          /* 41 */ { "SpinnerTwinBall", e_st_twin_ball, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ball>(label,
+                                                          Radius{R(16)}, Radius2{11}, Thickness{T(2)}, Thickness2{2.5f}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 42 */ { "SpinnerTwinBall2", e_st_twin_ball, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ball>(label,
+                                                          Radius{R(15)}, Radius2{19}, Thickness{T(2)}, Thickness2{2.f}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(6) * velocity}, Dots{DT(3)}, Mode{M(0)}); } },
+          /* 43 */ { "SpinnerTwinBall2", e_st_twin_ball, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ball>(label,
+                                                          Radius{16}, Radius2{16}, Thickness{T(2)}, Thickness2{5.f}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(5) * velocity}, Dots{DT(1)}, Mode{M(0)}); } },
+          /* 44 */ { "SpinnerAngTriple", e_st_ang_triple, [] (const char *label) { ImSpinner::Spinner<e_st_ang_triple>(label,
+                                                          Radius{16}, Radius2{13}, Radius3{10}, Thickness{T(1.3f)}, Color{C(white)}, BgColor{ImColor(255, 0, 0)}, AltColor{white}, Speed{S(5) * velocity}, Angle{A(1.5f * IM_PI)}); } },
+          /* 45 */ { "SpinnerIncFullDots", e_st_inc_full_dots, [] (const char *label) { ImSpinner::Spinner<e_st_inc_full_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(5.6f) * velocity}, Dots{4}); } },
+          /* 46 */ { "SpinnerGooeyBalls", e_st_gooey_balls, [] (const char *label) { ImSpinner::Spinner<e_st_gooey_balls>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(2.f) * velocity}); } },
+          /* 47 */ { "SpinnerRotateGooeyBalls2", e_st_rotate_gooey_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_gooey_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(6.f) * velocity}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 48 */ { "SpinnerRotateGooeyBalls3", e_st_rotate_gooey_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_gooey_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(6.f) * velocity}, Dots{DT(3)}, Mode{M(0)}); } },
+          /* 49 */ { "SpinnerMoonLine", e_st_moon_line, [] (const char *label) { ImSpinner::Spinner<e_st_moon_line>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(ImColor(200, 80, 0))}, BgColor{ImColor(80, 80, 80)}, Speed{S(5) * velocity}); } },
+          /* 50 */ { "SpinnerArcRotation", e_st_arc_rotation, [] (const char *label) { ImSpinner::Spinner<e_st_arc_rotation>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, Mode{M(0)}); } },
+          /* 51 */ { "SpinnerFluid", e_st_fluid, [] (const char *label) { ImSpinner::Spinner<e_st_fluid>(label,
+                                                          Radius{R(16)}, Color{C(ImColor(0, 0, 255))}, Speed{S(3.8f) * velocity}, Dots{4}); } },
+          /* 52 */ { "SpinnerArcFade", e_st_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_arc_fade>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, Mode{M(0)}); } },
+          /* 53 */ { "SpinnerFilling", e_st_filling, [] (const char *label) { ImSpinner::Spinner<e_st_filling>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}); } },
+          /* 54 */ { "SpinnerTopup", e_st_topup, [] (const char *label) { ImSpinner::Spinner<e_st_topup>(label,
+                                                          Radius{R(16)}, Radius2{12}, Color{C(ImColor(255, 0, 0))}, AltColor{ImColor(80, 80, 80)}, BgColor{CB(white)}, Speed{S(1) * velocity}); } },
+          /* 55 */ { "SpinnerFadePulsar", e_st_fade_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_fade_pulsar>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Dots{DT(1)}, Mode{M(0)}); } },
+          /* 56 */ { "SpinnerFadePulsar2", e_st_fade_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_fade_pulsar>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(0.9f) * velocity}, Dots{DT(2)}, Mode{M(0)}); } },
+          /* 57 */ { "SpinnerPulsar", e_st_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1) * velocity}, Reverse{false}); } },
+          /* 58 */ { "SpinnerDoubleFadePulsar", e_st_double_fade_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_double_fade_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2) * velocity}); } },
+          /* 59 */ { "SpinnerFilledArcFade", e_st_filled_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_fade>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{4}); } },
+          /* 60 */ { "SpinnerFilledArcFade6", e_st_filled_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_fade>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{6}); } },
+          /* 61 */ { "SpinnerFilledArcFade6", e_st_filled_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_fade>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(8) * velocity}, Dots{12}); } },
+          /* 62 */ { "SpinnerFilledArcColor", e_st_filled_arc_color, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_color>(label,
+                                                          Radius{R(16)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(2.8f) * velocity}); } },
+          /* 63 */ { "SpinnerCircleDrop", e_st_circle_drop, [] (const char *label) { ImSpinner::Spinner<e_st_circle_drop>(label,
+                                                          Radius{R(16)}, Thickness{T(1.5f)}, Thickness2{4.f}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(2.8f) * velocity}, Angle{A(IM_PI)}); } },
+          /* 64 */ { "SpinnerSurroundedIndicator", e_st_surrounded_indicator, [] (const char *label) { ImSpinner::Spinner<e_st_surrounded_indicator>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(ImColor(0, 0, 0))}, BgColor{CB(white)}, Speed{S(7.8f) * velocity}); } },
+          /* 65 */ { "SpinnerTrianglesSelector", e_st_triangles_selector, [] (const char *label) { ImSpinner::Spinner<e_st_triangles_selector>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{C(ImColor(0, 0, 0))}, BgColor{CB(white)}, Speed{S(4.8f) * velocity}); } },
+          /* 66 */ { "SpinnerFlowingFradient", e_st_flowing_gradient, [] (const char *label) { ImSpinner::Spinner<e_st_flowing_gradient>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(ImColor(200, 80, 0))}, BgColor{CB(ImColor(80, 80, 80))}, Speed{S(5) * velocity}, Angle{A(PI_2)}); } },
+          /* 67 */ { "SpinnerRotateSegments", e_st_rotate_segments, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, MiddleDots{MDT(1)}, Mode{M(0)}); } },
+          /* 68 */ { "SpinnerRotateSegments2", e_st_rotate_segments, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(2.4f) * velocity}, Dots{DT(4)}, MiddleDots{MDT(2)}, Mode{M(0)}); } },
+          /* 69 */ { "SpinnerRotateSegments3", e_st_rotate_segments, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(4)}, MiddleDots{MDT(3)}, Mode{M(0)}); } },
+          /* 70 */ { "SpinnerLemniscate", e_st_lemniscate, [] (const char *label) { ImSpinner::Spinner<e_st_lemniscate>(label,
+                                                          Radius{R(20)}, Thickness{T(3)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Angle{3}); } },
+          /* 71 */ { "SpinnerRotateGear", e_st_rotate_gear, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_gear>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{8}); } },
+          /* 72 */ { "SpinnerRotatedAtom", e_st_rotated_atom, [] (const char *label) { ImSpinner::Spinner<e_st_rotated_atom>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(3)}, Mode{M(0)}); } },
+          /* 73 */ { "SpinnerAtom", e_st_atom, [] (const char *label) { ImSpinner::Spinner<e_st_atom>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4.1f) * velocity}); } },
+          /* 74 */ { "SpinnerRainbowBalls", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(5)}, Mode{M(0)}, MiddleDots{MDT(1)}, Ext{MX(0)}); } },
+          /* 75 */ { "SpinnerCamera", e_st_camera, [] (const char *label) { ImSpinner::Spinner<e_st_camera>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Speed{S(4.8f) * velocity}, Dots{DT(8)}, Mode{M(0)}); } },
+          /* 76 */ { "SpinnerArcPolarFade", e_st_arc_polar_fade, [] (const char *label) { ImSpinner::Spinner<e_st_arc_polar_fade>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(6)}, Mode{M(0)}); } },
+          /* 77 */ { "SpinnerArcPolarRadius", e_st_arc_polar_radius, [] (const char *label) { ImSpinner::Spinner<e_st_arc_polar_radius>(label,
+                                                          Radius{R(16)}, Color{C(ImColor::HSV(0.25f, 0.8f, 0.8f))}, Speed{S(6.f) * velocity}, Dots{DT(6)}, Mode{M(0)}); } },
+          /* 78 */ { "SpinnerArcPolarPies", e_st_caleidoscope, [] (const char *label) { ImSpinner::Spinner<e_st_caleidoscope>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(ImColor::HSV(0.25f, 0.8f, 0.8f))}, Speed{S(2.6f) * velocity}, Dots{DT(10)}, Mode{M(0)}); } },
+          /* 79 */ { "SpinnerArcPolarPies2", e_st_caleidoscope, [] (const char *label) { ImSpinner::Spinner<e_st_caleidoscope>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(ImColor::HSV(0.35f, 0.8f, 0.8f))}, Speed{S(3.2f) * velocity}, Dots{10}, Mode{1}); } },
+          /* 80 */ { "SpinnerScaleBlocks", e_st_scale_blocks, [] (const char *label) { ImSpinner::Spinner<e_st_scale_blocks>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)}, Speed{S(5) * velocity}); } },
+          /* 81 */ { "SpinnerRotateTriangles", e_st_rotate_triangles, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_triangles>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(6.f) * velocity}, Dots{DT(3)}, Mode{M(0)}); } },
+          /* 82 */ { "SpinnerArcWedges", e_st_arc_wedges, [] (const char *label) { ImSpinner::Spinner<e_st_arc_wedges>(label,
+                                                          Radius{R(16)}, Color{C(ImColor::HSV(0.3f, 0.8f, 0.8f))}, Speed{S(2.8f) * velocity}, Dots{DT(4)}, Mode{M(0)}); } },
+          /* 83 */ { "SpinnerScaleSquares", e_st_scale_squares, [] (const char *label) { ImSpinner::Spinner<e_st_scale_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)}, Speed{S(5) * velocity}); } },
+          /* 84 */ { "SpinnerHboDots", e_st_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.f}, ScaleY{0.f}, Speed{S(1.1f) * velocity}, Dots{DT(6)}, Mode{M(0)}); } },
+          /* 85 */ { "SpinnerHboDots2", e_st_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(1.1f) * velocity}, Dots{DT(6)}, Mode{M(0)}); } },
+          /* 86 */ { "SpinnerBounceBall3", e_st_bounce_ball, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(3.2f) * velocity}, Dots{DT(5)}); } },
+          /* 87 */ { "SpinnerBounceBallShadow", e_st_bounce_ball, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(2.2f) * velocity}, Dots{DT(1)}, Reverse{true}); } },
+          /* 88 */ { "SpinnerBounceBall5Shadow", e_st_bounce_ball, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(3.6f) * velocity}, Dots{DT(5)}, Reverse{true}); } },
+          /* 89 */ { "SpinnerSquareStrokeFade", e_st_square_stroke_fade, [] (const char *label) { ImSpinner::Spinner<e_st_square_stroke_fade>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /* 90 */ { "SpinnerSquareStrokeFill", e_st_square_stroke_fill, [] (const char *label) { ImSpinner::Spinner<e_st_square_stroke_fill>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /* 91 */ { "SpinnerSwingDots", e_st_swing_dots, [] (const char *label) { ImSpinner::Spinner<e_st_swing_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(ImColor(255, 0, 0))}, Speed{S(4.1f) * velocity}); } },
+          /* 92 */ { "SpinnerRotateWheel", e_st_rotate_wheel, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_wheel>(label,
+                                                          Radius{R(16)}, Thickness{T(10)}, BgColor{C(ImColor(255, 255, 0))}, Color{CB(white)}, Speed{S(2.1f) * velocity}, Dots{8}); } },
+          /* 93 */ { "SpinnerWaveDots", e_st_wave_dots, [] (const char *label) { ImSpinner::Spinner<e_st_wave_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(8)}); } },
+          /* 94 */ { "SpinnerRotateShapes", e_st_rotate_shapes, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_shapes>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(6.f) * velocity}, Dots{DT(4)}, MiddleDots{MDT(4)}); } },
+          /* 95 */ { "SpinnerSquareStrokeLoanding", e_st_square_stroke_loading, [] (const char *label) { ImSpinner::Spinner<e_st_square_stroke_loading>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /* 96 */ { "SpinnerSinSquares", e_st_sin_squares, [] (const char *label) { ImSpinner::Spinner<e_st_sin_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /* 97 */ { "SpinnerZipDots", e_st_zip_dots, [] (const char *label) { ImSpinner::Spinner<e_st_zip_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(5)}); } },
+          /* 98 */ { "SpinnerDotsToBar", e_st_dots_to_bar, [] (const char *label) { ImSpinner::Spinner<e_st_dots_to_bar>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Delta{D(0.5f)}, Color{C(ImColor::HSV(0.31f, 0.8f, 0.8f))}, Speed{S(5) * velocity}, Dots{DT(5)}); } },
+          /* 99 */ { "SpinnerSineArcs", e_st_sine_arcs, [] (const char *label) { ImSpinner::Spinner<e_st_sine_arcs>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /*100 */ { "SpinnerTrianglesShift", e_st_triangles_shift, [] (const char *label) { ImSpinner::Spinner<e_st_triangles_shift>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{C(ImColor(0, 0, 0))}, BgColor{CB(white)}, Speed{S(1.8f) * velocity}, Dots{DT(8)}); } },
+          /*101 */ { "SpinnerCircularLines", e_st_circular_lines, [] (const char *label) { ImSpinner::Spinner<e_st_circular_lines>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Dots{DT(8)}, Mode{M(0)}); } },
+          /*102 */ { "SpinnerLoadingRing", e_st_loading_ring, [] (const char *label) { ImSpinner::Spinner<e_st_loading_ring>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(red)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(1.f) * velocity}, Dots{DT(5)}); } },
+          /*103 */ { "SpinnerPatternRings", e_st_pattern_rings, [] (const char *label) { ImSpinner::Spinner<e_st_pattern_rings>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4.1f) * velocity}, Dots{DT(3)}); } },
+          /*104 */ { "SpinnerPatternSphere", e_st_pattern_sphere, [] (const char *label) { ImSpinner::Spinner<e_st_pattern_sphere>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(6)}); } },
+          /*105 */ { "SpinnerRingSnchronous", e_st_ring_synchronous, [] (const char *label) { ImSpinner::Spinner<e_st_ring_synchronous>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(3)}); } },
+          /*106 */ { "SpinnerRingWatermarks", e_st_ring_watermarks, [] (const char *label) { ImSpinner::Spinner<e_st_ring_watermarks>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(3)}); } },
+          /*107 */ { "SpinnerFilledArcRing", e_st_filled_arc_ring, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_ring>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(red)}, BgColor{CB(white)}, Speed{S(2.8f) * velocity}, Dots{DT(8)}); } },
+          /*108 */ { "SpinnerPointsShift", e_st_points_shift, [] (const char *label) { ImSpinner::Spinner<e_st_points_shift>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(ImColor(0, 0, 0))}, BgColor{CB(white)}, Speed{S(1.8f) * velocity}, Dots{DT(10)}); } },
+          /*109 */ { "SpinnerCircularPoints", e_st_circular_points, [] (const char *label) { ImSpinner::Spinner<e_st_circular_points>(label,
+                                                          Radius{R(16)}, Thickness{T(1.2f)}, Color{C(white)}, Speed{S(10.f) * velocity}, Dots{DT(7)}); } },
+          /*110 */ { "SpinnerCurvedCircle", e_st_curved_circle, [] (const char *label) { ImSpinner::Spinner<e_st_curved_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(1.2f)}, Color{C(white)}, Speed{S(1.f) * velocity}, Dots{DT(3)}); } },
+          /*111 */ { "SpinnerModCirclre", e_st_mod_circle, [] (const char *label) { ImSpinner::Spinner<e_st_mod_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(1.2f)}, Color{C(white)}, AngleMin{AMN(1.f)}, AngleMax{AMX(2.f)}, Speed{S(3.f) * velocity}); } },
+          /*112 */ { "SpinnerModCirclre2", e_st_mod_circle, [] (const char *label) { ImSpinner::Spinner<e_st_mod_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(1.2f)}, Color{C(white)}, AngleMin{AMN(1.11f)}, AngleMax{AMX(3.33f)}, Speed{S(3.f) * velocity}); } },
+          /*113 */ { "SpinnerPatternEclipse", e_st_pattern_eclipse, [] (const char *label) { ImSpinner::Spinner<e_st_pattern_eclipse>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4.1f) * velocity}, Dots{DT(5)}, AngleMin{AMN(2.f)}, AngleMax{AMX(0.f)}); } },
+          /*114 */ { "SpinnerPatternEclipse2", e_st_pattern_eclipse, [] (const char *label) { ImSpinner::Spinner<e_st_pattern_eclipse>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4.1f) * velocity}, Dots{DT(9)}, AngleMin{AMN(4.f)}, AngleMax{AMX(1.f)}); } },
+          /*115 */ { "SpinnerMultiFadeDots", e_st_multi_fade_dots, [] (const char *label) { ImSpinner::Spinner<e_st_multi_fade_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(8) * velocity}, Dots{DT(8)}); } },
+          /*116 */ { "SpinnerRainbowShot", e_st_rainbow_shot, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_shot>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(5)}, Mode{M(0)}); } },
+          /*117 */ { "SpinnerSpiral", e_st_spiral, [] (const char *label) { ImSpinner::Spinner<e_st_spiral>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(5)}); } },
+          /*118 */ { "SpinnerSpiralEye", e_st_spiral_eye, [] (const char *label) { ImSpinner::Spinner<e_st_spiral_eye>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /*119 */ { "SpinnerWifiIndicator", e_st_wifi_indicator, [] (const char *label) { ImSpinner::Spinner<e_st_wifi_indicator>(label,
+                                                          Radius{R(16)}, Thickness{T(1.5f)}, Color{C(ImColor(0, 0, 0))}, BgColor{CB(white)}, Speed{S(7.8f) * velocity}, AngleMin{AMN(5.52f)}, Dots{DT(3)}); } },
+          /*120 */ { "SpinnerHboDots", e_st_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, MinFade{0.f}, ScaleY{0.f}, Speed{S(1.1f) * velocity}, Dots{DT(10)}); } },
+          /*121 */ { "SpinnerHboDots2", e_st_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(1.1f) * velocity}, Dots{DT(2)}); } },
+          /*122 */ { "SpinnerHboDots4", e_st_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(1.1f) * velocity}, Dots{DT(3)}); } },
+          /*123 */ { "SpinnerDnaDotsH", e_st_dna_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dna_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(2) * velocity}, Dots{DT(8)}, Delta{D(0.25f)}); } },
+          /*124 */ { "SpinnerDnaDotsV", e_st_dna_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dna_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(2) * velocity}, Dots{DT(8)}, Delta{D(0.25f)}, Reverse{true}); } },
+          /*125 */ { "SpinnerRotateDots2", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{ImMax<int>(int(ImSin(detail::AnimTime(0.5f)) * 8), 3)}); } },
+          /*126 */ { "SpinnerSevenSegments", e_st_seven_segments, [] (const char *label) { ImSpinner::Spinner<e_st_seven_segments>(label,
+                                                          Text{"012345679ABCDEF"}, Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}); } },
+          /*127 */ { "SpinnerSolarBalls", e_st_solar_balls, [] (const char *label) { ImSpinner::Spinner<e_st_solar_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(red)}, BgColor{CB(white)}, Speed{S(5) * velocity}, Dots{DT(4)}); } },
+          /*128 */ { "SpinnerSolarArcs", e_st_solar_arcs, [] (const char *label) { ImSpinner::Spinner<e_st_solar_arcs>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(red)}, BgColor{CB(white)}, Speed{S(5) * velocity}, Dots{DT(4)}); } },
+          /*129 */ { "Spinner", e_st_rainbow, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(3)}); } },
+          /*130 */ { "SpinnerRotatedHeart", e_st_rotating_heart, [] (const char *label) { ImSpinner::Spinner<e_st_rotating_heart>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(red)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}); } },
+          /*131 */ { "SpinnerSolarScaleBalls", e_st_solar_scale_balls, [] (const char *label) { ImSpinner::Spinner<e_st_solar_scale_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1.3f)}, Color{C(red)}, Speed{S(1) * velocity}, Dots{DT(36)}); } },
+          /*132 */ { "SpinnerOrionDots", e_st_orion_dots, [] (const char *label) { ImSpinner::Spinner<e_st_orion_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(1.3f)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(12)}); } },
+          /*133 */ { "SpinnerGalaxyDots", e_st_galaxy_dots, [] (const char *label) { ImSpinner::Spinner<e_st_galaxy_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(1.3f)}, Color{C(white)}, Speed{S(0.2f) * velocity}, Dots{DT(6)}); } },
+          /*134 */ { "SpinnerAsciiSymbolPoints", e_st_ascii_symbol_points, [] (const char *label) { ImSpinner::Spinner<e_st_ascii_symbol_points>(label,
+                                                          Text{"012345679ABCDEF"}, Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}); } },
+          /*135 */ { "SpinnerRainbowCircle", e_st_rainbow_circle, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(ImColor::HSV(0.25f, 0.8f, 0.8f))}, Speed{S(1) * velocity}, Dots{DT(4)}); } },
+          /*136 */ { "SpinnerRainbowCircle2", e_st_rainbow_circle, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(hue * 0.001f, 0.8f, 0.8f)}, Speed{S(2) * velocity}, Dots{DT(8)}, Delta{D(0)}); } },
+          /*137 */ { "SpinnerVDots2", e_st_vdots, [] (const char *label) { ImSpinner::Spinner<e_st_vdots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.1f) * velocity}, Dots{DT(2)}, MiddleDots{6}); } },
+          /*138 */ { "SpinnerVDots3", e_st_vdots, [] (const char *label) { ImSpinner::Spinner<e_st_vdots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.9f) * velocity}, Dots{DT(3)}, MiddleDots{6}); } },
+          /*139 */ { "SpinnerSquareRandomDots", e_st_square_random_dots, [] (const char *label) { ImSpinner::Spinner<e_st_square_random_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.8f)}, Color{C(ImColor(255, 255, 255, 30))}, BgColor{CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f))}, Speed{S(5) * velocity}); } },
+          /*140 */ { "SpinnerFluidPoints", e_st_fluid_points, [] (const char *label) { ImSpinner::Spinner<e_st_fluid_points>(label,
+                                                          Radius{R(16)}, Thickness{T(2.8f)}, Color{C(ImColor(0, 0, 255))}, Speed{S(3.8f) * velocity}, Dots{Dots{DT(4)}}, Delta{D(0.45f)}); } },
+          /*141 */ { "SpinnerDotsLoading", e_st_dots_loading, [] (const char *label) { ImSpinner::Spinner<e_st_dots_loading>(label,
+                                                          Radius{R(16)}, Thickness{T(4.f)}, Color{C(white)}, BgColor{CB(white)}, Speed{S(2.f) * velocity}); } },
+          /*142 */ { "SpinnerDotsToPoints", e_st_dots_to_points, [] (const char *label) { ImSpinner::Spinner<e_st_dots_to_points>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Delta{D(0.5f)}, Color{C(ImColor::HSV(0.31f, 0.8f, 0.8f))}, Speed{S(1.8) * velocity}, Dots{DT(5)}); } },
+          /*143 */ { "SpinnerThreeDots", e_st_three_dots, [] (const char *label) { ImSpinner::Spinner<e_st_three_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(8)}); } },
+          /*144 */ { "Spinner4Caleidospcope", e_st_4_caleidospcope, [] (const char *label) { ImSpinner::Spinner<e_st_4_caleidospcope>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{ImColor::HSV(hue * 0.0031f, 0.8f, 0.8f)}, Speed{S(4) * velocity}, Dots{DT(8)}); } },
+          /*145 */ { "SpinnerSixDots", e_st_five_dots, [] (const char *label) { ImSpinner::Spinner<e_st_five_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(8)}); } },
+          /*146 */ { "SpinnerFillingMem", e_st_filling_mem, [] (const char *label) { ImSpinner::SpinnerFillingMem(label,
+                                                          R(16), T(6), ImColor::HSV(hue * 0.001f, 0.8f, 0.8f), spinner_filling_meb_bg, S(4) * velocity); } },
+          /*147 */ { "SpinnerHerbertBalls", e_st_herbert_balls, [] (const char *label) { ImSpinner::Spinner<e_st_herbert_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(2.3f)}, Color{C(white)}, Speed{S(2.f) * velocity}, Dots{DT(4)}); } },
+          /*148 */ { "SpinnerHerbertBalls3D", e_st_herbert_balls3_d, [] (const char *label) { ImSpinner::Spinner<e_st_herbert_balls3_d>(label,
+                                                          Radius{R(16)}, Thickness{T(3.f)}, Color{C(white)}, Speed{S(1.4f) * velocity}); } },
+          /*149 */ { "SpinnerSquareLoanding", e_st_square_loading, [] (const char *label) { ImSpinner::Spinner<e_st_square_loading>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}); } },
+          /*150 */ { "SpinnerTextFading", e_st_text_fading, [] (const char *label) { ImSpinner::Spinner<e_st_text_fading>(label,
+                                                          Text{"Loading"}, Radius{R(16)}, Thickness{T(15)}, Color{C(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(4) * velocity}); } },
+          /*151 */ { "SpinnerBarChartAdvSine", e_st_bar_chart_adv_sine, [] (const char *label) { ImSpinner::Spinner<e_st_bar_chart_adv_sine>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(4.8f) * velocity}, Mode{0}); } },
+          /*152 */ { "SpinnerBarChartAdvSineFade", e_st_bar_chart_adv_sine_fade, [] (const char *label) { ImSpinner::Spinner<e_st_bar_chart_adv_sine_fade>(label,
+                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(4.8f) * velocity}, Mode{0}); } },
+          /*153 */ { "SpinnerMovingArcs", e_st_moving_arcs, [] (const char *label) { ImSpinner::Spinner<e_st_moving_arcs>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(2) * velocity}, Dots{DT(4)}); } },
+          /*154 */ { "SpinnerFadeTris", e_st_fade_tris, [] (const char *label) { ImSpinner::Spinner<e_st_fade_tris>(label,
+                                                          Radius{R(20)}, Color{C(white)}, Speed{S(5.f) * velocity}, Dots{DT(2)}, Reverse{false}, Mode{M(0)}); } },
+          /*155 */ { "SpinnerBounceDots1", e_st_bounce_dots, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(6)}, Mode{M(1)}); } },
+          /*156 */ { "SpinnerRotateDots", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(16)}, Mode{1}); } },
+          /*157 */ { "SpinnerTwinAng360", e_st_twin_ang360, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang360>(label,
+                                                          Radius{R(16)}, Radius2{11}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{2.4f}, Speed2{2.1f}, Mode{1}); } },
+          /*158 */ { "SpinnerAngTwin1", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(18)}, Radius2{13}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(3) * velocity}, Angle{A(1.3)}, Dots{DT(3)}, Mode{1}); } },
+          /*159 */ { "SpinnerGooeyBalls", e_st_gooey_balls, [] (const char *label) { ImSpinner::Spinner<e_st_gooey_balls>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(2.f) * velocity}, Mode{1}); } },
+          /*160 */ { "SpinnerArcRotation", e_st_arc_rotation, [] (const char *label) { ImSpinner::Spinner<e_st_arc_rotation>(label,
+                                                          Radius{R(13)}, Thickness{T(2.5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(15)}, Mode{1}); } },
+          /*161 */ { "SpinnerAng90Gravity", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(1)}); } },
+          /*162 */ { "SpinnerAng90SinRad", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(8.f) * velocity}, Angle{A(0.75f * PI_2)}, Mode{M(2)}); } },
+          /*163 */ { "SpinnerSquishSquare", e_st_squish_square, [] (const char *label) { ImSpinner::Spinner<e_st_squish_square>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(8.f) * velocity}); } },
+          /*164 */ { "SpinnerBounceBall", e_st_pulsar_ball, [] (const char *label) { ImSpinner::Spinner<e_st_pulsar_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(1)}); } },
+          /*165 */ { "Spinner", e_st_rainbow_mix, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_mix>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(5)}, Mode{1}); } },
+          /*166 */ { "SpinnerAngMix", e_st_ang_mix, [] (const char *label) { ImSpinner::Spinner<e_st_ang_mix>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(8.f) * velocity}, Angle{A(IM_PI)}, Dots{DT(4)}, Mode{0}); } },
+          /*167 */ { "SpinnerAngMixGravity", e_st_ang_mix, [] (const char *label) { ImSpinner::Spinner<e_st_ang_mix>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_2)}, Dots{DT(6)}, Mode{1}); } },
+          /*168 */ { "SpinnerScaleBlocks", e_st_scale_blocks, [] (const char *label) { ImSpinner::Spinner<e_st_scale_blocks>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)}, Speed{S(5) * velocity}, Mode{1}); } },
+          /*169 */ { "SpinnerFadeDots3", e_st_fade_dots, [] (const char *label) { ImSpinner::Spinner<e_st_fade_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(8) * velocity}, Dots{DT(4)}, Mode{1}); } },
+          /*170 */ { "SpinnerFadeDots6", e_st_fade_dots, [] (const char *label) { ImSpinner::Spinner<e_st_fade_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(8) * velocity}, Dots{DT(4)}, Mode{1}); } },
+          /*171 */ { "SpinnerFadeDots2", e_st_fade_dots, [] (const char *label) { ImSpinner::Spinner<e_st_fade_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(5) * velocity}, Dots{DT(8)}); } },
+          /*172 */ { "SpinnerScaleDots2", e_st_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(8)}); } },
+          /*173 */ { "Spinner3SmuggleDots", e_st_3_smuggle_dots, [] (const char *label) { ImSpinner::Spinner<e_st_3_smuggle_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(8)}, Delta{D(0.25f)}, Reverse{true}); } },
+          /*174 */ { "SpinnerSimpleArcFade", e_st_simple_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_simple_arc_fade>(label,
+                                                          Radius{R(13)}, Thickness{T(2)}, Color{C(white)}, Speed{S(4) * velocity}); } },
+          /*175 */ { "SpinnerTwinHboDots", e_st_twin_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_twin_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(1.1f) * velocity}, Dots{DT(6)}, Delta{D(0.f)}); } },
+          /*176 */ { "SpinnerTwinHboDots2", e_st_twin_hbo_dots, [] (const char *label) { ImSpinner::Spinner<e_st_twin_hbo_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(3.1f) * velocity}, Dots{DT(3)}, Delta{D(-0.5f)}); } },
+          /*177 */ { "SpinnerThreeDotsStar", e_st_three_dots_star, [] (const char *label) { ImSpinner::Spinner<e_st_three_dots_star>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, MinFade{0.1f}, ScaleY{0.5f}, Speed{S(5.1f) * velocity}, Delta{D(-0.2f)}); } },
+          /*178 */ { "SpinnerSquareSpins", e_st_square_spins, [] (const char *label) { ImSpinner::Spinner<e_st_square_spins>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(2) * velocity}); } },
+          /*179 */ { "SpinnerMoonDots", e_st_moon_dots, [] (const char *label) { ImSpinner::Spinner<e_st_moon_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Color{C(white)}, BgColor{CB(ImColor(0, 0, 0))}, Speed{S(1.1f) * velocity}); } },
+          /*180 */ { "SpinnerFilledArcFade7", e_st_filled_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_filled_arc_fade>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(6) * velocity}, Dots{DT(6)}, Mode{1}); } },
+          /*181 */ { "SpinnerRotateSegmentsPulsar", e_st_rotate_segments_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.1f) * velocity}, Dots{DT(4)}, MiddleDots{MDT(2)}); } },
+          /*182 */ { "SpinnerRotateSegmentsPulsar2", e_st_rotate_segments_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.1f) * velocity}, Dots{DT(1)}, MiddleDots{MDT(3)}); } },
+          /*183 */ { "SpinnerRotateSegmentsPulsar3", e_st_rotate_segments_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.1f) * velocity}, Dots{DT(3)}, MiddleDots{MDT(3)}); } },
+          /*184 */ { "SpinnerPointsArcBounce", e_st_points_arc_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_points_arc_bounce>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(12)}, MiddleDots{1}, Speed2{0.f}); } },
+          /*185 */ { "SpinnerSomeScaleDots0", e_st_some_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_some_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(5.6f) * velocity}, Dots{6}, Mode{0}); } },
+          /*186 */ { "SpinnerSomeScaleDots1", e_st_some_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_some_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(6.6f) * velocity}, Dots{6}, Mode{1}); } },
+          /*187 */ { "SpinnerPointsArcBounce2", e_st_points_arc_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_points_arc_bounce>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(12)}, MiddleDots{1}, Speed2{0.5f}); } },
+          /*188 */ { "SpinnerPointsArcBounce3", e_st_points_arc_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_points_arc_bounce>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(12)}, MiddleDots{2}, Speed2{0.3f}); } },
+          /*189 */ { "SpinnerPointsArcBounce4", e_st_points_arc_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_points_arc_bounce>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(12)}, MiddleDots{3}, Speed2{0.3f}); } },
+          /*190 */ { "SpinnerTwinBlocks", e_st_twin_blocks, [] (const char *label) { ImSpinner::Spinner<e_st_twin_blocks>(label,
+                                                          Radius{R(16)}, Thickness{T(7)}, Color{C(ImColor(255, 255, 255, 30))}, BgColor{CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f))}, Speed{S(5) * velocity}); } },
+          /*191 */ { "SpinnerAng90", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(3)}); } },
+          /*192 */ { "SpinnerSplineAng90", e_st_spline_ang, [] (const char *label) { ImSpinner::Spinner<e_st_spline_ang>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(0)}); } },
+          /*193 */ { "SpinnerAngNoBg", e_st_ang, [] (const char *label) { ImSpinner::Spinner<e_st_ang>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(6) * velocity}, Angle{A(IM_PI)}, Mode{M(0)}); } },
+          /*194 */ { "SpinnerBounceDots2", e_st_bounce_dots, [] (const char *label) { ImSpinner::Spinner<e_st_bounce_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.5)}, Color{C(white)}, Speed{S(1) * velocity}, Dots{DT(6)}, Mode{M(2)}); } },
+          /*195 */ { "SpinnerRotateDots", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(1.3)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(6)}, Mode{M(0)}); } },
+          /*196 */ { "SpinnerRotateDots", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.3)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(5)}, Mode{M(2)}); } },
+          /*197 */ { "SpinnerTwinAng360", e_st_twin_ang360, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang360>(label,
+                                                          Radius{R(16)}, Radius2{11}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(4) * velocity}); } },
+          /*198 */ { "SpinnerDotsWoBg2", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          FloatPtr{&nextdot2}, Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.3f) * velocity}, Dots{DT(6)}, MinThickness{A(1.49f)}, Mode{M(0)}); } },
+          /*199 */ { "SpinnerDotsWoBg3", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          FloatPtr{&nextdot2}, Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.3f) * velocity}, Dots{DT(4)}, MinThickness{A(1.49f)}, Mode{M(1)}); } },
+          /*200 */ { "SpinnerIncScaleDots2", e_st_inc_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_inc_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(6.6f) * velocity}, Dots{DT(8)}, Angle{A(1.22)}, Mode{M(1)}); } },
+          /*201 */ { "SpinnerPulsar2", e_st_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1) * velocity}, Reverse{true}, Angle{A(PI_2)}, Mode{M(1)}); } },
+          /*202 */ { "SpinnerAngTwin4", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(16)}, Radius2{13}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(1.6f) * velocity}, Angle{A(3.14)}, Dots{DT(1)}, Mode{M(2)}); } },
+          /*203 */ { "SpinnerAngTwin5", e_st_ang_twin, [] (const char *label) { ImSpinner::Spinner<e_st_ang_twin>(label,
+                                                          Radius{R(14)}, Radius2{16}, Thickness{T(2)}, Color{C(ImColor(255, 0, 0))}, BgColor{CB(white)}, Speed{S(0.8f) * velocity}, Angle{A(1.57)}, Dots{DT(3)}, Mode{M(2)}); } },
+          /*204 */ { "SpinnerDotsX3", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.3)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(3)}, MinThickness{-1.f}, Mode{M(2)}); } },
+          /*205 */ { "SpinnerDotsX13", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(2.3)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(13)}, MinThickness{-1.f}, Mode{M(2)}); } },
+          /*206 */ { "SpinnerAng", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(2.8) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(4)}); } },
+          /*207 */ { "SpinnerTwinAngX", e_st_twin_ang180, [] (const char *label) { ImSpinner::Spinner<e_st_twin_ang180>(label,
+                                                          Radius{R(16)}, Radius2{12}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 0, 0))}, Speed{S(0.5f) * velocity}, Angle{A(PI_DIV_4)}, Mode{M(2)}); } },
+          /*208 */ { "SpinnerAng8", e_st_ang8, [] (const char *label) { ImSpinner::Spinner<e_st_ang8>(label,
+                                                          Radius{R(21)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(0)}, Speed{S(8.f) * velocity}, Angle{A(PI_DIV_4 * 6)}, Mode{M(3)}, Delta{D(0.5f)}); } },
+          /*209 */ { "SpinnerAng8.1", e_st_ang8, [] (const char *label) { ImSpinner::Spinner<e_st_ang8>(label,
+                                                          Radius{R(14.5)}, Thickness{T(2.5)}, Color{C(white)}, BgColor{CB(0)}, Speed{S(4) * velocity}, Angle{A(PI_DIV_4)}, Mode{M(4)}, Delta{D(0.5f)}); } },
+          /*210 */ { "SpinnerAng8.2", e_st_ang8, [] (const char *label) { ImSpinner::Spinner<e_st_ang8>(label,
+                                                          Radius{R(12)}, Thickness{T(2.5)}, Color{C(white)}, BgColor{CB(0)}, Speed{S(5) * velocity}, Angle{A(5.0f)}, Mode{M(5)}, Delta{D(0.75f)}); } },
+          /*211 */ { "SpinnerAng8.3", e_st_ang8, [] (const char *label) { ImSpinner::Spinner<e_st_ang8>(label,
+                                                          Radius{R(19)}, Thickness{T(2.5)}, Color{C(white)}, BgColor{CB(0)}, Speed{S(5) * velocity}, Angle{A(5.0f)}, Mode{M(0)}, Delta{D(0.70f)}); } },
+          /*212 */ { "SpinnerRotateDots", e_st_rotate_dots, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(4)}, Mode{M(3)}); } },
+          /*213 */ { "SpinnerDots/3", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(3)}); } },
+          /*214 */ { "SpinnerDots/4", e_st_dots, [] (const char *label) { ImSpinner::Spinner<e_st_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(4)}); } },
+          /*215 */ { "SpinnerVDots/1", e_st_vdots, [] (const char *label) { ImSpinner::Spinner<e_st_vdots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.7f) * velocity}, Dots{DT(12)}, MiddleDots{MDT(7)}, Mode{M(1)}); } },
+          /*216 */ { "SpinnerSinSquares/1", e_st_sin_squares, [] (const char *label) { ImSpinner::Spinner<e_st_sin_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(1)}); } },
+          /*217 */ { "SpinnerSinSquares/2", e_st_sin_squares, [] (const char *label) { ImSpinner::Spinner<e_st_sin_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*218 */ { "SpinnerCamera/1", e_st_camera, [] (const char *label) { ImSpinner::Spinner<e_st_camera>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Speed{S(2.8f) * velocity}, Dots{DT(4)}, Mode{M(1)}); } },
+          /*219 */ { "SpinnerCamera/1", e_st_camera, [] (const char *label) { ImSpinner::Spinner<e_st_camera>(label,
+                                                          Radius{R(16)}, Thickness{T(8)}, Speed{S(1.8f) * velocity}, Dots{DT(3)}, Mode{M(1)}); } },
+          /*220 */ { "SpinnerRotateSegments/1", e_st_rotate_segments, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments>(label,
+                                                          Radius{R(16)}, Thickness{T(1.4)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(1)}, MiddleDots{MDT(4)}, Mode{M(1)}); } },
+          /*221 */ { "SpinnerRotateSegments/1", e_st_rotate_segments, [] (const char *label) { ImSpinner::Spinner<e_st_rotate_segments>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, MiddleDots{MDT(1)}, Mode{M(1)}); } },
+          /*222 */ { "SpinnerAng", e_st_angle, [] (const char *label) { ImSpinner::Spinner<e_st_angle>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8) * velocity}, Angle{A(IM_PI)}, Mode{M(1)}); } },
+          /*223 */ { "SpinnerArcRotation/3", e_st_arc_rotation, [] (const char *label) { ImSpinner::Spinner<e_st_arc_rotation>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, Mode{M(3)}); } },
+          /*224 */ { "SpinnerArcFade/2", e_st_arc_fade, [] (const char *label) { ImSpinner::Spinner<e_st_arc_fade>(label,
+                                                          Radius{R(13)}, Thickness{T(5)}, Color{C(white)}, Speed{S(3) * velocity}, Dots{DT(4)}, Mode{M(1)}); } },
+          /*225 */ { "SpinnerIncScaleDots", e_st_inc_scale_dots, [] (const char *label) { ImSpinner::Spinner<e_st_inc_scale_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(4.6f) * velocity}, Dots{DT(16)}, Angle{A(1)}, Mode{M(5)}); } },
+          /*226 */ { "SpinnerTwinPulsar/5", e_st_twin_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_twin_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Dots{DT(5)}, Mode{M(5)}); } },
+          /*227 */ { "SpinnerTwinPulsar/0", e_st_twin_pulsar, [] (const char *label) { ImSpinner::Spinner<e_st_twin_pulsar>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Dots{DT(5)}, Mode{M(0)}); } },
+          /*228 */ { "SpinnerCircularLines/4", e_st_circular_lines, [] (const char *label) { ImSpinner::Spinner<e_st_circular_lines>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Dots{DT(16)}, Mode{M(4)}); } },
+          /*229 */ { "SpinnerRotatedAtom/5", e_st_rotated_atom, [] (const char *label) { ImSpinner::Spinner<e_st_rotated_atom>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(2)}, Mode{M(5)}); } },
+          /*230 */ { "SpinnerRotatedAtom/2", e_st_rotated_atom, [] (const char *label) { ImSpinner::Spinner<e_st_rotated_atom>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(2)}, Mode{M(1)}); } },
+          /*231 */ { "SpinnerRotatedAtom/2", e_st_rotated_atom, [] (const char *label) { ImSpinner::Spinner<e_st_rotated_atom>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(2.1f) * velocity}, Dots{DT(3)}, Mode{M(5)}); } },
+          /*232 */ { "SpinnerRainbowBalls/1", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(3)}, Mode{M(1)}, MiddleDots{MDT(1)}); } },
+          /*233 */ { "SpinnerRainbowBalls/5", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(4)}, Mode{M(5)}, MiddleDots{MDT(1)}); } },
+          /*234 */ { "SpinnerPointsRoller", e_st_points_roller, [] (const char *label) { ImSpinner::Spinner<e_st_points_roller>(label,
+                                                          Radius{R(16)}, Thickness{T(3.5)}, Color{C(white)}, Speed{S(1.4) * velocity}, Dots{DT(8)}, MiddleDots{MDT(1)}); } },
+          /*235 */ { "SpinnerPointsRoller2", e_st_points_roller, [] (const char *label) { ImSpinner::Spinner<e_st_points_roller>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.0) * velocity}, Dots{DT(18)}, MiddleDots{MDT(3)}); } },
+          /*236 */ { "SpinnerPointsRoller2", e_st_points_roller, [] (const char *label) { ImSpinner::Spinner<e_st_points_roller>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(1.0) * velocity}, Dots{DT(2)}, MiddleDots{MDT(12)}); } },
+          /*237 */ { "SpinnerThickToSin", e_st_thick_to_sin, [] (const char *label) { ImSpinner::Spinner<e_st_thick_to_sin>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, Speed{S(3) * velocity}, MiddleDots{MDT(1)}, Dots{DT(8)}, Mode{M(0)}); } },
+          /*238 */ { "SpinnerThickToSin2", e_st_thick_to_sin, [] (const char *label) { ImSpinner::Spinner<e_st_thick_to_sin>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(3) * velocity}, MiddleDots{MDT(1)}, Dots{DT(20)}, Mode{M(5)}); } },
+          /*239 */ { "SpinnerThickToSin2", e_st_thick_to_sin, [] (const char *label) { ImSpinner::Spinner<e_st_thick_to_sin>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(3) * velocity}, MiddleDots{MDT(1)}, Dots{DT(20)}, Mode{M(6)}); } },
+          /*240 */ { "SpinnerFadePulsarSquare", e_st_fade_pulsar_square, [] (const char *label) { ImSpinner::Spinner<e_st_fade_pulsar_square>(label,
+                                                          Radius{R(16)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Dots{DT(5)}, Mode{M(0)}); } },
+          /*241 */ { "SpinnerRainbowBalls1", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.4f) * velocity}, Dots{DT(9)}, Mode{M(1)}, MiddleDots{MDT(10)}, Ext{MX(1)}); } },
+          /*242 */ { "SpinnerRainbowBalls2", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(9)}, Mode{M(2)}, MiddleDots{MDT(16)}, Ext{MX(1)}); } },
+          /*243 */ { "SpinnerRainbowBalls3", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(9)}, Mode{M(6)}, MiddleDots{MDT(16)}, Ext{MX(1)}); } },
+          /*244 */ { "SpinnerRainbowBalls4", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(7)}, Mode{M(0)}, MiddleDots{MDT(24)}, Ext{MX(3)}); } },
+          /*245 */ { "SpinnerRainbowBalls5", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(17)}, Mode{M(4)}, MiddleDots{MDT(30)}, Ext{MX(4)}); } },
+          /*246 */ { "SpinnerRainbowBalls6", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(17)}, Mode{M(4)}, MiddleDots{MDT(30)}, Ext{MX(5)}); } },
+          /*247 */ { "SpinnerRainbowBalls7", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(17)}, Mode{M(4)}, MiddleDots{MDT(30)}, Ext{MX(6)}); } },
+          /*248 */ { "SpinnerRainbowBalls7", e_st_rainbow_balls, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_balls>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(0.9f) * velocity}, Dots{DT(4)}, Mode{M(0)}, MiddleDots{MDT(30)}, Ext{MX(8)}); } },
+          /*249 */ { "SpinnerRainbowShot2", e_st_rainbow_shot, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_shot>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(30)}, Mode{M(1)}); } },
+          /*250 */ { "SpinnerRainbowShot3", e_st_rainbow_shot, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_shot>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(30)}, Mode{M(3)}); } },
+          /*251 */ { "SpinnerRainbowShot2", e_st_rainbow_shot, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_shot>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(30)}, Mode{M(5)}); } },
+          /*252 */ { "SpinnerRainbowShot2", e_st_rainbow_shot, [] (const char *label) { ImSpinner::Spinner<e_st_rainbow_shot>(label,
+                                                          Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f)}, Speed{S(1.5f) * velocity}, Dots{DT(30)}, Mode{M(6)}); } },
+          /*253 */ { "SpinnerTextFade", e_st_text_fade, [] (const char *label) { ImSpinner::Spinner<e_st_text_fade>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*254 */ { "SpinnerTextUnderline", e_st_text_underline, [] (const char *label) { ImSpinner::Spinner<e_st_text_underline>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Thickness{T(3)}, Text{"Loading..."}); } },
+          /*255 */ { "SpinnerTextUnderlineDots", e_st_text_underline_dots, [] (const char *label) { ImSpinner::Spinner<e_st_text_underline_dots>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Thickness{T(3)}, Dots{DT(6)}, Text{"Loading..."}); } },
+          /*256 */ { "SpinnerTextTyping", e_st_text_typing, [] (const char *label) { ImSpinner::Spinner<e_st_text_typing>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Dots{DT(3)}, Text{"Loading..."}); } },
+          /*257 */ { "SpinnerTextTypingFull", e_st_text_typing, [] (const char *label) { ImSpinner::Spinner<e_st_text_typing>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Dots{DT(10)}, Text{"Loading..."}); } },
+          /*258 */ { "SpinnerTextScroll", e_st_text_scroll, [] (const char *label) { ImSpinner::Spinner<e_st_text_scroll>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*259 */ { "SpinnerTextColorFill", e_st_text_color_fill, [] (const char *label) { ImSpinner::Spinner<e_st_text_color_fill>(label,
+                                                          Radius{R(30)}, Color{C(ImColor(0xC0, 0x29, 0x42))}, BgColor{CB(white)}, Speed{S(0.5f) * velocity}, Mode{M(0)}, Text{"Loading..."}); } },
+          /*260 */ { "SpinnerTextColorHighlight", e_st_text_color_fill, [] (const char *label) { ImSpinner::Spinner<e_st_text_color_fill>(label,
+                                                          Radius{R(30)}, Color{C(ImColor(0xC0, 0x29, 0x42))}, BgColor{CB(white)}, Speed{S(0.5f) * velocity}, Mode{M(1)}, Text{"Loading..."}); } },
+          /*261 */ { "SpinnerTextScrollColors", e_st_text_scroll_colors, [] (const char *label) { ImSpinner::Spinner<e_st_text_scroll_colors>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.2f) * velocity}, Text{"Loading..."}); } },
+          /*262 */ { "SpinnerTextColorCycle", e_st_text_color_cycle, [] (const char *label) { ImSpinner::Spinner<e_st_text_color_cycle>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.2f) * velocity}, Text{"Loading..."}); } },
+          /*263 */ { "SpinnerTextBounce", e_st_text_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_text_bounce>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*264 */ { "SpinnerTextSplit", e_st_text_split, [] (const char *label) { ImSpinner::Spinner<e_st_text_split>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}, Text{"Loading..."}); } },
+          /*265 */ { "SpinnerTextSplitDelay", e_st_text_split, [] (const char *label) { ImSpinner::Spinner<e_st_text_split>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Mode{M(1)}, Text{"Loading..."}); } },
+          /*266 */ { "SpinnerTextUnderlineScroll", e_st_text_underline_scroll, [] (const char *label) { ImSpinner::Spinner<e_st_text_underline_scroll>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.66f) * velocity}, Thickness{T(3)}, Text{"Loading..."}); } },
+          /*267 */ { "SpinnerTextRoll", e_st_text_roll, [] (const char *label) { ImSpinner::Spinner<e_st_text_roll>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*268 */ { "SpinnerTextColorful", e_st_text_colorful, [] (const char *label) { ImSpinner::Spinner<e_st_text_colorful>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*269 */ { "SpinnerTextCascade", e_st_text_cascade, [] (const char *label) { ImSpinner::Spinner<e_st_text_cascade>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*270 */ { "SpinnerTextConveyor", e_st_text_conveyor, [] (const char *label) { ImSpinner::Spinner<e_st_text_conveyor>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.33f) * velocity}, Text{"Loading..."}); } },
+          /*271 */ { "SpinnerTextReveal", e_st_text_reveal, [] (const char *label) { ImSpinner::Spinner<e_st_text_reveal>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*272 */ { "SpinnerTextWave", e_st_text_wave, [] (const char *label) { ImSpinner::Spinner<e_st_text_wave>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*273 */ { "SpinnerTextSweep", e_st_text_sweep, [] (const char *label) { ImSpinner::Spinner<e_st_text_sweep>(label,
+                                                          Radius{R(30)}, Color{C(white)}, BgColor{CB(ImColor(0, 0, 0))}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*274 */ { "SpinnerTextShine", e_st_text_shine, [] (const char *label) { ImSpinner::Spinner<e_st_text_shine>(label,
+                                                          Radius{R(30)}, Color{C(white)}, BgColor{CB(ImColor(0, 0, 0))}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*275 */ { "SpinnerTextScrollSweep", e_st_text_scroll_sweep, [] (const char *label) { ImSpinner::Spinner<e_st_text_scroll_sweep>(label,
+                                                          Radius{R(30)}, Color{C(white)}, BgColor{CB(ImColor(0, 0, 0))}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*276 */ { "SpinnerTextSpotlight", e_st_text_spotlight, [] (const char *label) { ImSpinner::Spinner<e_st_text_spotlight>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*277 */ { "SpinnerTextShake", e_st_text_shake, [] (const char *label) { ImSpinner::Spinner<e_st_text_shake>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}, Text{"Loading..."}); } },
+          /*278 */ { "SpinnerTextShakeSmooth", e_st_text_shake, [] (const char *label) { ImSpinner::Spinner<e_st_text_shake>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(1)}, Text{"Loading..."}); } },
+          /*279 */ { "SpinnerTextFlip", e_st_text_flip, [] (const char *label) { ImSpinner::Spinner<e_st_text_flip>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*280 */ { "SpinnerTextSpin", e_st_text_spin, [] (const char *label) { ImSpinner::Spinner<e_st_text_spin>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*281 */ { "SpinnerTextTumble", e_st_text_tumble, [] (const char *label) { ImSpinner::Spinner<e_st_text_tumble>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Mode{M(0)}, Text{"Loading..."}); } },
+          /*282 */ { "SpinnerTextTumblePersp", e_st_text_tumble, [] (const char *label) { ImSpinner::Spinner<e_st_text_tumble>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Mode{M(1)}, Text{"Loading..."}); } },
+          /*283 */ { "SpinnerTextSwirl", e_st_text_swirl, [] (const char *label) { ImSpinner::Spinner<e_st_text_swirl>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*284 */ { "SpinnerTextRollWave", e_st_text_roll_wave, [] (const char *label) { ImSpinner::Spinner<e_st_text_roll_wave>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*285 */ { "SpinnerTextVibrate", e_st_text_vibrate, [] (const char *label) { ImSpinner::Spinner<e_st_text_vibrate>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*286 */ { "SpinnerTextGlitch", e_st_text_glitch, [] (const char *label) { ImSpinner::Spinner<e_st_text_glitch>(label,
+                                                          Radius{R(30)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*287 */ { "SpinnerTextBlur", e_st_text_blur, [] (const char *label) { ImSpinner::Spinner<e_st_text_blur>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*288 */ { "SpinnerTextDropout", e_st_text_dropout, [] (const char *label) { ImSpinner::Spinner<e_st_text_dropout>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*289 */ { "SpinnerTextScanline", e_st_text_scanline, [] (const char *label) { ImSpinner::Spinner<e_st_text_scanline>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}, Text{"Loading..."}); } },
+          /*290 */ { "SpinnerTextScanlineV", e_st_text_scanline, [] (const char *label) { ImSpinner::Spinner<e_st_text_scanline>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(1)}, Text{"Loading..."}); } },
+          /*291 */ { "SpinnerTextSquash", e_st_text_squash, [] (const char *label) { ImSpinner::Spinner<e_st_text_squash>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}, Text{"Loading..."}); } },
+          /*292 */ { "SpinnerTextScramble", e_st_text_scramble, [] (const char *label) { ImSpinner::Spinner<e_st_text_scramble>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*293 */ { "SpinnerTextDecode", e_st_text_decode, [] (const char *label) { ImSpinner::Spinner<e_st_text_decode>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*294 */ { "SpinnerTextVanish", e_st_text_vanish, [] (const char *label) { ImSpinner::Spinner<e_st_text_vanish>(label,
+                                                          Radius{R(30)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Text{"Loading..."}); } },
+          /*295 */ { "SpinnerDotsTyping", e_st_dots_typing, [] (const char *label) { ImSpinner::Spinner<e_st_dots_typing>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Dots{DT(3)}); } },
+          /*296 */ { "SpinnerDotsStep", e_st_dots_step, [] (const char *label) { ImSpinner::Spinner<e_st_dots_step>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Dots{DT(3)}); } },
+          /*297 */ { "SpinnerDotsGather", e_st_dots_gather, [] (const char *label) { ImSpinner::Spinner<e_st_dots_gather>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.5f) * velocity}, Dots{DT(3)}); } },
+          /*298 */ { "SpinnerDotsShift", e_st_dots_shift, [] (const char *label) { ImSpinner::Spinner<e_st_dots_shift>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.5f) * velocity}); } },
+          /*299 */ { "SpinnerDotsOrbit", e_st_dots_orbit, [] (const char *label) { ImSpinner::Spinner<e_st_dots_orbit>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.66f) * velocity}); } },
+          /*300 */ { "SpinnerDotsCircle", e_st_dots_circle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_circle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.66f) * velocity}); } },
+          /*301 */ { "SpinnerDotsSquare", e_st_dots_square, [] (const char *label) { ImSpinner::Spinner<e_st_dots_square>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*302 */ { "SpinnerDotsShuffle", e_st_dots_shuffle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_shuffle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*303 */ { "SpinnerDotsSplit", e_st_dots_split, [] (const char *label) { ImSpinner::Spinner<e_st_dots_split>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*304 */ { "SpinnerDotsLeader", e_st_dots_leader, [] (const char *label) { ImSpinner::Spinner<e_st_dots_leader>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*305 */ { "SpinnerDotsRolling", e_st_dots_rolling, [] (const char *label) { ImSpinner::Spinner<e_st_dots_rolling>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*306 */ { "SpinnerDotsTriangle", e_st_dots_triangle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_triangle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*307 */ { "SpinnerDotsCascade", e_st_dots_cascade, [] (const char *label) { ImSpinner::Spinner<e_st_dots_cascade>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*308 */ { "SpinnerDotsSwap", e_st_dots_swap, [] (const char *label) { ImSpinner::Spinner<e_st_dots_swap>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*309 */ { "SpinnerDotsSpread", e_st_dots_spread, [] (const char *label) { ImSpinner::Spinner<e_st_dots_spread>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*310 */ { "SpinnerDotsTwin", e_st_dots_twin, [] (const char *label) { ImSpinner::Spinner<e_st_dots_twin>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.5f) * velocity}); } },
+          /*311 */ { "SpinnerDotsHop", e_st_dots_hop, [] (const char *label) { ImSpinner::Spinner<e_st_dots_hop>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f / 1.5f) * velocity}); } },
+          /*312 */ { "SpinnerDotsJiggle", e_st_dots_jiggle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_jiggle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*313 */ { "SpinnerDotsVibrate", e_st_dots_vibrate, [] (const char *label) { ImSpinner::Spinner<e_st_dots_vibrate>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*314 */ { "SpinnerDotsWiper", e_st_dots_wiper, [] (const char *label) { ImSpinner::Spinner<e_st_dots_wiper>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(2.f) * velocity}); } },
+          /*315 */ { "SpinnerDotsCollapse", e_st_dots_collapse, [] (const char *label) { ImSpinner::Spinner<e_st_dots_collapse>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(0.5f) * velocity}); } },
+          /*316 */ { "SpinnerDotsFlip", e_st_dots_flip, [] (const char *label) { ImSpinner::Spinner<e_st_dots_flip>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*317 */ { "SpinnerDotsTurn", e_st_dots_turn, [] (const char *label) { ImSpinner::Spinner<e_st_dots_turn>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*318 */ { "SpinnerDotsCarousel", e_st_dots_carousel, [] (const char *label) { ImSpinner::Spinner<e_st_dots_carousel>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*319 */ { "SpinnerDotsHalfTurn", e_st_dots_half_turn, [] (const char *label) { ImSpinner::Spinner<e_st_dots_half_turn>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*320 */ { "SpinnerDotsSlideFlip", e_st_dots_slide_flip, [] (const char *label) { ImSpinner::Spinner<e_st_dots_slide_flip>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*321 */ { "SpinnerDotsStaggerTurn", e_st_dots_stagger_turn, [] (const char *label) { ImSpinner::Spinner<e_st_dots_stagger_turn>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*322 */ { "SpinnerDotsStretch", e_st_dots_stretch, [] (const char *label) { ImSpinner::Spinner<e_st_dots_stretch>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*323 */ { "SpinnerDotsMirrorStretch", e_st_dots_mirror_stretch, [] (const char *label) { ImSpinner::Spinner<e_st_dots_mirror_stretch>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*324 */ { "SpinnerDotsPinch", e_st_dots_pinch, [] (const char *label) { ImSpinner::Spinner<e_st_dots_pinch>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*325 */ { "SpinnerDotsCorners", e_st_dots_corners, [] (const char *label) { ImSpinner::Spinner<e_st_dots_corners>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(2.f) * velocity}); } },
+          /*326 */ { "SpinnerDotsNudgeRotate", e_st_dots_nudge_rotate, [] (const char *label) { ImSpinner::Spinner<e_st_dots_nudge_rotate>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*327 */ { "SpinnerDotsUnfold", e_st_dots_unfold, [] (const char *label) { ImSpinner::Spinner<e_st_dots_unfold>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*328 */ { "SpinnerDotsShuttle", e_st_dots_shuttle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_shuttle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*329 */ { "SpinnerDotsSpreadShuttle", e_st_dots_spread_shuttle, [] (const char *label) { ImSpinner::Spinner<e_st_dots_spread_shuttle>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*330 */ { "SpinnerDotsTriad", e_st_dots_triad, [] (const char *label) { ImSpinner::Spinner<e_st_dots_triad>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*331 */ { "SpinnerDotsSatellite", e_st_dots_satellite, [] (const char *label) { ImSpinner::Spinner<e_st_dots_satellite>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*332 */ { "SpinnerDotsTrack", e_st_dots_track, [] (const char *label) { ImSpinner::Spinner<e_st_dots_track>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}); } },
+          /*333 */ { "SpinnerBarsSeqPulse", e_st_bars_seq_pulse, [] (const char *label) { ImSpinner::Spinner<e_st_bars_seq_pulse>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*334 */ { "SpinnerBarsCascadeGrow", e_st_bars_cascade_grow, [] (const char *label) { ImSpinner::Spinner<e_st_bars_cascade_grow>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*335 */ { "SpinnerBarsRise", e_st_bars_rise, [] (const char *label) { ImSpinner::Spinner<e_st_bars_rise>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*336 */ { "SpinnerBarsCornerHop", e_st_bars_corner_hop, [] (const char *label) { ImSpinner::Spinner<e_st_bars_corner_hop>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*337 */ { "SpinnerBarsDiagonalGrow", e_st_bars_diagonal_grow, [] (const char *label) { ImSpinner::Spinner<e_st_bars_diagonal_grow>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*338 */ { "SpinnerBarsBounceCenter", e_st_bars_bounce_center, [] (const char *label) { ImSpinner::Spinner<e_st_bars_bounce_center>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*339 */ { "SpinnerBarsScaleAlt", e_st_bars_scale_alt, [] (const char *label) { ImSpinner::Spinner<e_st_bars_scale_alt>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*340 */ { "SpinnerBarsCornerWave", e_st_bars_corner_wave, [] (const char *label) { ImSpinner::Spinner<e_st_bars_corner_wave>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*341 */ { "SpinnerBarsJump", e_st_bars_jump, [] (const char *label) { ImSpinner::Spinner<e_st_bars_jump>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*342 */ { "SpinnerBarsDoubleRow", e_st_bars_double_row, [] (const char *label) { ImSpinner::Spinner<e_st_bars_double_row>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*343 */ { "SpinnerBarsSixPulse", e_st_bars_six_pulse, [] (const char *label) { ImSpinner::Spinner<e_st_bars_six_pulse>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*344 */ { "SpinnerBarsSixStagger", e_st_bars_six_stagger, [] (const char *label) { ImSpinner::Spinner<e_st_bars_six_stagger>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*345 */ { "SpinnerBarsMorphPlus", e_st_bars_morph_plus, [] (const char *label) { ImSpinner::Spinner<e_st_bars_morph_plus>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*346 */ { "SpinnerBarsFlipSix", e_st_bars_flip_six, [] (const char *label) { ImSpinner::Spinner<e_st_bars_flip_six>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*347 */ { "SpinnerBarsSwapTriBottom", e_st_bars_swap_tri_bottom, [] (const char *label) { ImSpinner::Spinner<e_st_bars_swap_tri_bottom>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*348 */ { "SpinnerBarsSwapTriZigzag", e_st_bars_swap_tri_zigzag, [] (const char *label) { ImSpinner::Spinner<e_st_bars_swap_tri_zigzag>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*349 */ { "SpinnerBarsMorphDiagonal", e_st_bars_morph_diagonal, [] (const char *label) { ImSpinner::Spinner<e_st_bars_morph_diagonal>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*350 */ { "SpinnerBarsSlideDiagonal", e_st_bars_slide_diagonal, [] (const char *label) { ImSpinner::Spinner<e_st_bars_slide_diagonal>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*351 */ { "SpinnerBarsConicAlternate", e_st_bars_conic_alternate, [] (const char *label) { ImSpinner::Spinner<e_st_bars_conic_alternate>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*352 */ { "SpinnerBarsConicWalk", e_st_bars_conic_walk, [] (const char *label) { ImSpinner::Spinner<e_st_bars_conic_walk>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Mode{M(0)}); } },
+          /*353 */ { "SpinnerBarsMarchIn", e_st_bars_march_in, [] (const char *label) { ImSpinner::Spinner<e_st_bars_march_in>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*354 */ { "SpinnerBarsMarchDown", e_st_bars_march_down, [] (const char *label) { ImSpinner::Spinner<e_st_bars_march_down>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*355 */ { "SpinnerBarsWaveSkew", e_st_bars_wave_skew, [] (const char *label) { ImSpinner::Spinner<e_st_bars_wave_skew>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*356 */ { "SpinnerBarsRowDrop", e_st_bars_row_drop, [] (const char *label) { ImSpinner::Spinner<e_st_bars_row_drop>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*357 */ { "SpinnerBarsZigzagRows", e_st_bars_zigzag_rows, [] (const char *label) { ImSpinner::Spinner<e_st_bars_zigzag_rows>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*358 */ { "SpinnerBarsFillCascade", e_st_bars_fill_cascade, [] (const char *label) { ImSpinner::Spinner<e_st_bars_fill_cascade>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*359 */ { "SpinnerBarsPingPongRows", e_st_bars_ping_pong_rows, [] (const char *label) { ImSpinner::Spinner<e_st_bars_ping_pong_rows>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*360 */ { "SpinnerBarsWaveRowsWide", e_st_bars_wave_rows_wide, [] (const char *label) { ImSpinner::Spinner<e_st_bars_wave_rows_wide>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*361 */ { "SpinnerBarsGridFade", e_st_bars_grid_fade, [] (const char *label) { ImSpinner::Spinner<e_st_bars_grid_fade>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*362 */ { "SpinnerBarsGridSpread", e_st_bars_grid_spread, [] (const char *label) { ImSpinner::Spinner<e_st_bars_grid_spread>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*363 */ { "SpinnerBarsSeqPulseM1", e_st_bars_seq_pulse, [] (const char *label) { ImSpinner::Spinner<e_st_bars_seq_pulse>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*364 */ { "SpinnerBarsCascadeGrowM1", e_st_bars_cascade_grow, [] (const char *label) { ImSpinner::Spinner<e_st_bars_cascade_grow>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*365 */ { "SpinnerBarsRiseM1", e_st_bars_rise, [] (const char *label) { ImSpinner::Spinner<e_st_bars_rise>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*366 */ { "SpinnerBarsCornerHopM1", e_st_bars_corner_hop, [] (const char *label) { ImSpinner::Spinner<e_st_bars_corner_hop>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*367 */ { "SpinnerBarsDiagonalGrowM1", e_st_bars_diagonal_grow, [] (const char *label) { ImSpinner::Spinner<e_st_bars_diagonal_grow>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*368 */ { "SpinnerBarsBounceCenterM1", e_st_bars_bounce_center, [] (const char *label) { ImSpinner::Spinner<e_st_bars_bounce_center>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*369 */ { "SpinnerBarsScaleAltM1", e_st_bars_scale_alt, [] (const char *label) { ImSpinner::Spinner<e_st_bars_scale_alt>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*370 */ { "SpinnerBarsCornerWaveM1", e_st_bars_corner_wave, [] (const char *label) { ImSpinner::Spinner<e_st_bars_corner_wave>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*371 */ { "SpinnerBarsJumpM1", e_st_bars_jump, [] (const char *label) { ImSpinner::Spinner<e_st_bars_jump>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*372 */ { "SpinnerBarsDoubleRowM1", e_st_bars_double_row, [] (const char *label) { ImSpinner::Spinner<e_st_bars_double_row>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*373 */ { "SpinnerBarsSixPulseM1", e_st_bars_six_pulse, [] (const char *label) { ImSpinner::Spinner<e_st_bars_six_pulse>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*374 */ { "SpinnerBarsSixStaggerM1", e_st_bars_six_stagger, [] (const char *label) { ImSpinner::Spinner<e_st_bars_six_stagger>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*375 */ { "SpinnerBarsMorphPlusM1", e_st_bars_morph_plus, [] (const char *label) { ImSpinner::Spinner<e_st_bars_morph_plus>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*376 */ { "SpinnerBarsFlipSixM1", e_st_bars_flip_six, [] (const char *label) { ImSpinner::Spinner<e_st_bars_flip_six>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*377 */ { "SpinnerBarsSwapTriBottomM1", e_st_bars_swap_tri_bottom, [] (const char *label) { ImSpinner::Spinner<e_st_bars_swap_tri_bottom>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*378 */ { "SpinnerBarsSwapTriZigzagM1", e_st_bars_swap_tri_zigzag, [] (const char *label) { ImSpinner::Spinner<e_st_bars_swap_tri_zigzag>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*379 */ { "SpinnerBarsMorphDiagonalM1", e_st_bars_morph_diagonal, [] (const char *label) { ImSpinner::Spinner<e_st_bars_morph_diagonal>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*380 */ { "SpinnerBarsSlideDiagonalM1", e_st_bars_slide_diagonal, [] (const char *label) { ImSpinner::Spinner<e_st_bars_slide_diagonal>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*381 */ { "SpinnerBarsConicAlternateM1", e_st_bars_conic_alternate, [] (const char *label) { ImSpinner::Spinner<e_st_bars_conic_alternate>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*382 */ { "SpinnerBarsConicWalkM1", e_st_bars_conic_walk, [] (const char *label) { ImSpinner::Spinner<e_st_bars_conic_walk>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.5f) * velocity}, Mode{M(2)}); } },
+          /*383 */ { "SpinnerBarsMarchInM1", e_st_bars_march_in, [] (const char *label) { ImSpinner::Spinner<e_st_bars_march_in>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*384 */ { "SpinnerBarsMarchDownM1", e_st_bars_march_down, [] (const char *label) { ImSpinner::Spinner<e_st_bars_march_down>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*385 */ { "SpinnerBarsWaveSkewM1", e_st_bars_wave_skew, [] (const char *label) { ImSpinner::Spinner<e_st_bars_wave_skew>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*386 */ { "SpinnerBarsRowDropM1", e_st_bars_row_drop, [] (const char *label) { ImSpinner::Spinner<e_st_bars_row_drop>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*387 */ { "SpinnerBarsZigzagRowsM1", e_st_bars_zigzag_rows, [] (const char *label) { ImSpinner::Spinner<e_st_bars_zigzag_rows>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*388 */ { "SpinnerBarsFillCascadeM1", e_st_bars_fill_cascade, [] (const char *label) { ImSpinner::Spinner<e_st_bars_fill_cascade>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*389 */ { "SpinnerBarsPingPongRowsM1", e_st_bars_ping_pong_rows, [] (const char *label) { ImSpinner::Spinner<e_st_bars_ping_pong_rows>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*390 */ { "SpinnerBarsWaveRowsWideM1", e_st_bars_wave_rows_wide, [] (const char *label) { ImSpinner::Spinner<e_st_bars_wave_rows_wide>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*391 */ { "SpinnerBarsGridFadeM1", e_st_bars_grid_fade, [] (const char *label) { ImSpinner::Spinner<e_st_bars_grid_fade>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*392 */ { "SpinnerBarsGridSpreadM1", e_st_bars_grid_spread, [] (const char *label) { ImSpinner::Spinner<e_st_bars_grid_spread>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(2)}); } },
+          /*393 */ { "SpinnerBarsStretch", e_st_bars_stretch, [] (const char *label) { ImSpinner::Spinner<e_st_bars_stretch>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*394 */ { "SpinnerBarsStretchSeq", e_st_bars_stretch_seq, [] (const char *label) { ImSpinner::Spinner<e_st_bars_stretch_seq>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*395 */ { "SpinnerBarsBounceBall", e_st_bars_bounce_ball, [] (const char *label) { ImSpinner::Spinner<e_st_bars_bounce_ball>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*396 */ { "SpinnerBarsKnockDots", e_st_bars_knock_dots, [] (const char *label) { ImSpinner::Spinner<e_st_bars_knock_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*397 */ { "SpinnerBarsStaircase", e_st_bars_staircase, [] (const char *label) { ImSpinner::Spinner<e_st_bars_staircase>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*398 */ { "SpinnerBarsKnockAway", e_st_bars_knock_away, [] (const char *label) { ImSpinner::Spinner<e_st_bars_knock_away>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*399 */ { "SpinnerBarsGates", e_st_bars_gates, [] (const char *label) { ImSpinner::Spinner<e_st_bars_gates>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*400 */ { "SpinnerBarsCapture", e_st_bars_capture, [] (const char *label) { ImSpinner::Spinner<e_st_bars_capture>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*401 */ { "SpinnerBarsEscape", e_st_bars_escape, [] (const char *label) { ImSpinner::Spinner<e_st_bars_escape>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*402 */ { "SpinnerBarsDevour", e_st_bars_devour, [] (const char *label) { ImSpinner::Spinner<e_st_bars_devour>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*403 */ { "SpinnerBarsLift", e_st_bars_lift, [] (const char *label) { ImSpinner::Spinner<e_st_bars_lift>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*404 */ { "SpinnerBarsGapSlide", e_st_bars_gap_slide, [] (const char *label) { ImSpinner::Spinner<e_st_bars_gap_slide>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*405 */ { "SpinnerBarsConverge", e_st_bars_converge, [] (const char *label) { ImSpinner::Spinner<e_st_bars_converge>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*406 */ { "SpinnerBarsSwapEnds", e_st_bars_swap_ends, [] (const char *label) { ImSpinner::Spinner<e_st_bars_swap_ends>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*407 */ { "SpinnerBarsRelay", e_st_bars_relay, [] (const char *label) { ImSpinner::Spinner<e_st_bars_relay>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*408 */ { "SpinnerBarsPush", e_st_bars_push, [] (const char *label) { ImSpinner::Spinner<e_st_bars_push>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*409 */ { "SpinnerBarsPushWave", e_st_bars_push_wave, [] (const char *label) { ImSpinner::Spinner<e_st_bars_push_wave>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*410 */ { "SpinnerBarsGather", e_st_bars_gather, [] (const char *label) { ImSpinner::Spinner<e_st_bars_gather>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*411 */ { "SpinnerBarsSplit", e_st_bars_split, [] (const char *label) { ImSpinner::Spinner<e_st_bars_split>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*412 */ { "SpinnerBarsSlot", e_st_bars_slot, [] (const char *label) { ImSpinner::Spinner<e_st_bars_slot>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*413 */ { "SpinnerConicGrid", e_st_conic_grid, [] (const char *label) { ImSpinner::Spinner<e_st_conic_grid>(label,
+                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*414 */ { "SpinnerArcArrow", e_st_arc_arrow, [] (const char *label) { ImSpinner::Spinner<e_st_arc_arrow>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*415 */ { "SpinnerOrbitMoon", e_st_orbit_moon, [] (const char *label) { ImSpinner::Spinner<e_st_orbit_moon>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*416 */ { "SpinnerConicWheels", e_st_conic_wheels, [] (const char *label) { ImSpinner::Spinner<e_st_conic_wheels>(label,
+                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*417 */ { "SpinnerDotRing", e_st_dot_ring, [] (const char *label) { ImSpinner::Spinner<e_st_dot_ring>(label,
+                                                          Radius{R(16)}, Thickness{T(3)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*418 */ { "SpinnerMorphShape", e_st_morph_shape, [] (const char *label) { ImSpinner::Spinner<e_st_morph_shape>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*419 */ { "SpinnerFlipTriangle", e_st_flip_triangle, [] (const char *label) { ImSpinner::Spinner<e_st_flip_triangle>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*420 */ { "SpinnerFoldSquare", e_st_fold_square, [] (const char *label) { ImSpinner::Spinner<e_st_fold_square>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*421 */ { "SpinnerPinwheel", e_st_pinwheel, [] (const char *label) { ImSpinner::Spinner<e_st_pinwheel>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*422 */ { "SpinnerCornerSquares", e_st_corner_squares, [] (const char *label) { ImSpinner::Spinner<e_st_corner_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*423 */ { "SpinnerSplitSquare", e_st_split_square, [] (const char *label) { ImSpinner::Spinner<e_st_split_square>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*424 */ { "SpinnerCornerBurst", e_st_corner_burst, [] (const char *label) { ImSpinner::Spinner<e_st_corner_burst>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*425 */ { "SpinnerSkewSquare", e_st_skew_square, [] (const char *label) { ImSpinner::Spinner<e_st_skew_square>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*426 */ { "SpinnerTumbleSquare", e_st_tumble_square, [] (const char *label) { ImSpinner::Spinner<e_st_tumble_square>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*427 */ { "SpinnerTriDiamond", e_st_tri_diamond, [] (const char *label) { ImSpinner::Spinner<e_st_tri_diamond>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*428 */ { "SpinnerTwinBlades", e_st_twin_blades, [] (const char *label) { ImSpinner::Spinner<e_st_twin_blades>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*429 */ { "SpinnerCrossBlades", e_st_cross_blades, [] (const char *label) { ImSpinner::Spinner<e_st_cross_blades>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*430 */ { "SpinnerDriftSquare", e_st_drift_square, [] (const char *label) { ImSpinner::Spinner<e_st_drift_square>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*431 */ { "SpinnerPieBounce", e_st_pie_bounce, [] (const char *label) { ImSpinner::Spinner<e_st_pie_bounce>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*432 */ { "SpinnerLeapFrog", e_st_leap_frog, [] (const char *label) { ImSpinner::Spinner<e_st_leap_frog>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*433 */ { "SpinnerPlusSquares", e_st_plus_squares, [] (const char *label) { ImSpinner::Spinner<e_st_plus_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*434 */ { "SpinnerSevenMarch", e_st_seven_march, [] (const char *label) { ImSpinner::Spinner<e_st_seven_march>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*435 */ { "SpinnerCornerArcs", e_st_corner_arcs, [] (const char *label) { ImSpinner::Spinner<e_st_corner_arcs>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*436 */ { "SpinnerWalkBlocks", e_st_walk_blocks, [] (const char *label) { ImSpinner::Spinner<e_st_walk_blocks>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*437 */ { "SpinnerTumbleHalfDisc", e_st_tumble_half_disc, [] (const char *label) { ImSpinner::Spinner<e_st_tumble_half_disc>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*438 */ { "SpinnerFoldHalfDisc", e_st_fold_half_disc, [] (const char *label) { ImSpinner::Spinner<e_st_fold_half_disc>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*439 */ { "SpinnerWiperArrow", e_st_wiper_arrow, [] (const char *label) { ImSpinner::Spinner<e_st_wiper_arrow>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*440 */ { "SpinnerSkewSquares", e_st_skew_squares, [] (const char *label) { ImSpinner::Spinner<e_st_skew_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*441 */ { "SpinnerStretchSquares", e_st_stretch_squares, [] (const char *label) { ImSpinner::Spinner<e_st_stretch_squares>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*442 */ { "SpinnerTriPie", e_st_tri_pie, [] (const char *label) { ImSpinner::Spinner<e_st_tri_pie>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*443 */ { "SpinnerShuffleBars", e_st_shuffle_bars, [] (const char *label) { ImSpinner::Spinner<e_st_shuffle_bars>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*444 */ { "SpinnerHingeTumble", e_st_hinge_tumble, [] (const char *label) { ImSpinner::Spinner<e_st_hinge_tumble>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*445 */ { "SpinnerDiagonalFlip", e_st_diagonal_flip, [] (const char *label) { ImSpinner::Spinner<e_st_diagonal_flip>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*446 */ { "SpinnerPulseGrid", e_st_pulse_grid, [] (const char *label) { ImSpinner::Spinner<e_st_pulse_grid>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*447 */ { "SpinnerMarchGrid", e_st_march_grid, [] (const char *label) { ImSpinner::Spinner<e_st_march_grid>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*448 */ { "SpinnerSpinBars", e_st_spin_bars, [] (const char *label) { ImSpinner::Spinner<e_st_spin_bars>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*449 */ { "SpinnerMorphDots", e_st_morph_dots, [] (const char *label) { ImSpinner::Spinner<e_st_morph_dots>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*450 */ { "SpinnerCombDiscs", e_st_comb_discs, [] (const char *label) { ImSpinner::Spinner<e_st_comb_discs>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+          /*451 */ { "SpinnerOrbitDisc", e_st_orbit_disc, [] (const char *label) { ImSpinner::Spinner<e_st_orbit_disc>(label,
+                                                          Radius{R(16)}, Thickness{T(1)}, Color{C(white)}, Speed{S(1.f) * velocity}, Mode{M(0)}); } },
+      };
+      constexpr int num_spinners = IM_ARRAYSIZE(entries);
+
+      // Per-spinner cost as seen by the gallery: smoothed CPU time of one draw call and the
+      // vertex / index / draw-command counts it appended to the window draw list last frame.
+      struct SpinnerProfile { double ns = 0.0; int vtx = 0, idx = 0, cmd = 0; };
+      static SpinnerProfile profiles[num_spinners];
+      static double gallery_ns = 0.0;   // smoothed CPU time of the whole grid of the current view
+      static int gallery_cells = 0, gallery_drawn = 0;
+      if ((int)params.has.size() != num_spinners)
+        params.resize(num_spinners);
+      static bool show_profile = false;
+
+      if (query) {
+        query->count = num_spinners;
+        if (query->cell < 0 || query->cell >= num_spinners)
+          return;
+        const SpinnerEntry &entry = entries[query->cell];
+        query->name = entry.name;
+        query->category = GetSpinnerInfo(entry.type).category;
+        if (query->draw) {
+          ImGui::PushID(query->cell);
+          cci = query->cell;
+          entry.draw(entry.name);
+          ImGui::PopID();
+        }
+        return;
+      }
 
       const auto draw_spinner = [&](int spinner_idx, float widget_size)
       {
@@ -73,923 +1046,23 @@ namespace ImSpinner
               ImGui::SetItemDefaultFocus();
           }
 
-          const float sp_radius = __rr.count(spinner_idx) ? __rr[spinner_idx] : 16.f;
+          const float sp_radius = (params.has[spinner_idx] & pf_r) ? params.r[spinner_idx] : 16.f;
           const float sp_offset = (widget_size - sp_radius * 2.f ) / 2.f;
           ImGui::SetCursorPos({curpos_begin.x + sp_offset, curpos_begin.y + sp_offset});
 
-#define $(i) i: cci = i;
-          switch (spinner_idx) {
-          case $( 0) ImSpinner::Spinner<e_st_rainbow>   (Name("Spinner"),
-                                                         Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(1)}, Mode{M(0)}); break;
-          case $( 1) ImSpinner::Spinner<e_st_rainbow>   (Name("Spinner"),
-                                                         Radius{R(16)}, Thickness{T(2)}, Color{ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f)}, Speed{S(8) * velocity}, AngleMin{AMN(0.f)}, AngleMax{AMX(PI_2)}, Dots{DT(4)}, Mode{M(1)}); break;
-          case $( 2) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDots"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(0)}); break;
-          case $( 3) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDots"),
-                                                         Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(1)}); break;
-          case $( 4) ImSpinner::Spinner<e_st_ang>       (Name("SpinnerAng270"),
-                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(6) * velocity}, Angle{A(0.75f * PI_2)}, Mode{M(0)}); break;
-          case $( 5) ImSpinner::Spinner<e_st_ang>       (Name("SpinnerAng270NoBg"),
-                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(6) * velocity}, Angle{A(0.75f * PI_2)}); break;
-          case $( 6) ImSpinner::Spinner<e_st_vdots>     (Name("SpinnerVDots"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.7f) * velocity}, Dots{DT(12)}, MiddleDots{MDT(6)}, Mode{M(0)}); break;
-          case $( 7) ImSpinner::Spinner<e_st_bounce_ball>(Name("SpinnerBounceBall"),
-                                                          Radius{R(16)}, Thickness{T(6)}, Color{C(white)}, Speed{S(4) * velocity}, Dots{DT(1)}, Mode{M(0)}); break;
-          case $( 8) ImSpinner::Spinner<e_st_eclipse>   (Name("SpinnerAngEclipse"),
-                                                          Radius{R(16)}, Thickness{T(5)}, Color{C(white)}, Speed{S(6) * velocity}); break;
-          case $( 9) ImSpinner::Spinner<e_st_ingyang>   (Name("SpinnerIngYang"),
-                                                          Radius{R(16)}, Thickness{T(5)}, Reverse{false}, Delta{D(0.f)}, Color{C(white)}, AltColor{ImColor(255, 0, 0)}, Speed{S(4) * velocity}, Angle{A(IM_PI * 0.8f)}); break;
-          case $(10) ImSpinner::Spinner<e_st_barchartsine>(Name("SpinnerBarChartSine"),
-                                                           Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(6.8f) * velocity}, Dots{DT(4)}, Mode{M(0)}); break;
-          case $(11) ImSpinner::SpinnerBounceDots       (Name("SpinnerBounceDots"), R(16),
-                                                          T(6), C(white), S(6) * velocity, DT(3), M(0)); break;
-          case $(12) ImSpinner::SpinnerFadeDots         (Name("SpinnerFadeDots"), R(16),
-                                                          T(6), C(white), S(8) * velocity, DT(8)); break;
-          case $(13) ImSpinner::SpinnerScaleDots        (Name("SpinnerScaleDots"), R(16),
-                                                          T(6), C(white), S(7) * velocity, DT(8)); break;
-          case $(14) ImSpinner::SpinnerMovingDots       (Name("SpinnerMovingDots"), R(16),
-                                                          T(6), C(white), S(30) * velocity, DT(3)); break;
-          case $(15) ImSpinner::SpinnerRotateDots       (Name("SpinnerRotateDots"),
-                                                          R(16), T(6), C(white), S(4) * velocity, DT(2), M(0)); break;
-          case $(16) ImSpinner::SpinnerTwinAng          (Name("SpinnerTwinAng"),
-                                                          R(16), 16, T(6), C(white), CB(ImColor(255, 0, 0)), S(4) * velocity, A(IM_PI), M(0)); break;
-          case $(17) ImSpinner::SpinnerClock            (Name("SpinnerClock"),
-                                                          R(16), T(2), C(ImColor(255, 0, 0)), CB(white), S(4) * velocity); break;
-          case $(18) ImSpinner::SpinnerIngYang          (Name("SpinnerIngYangR"),
-                                                          R(16), T(5), true, 0.1f, C(white), CB(ImColor(255, 0, 0)), S(4) * velocity, A(IM_PI * 0.8f), M(0)); break;
-          case $(19) ImSpinner::SpinnerBarChartSine     (Name("SpinnerBarChartSine2"),
-                                                          R(16), T(4), ImColor::HSV(hue * 0.005f, 0.8f, 0.8f), S(4.8f) * velocity, DT(4), M(4)); break;
-          case $(20) ImSpinner::SpinnerTwinAng180       (Name("SpinnerTwinAng"),
-                                                          R(16), 12, T(4), C(white), CB(ImColor(255, 0, 0)), S(4) * velocity, A(PI_DIV_4), M(0)); break;
-          case $(21) ImSpinner::SpinnerTwinAng180       (Name("SpinnerTwinAng2"),
-                                                          R(16), 12, T(4), C(white), CB(ImColor(255, 0, 0)), S(4) * velocity, A(IM_PI), M(1)); break;
-          case $(22) ImSpinner::SpinnerIncDots          (Name("SpinnerIncDots"),
-                                                          R(16), T(4), C(white), S(5.6f) * velocity, 6); break;
-          case $(23) nextdot2 -= 0.2f * velocity;
-                     ImSpinner::SpinnerDots             (Name("SpinnerDotsWoBg"),
-                                                          &nextdot2, R(16), T(4), C(white), S(0.3f) * velocity, DT(12), A(0.f), M(0)); break;
-          case $(24) ImSpinner::SpinnerIncScaleDots     (Name("SpinnerIncScaleDots"),
-                                                          R(16), T(4), C(white), S(6.6f) * velocity, DT(6), A(0), M(0)); break;
-          case $(25) ImSpinner::SpinnerAng              (Name("SpinnerAng90"),
-                                                          R(16), T(6), C(white), CB(ImColor(255, 255, 255, 128)), S(8.f) * velocity, A(PI_DIV_2), M(0)); break;
-          case $(26) ImSpinner::SpinnerAng              (Name("SpinnerAng90"),
-                                                          R(16), 6, C(white), CB(ImColor(255, 255, 255, 0)), S(8.5f) * velocity, A(PI_DIV_2), M(0)); break;
-          case $(27) ImSpinner::SpinnerFadeBars         (Name("SpinnerFadeBars"),
-                                                          10, C(white), S(4.8f) * velocity, 3); break;
-          case $(28) ImSpinner::SpinnerPulsar           (Name("SpinnerPulsar"),
-                                                          R(16), T(2), C(white), S(1) * velocity, true, A(0), M(0)); break;
-          case $(29) ImSpinner::SpinnerIngYang          (Name("SpinnerIngYangR2"),
-                                                          R(16), T(5), true, 3.f, C(white), CB(ImColor(255, 0, 0)), S(4) * velocity, A(IM_PI * 0.8f)); break;
-          case $(30) ImSpinner::SpinnerBarChartRainbow  (Name("SpinnerBarChartRainbow"),
-                                                          R(16), T(4), ImColor::HSV(hue * 0.005f, 0.8f, 0.8f), S(6.8f) * velocity, DT(4), M(0)); break;
-          case $(31) ImSpinner::SpinnerBarsRotateFade   (Name("SpinnerBarsRotateFade"),
-                                                          8, 18, T(4), C(white), S(7.6f) * velocity, DT(6)); break;
-          case $(32) ImSpinner::SpinnerFadeBars         (Name("SpinnerFadeScaleBars"),
-                                                          10, C(white), S(6.8f) * velocity, 3, true); break;
-          case $(33) ImSpinner::SpinnerBarsScaleMiddle  (Name("SpinnerBarsScaleMiddle"),
-                                                          6, C(white), S(8.8f) * velocity, 3); break;
-          case $(34) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin1"),
-                                                          R(16), 13, T(2), C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, A(PI_DIV_2), DT(1), M(0)); break;
-          case $(35) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin2"),
-                                                          13, 16, T(2), C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, A(PI_DIV_2), DT(1), M(0)); break;
-          case $(36) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin3"),
-                                                          13, 16, T(2), C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, A(PI_DIV_2), DT(2), M(0)); break;
-          case $(37) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin4"),
-                                                          R(16), 13, T(2), C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, A(PI_DIV_2), DT(2), M(0)); break;
-          case $(38) ImSpinner::SpinnerTwinPulsar       (Name("SpinnerTwinPulsar"),
-                                                          R(16), T(2), C(white), S(0.5f) * velocity, DT(2), M(0)); break;
-          case $(39) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin4"),
-                                                          R(14), 13, T(3), C(ImColor(255, 0, 0)), CB(ImColor(0, 0, 0, 0)), S(5) * velocity, A(IM_PI / 1.5f), 2); break;
-          case $(40) ImSpinner::SpinnerBlocks           (Name("SpinnerBlocks"),
-                                                          R(16), T(7), C(ImColor(255, 255, 255, 30)), CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)), S(5) * velocity); break;
-          case $(41) ImSpinner::SpinnerTwinBall         (Name("SpinnerTwinBall"),
-                                                          R(16), 11, T(2), 2.5f, C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, DT(2), M(0)); break;
-          case $(42) ImSpinner::SpinnerTwinBall         (Name("SpinnerTwinBall2"),
-                                                          R(15), 19, T(2), 2.f, C(ImColor(255, 0, 0)), CB(white), S(6) * velocity, DT(3), M(0)); break;
-          case $(43) ImSpinner::SpinnerTwinBall         (Name("SpinnerTwinBall2"),
-                                                          16, 16, T(2), 5.f, C(ImColor(255, 0, 0)), CB(white), S(5) * velocity, DT(1), M(0)); break;
-          case $(44) ImSpinner::SpinnerAngTriple        (Name("SpinnerAngTriple"),
-                                                          16, 13, 10, T(1.3f), C(white), ImColor(255, 0, 0), white, S(5) * velocity, A(1.5f * IM_PI)); break;
-          case $(45) ImSpinner::SpinnerIncFullDots      (Name("SpinnerIncFullDots"),
-                                                          R(16), T(4), C(white), S(5.6f) * velocity, 4); break;
-          case $(46) ImSpinner::SpinnerGooeyBalls       (Name("SpinnerGooeyBalls"),
-                                                          R(16), C(white), S(2.f) * velocity); break;
-          case $(47) ImSpinner::SpinnerRotateGooeyBalls (Name("SpinnerRotateGooeyBalls2"),
-                                                          R(16), T(5), C(white), S(6.f) * velocity, DT(2), M(0)); break;
-          case $(48) ImSpinner::SpinnerRotateGooeyBalls (Name("SpinnerRotateGooeyBalls3"),
-                                                          R(16), T(5), C(white), S(6.f) * velocity, DT(3), M(0)); break;
-          case $(49) ImSpinner::SpinnerMoonLine         (Name("SpinnerMoonLine"),
-                                                          R(16), T(3), C(ImColor(200, 80, 0)), ImColor(80, 80, 80), S(5) * velocity); break;
-          case $(50) ImSpinner::SpinnerArcRotation      (Name("SpinnerArcRotation"),
-                                                          R(13), T(5), C(white), S(3) * velocity, DT(4), M(0)); break;
-          case $(51) ImSpinner::SpinnerFluid            (Name("SpinnerFluid"),
-                                                          R(16), C(ImColor(0, 0, 255)), S(3.8f) * velocity, 4); break;
-          case $(52) ImSpinner::SpinnerArcFade          (Name("SpinnerArcFade"),
-                                                          R(13), T(5), C(white), S(3) * velocity, DT(4), M(0)); break;
-          case $(53) ImSpinner::SpinnerFilling          (Name("SpinnerFilling"),
-                                                          R(16), T(6), C(white), CB(ImColor(255, 0, 0)), S(4) * velocity); break;
-          case $(54) ImSpinner::SpinnerTopup            (Name("SpinnerTopup"),
-                                                          R(16), 12, C(ImColor(255, 0, 0)), ImColor(80, 80, 80), CB(white), S(1) * velocity);  break;
-          case $(55) ImSpinner::SpinnerFadePulsar       (Name("SpinnerFadePulsar"),
-                                                          R(16), C(white), S(1.5f) * velocity, DT(1), M(0));  break;
-          case $(56) ImSpinner::SpinnerFadePulsar       (Name("SpinnerFadePulsar2"),
-                                                          R(16), C(white), S(0.9f) * velocity, DT(2), M(0)); break;
-          case $(57) ImSpinner::SpinnerPulsar           (Name("SpinnerPulsar"),
-                                                          R(16), T(2), C(white), S(1) * velocity, false); break;
-          case $(58) ImSpinner::SpinnerDoubleFadePulsar (Name("SpinnerDoubleFadePulsar"),
-                                                          R(16), T(2), C(white), S(2) * velocity); break;
-          case $(59) ImSpinner::SpinnerFilledArcFade    (Name("SpinnerFilledArcFade"),
-                                                          R(16), C(white), S(4) * velocity, 4); break;
-          case $(60) ImSpinner::SpinnerFilledArcFade    (Name("SpinnerFilledArcFade6"),
-                                                          R(16), C(white), S(6) * velocity, 6); break;
-          case $(61) ImSpinner::SpinnerFilledArcFade    (Name("SpinnerFilledArcFade6"),
-                                                          R(16), C(white), S(8) * velocity, 12); break;
-          case $(62) ImSpinner::SpinnerFilledArcColor   (Name("SpinnerFilledArcColor"),
-                                                          R(16), C(ImColor(255, 0, 0)), CB(white), S(2.8f) * velocity, 4); break;
-          case $(63) ImSpinner::SpinnerCircleDrop       (Name("SpinnerCircleDrop"),
-                                                          R(16), T(1.5f), 4.f, C(ImColor(255, 0, 0)), CB(white), S(2.8f) * velocity, A(IM_PI)); break;
-          case $(64) ImSpinner::SpinnerSurroundedIndicator(Name("SpinnerSurroundedIndicator"),
-                                                          R(16), T(5), C(ImColor(0, 0, 0)), CB(white), S(7.8f) * velocity); break;
-          case $(65) ImSpinner::SpinnerTrianglesSelector (Name("SpinnerTrianglesSelector"),
-                                                          R(16), T(8), C(ImColor(0, 0, 0)), CB(white), S(4.8f) * velocity, 8); break;
-          case $(66) ImSpinner::SpinnerFlowingGradient  (Name("SpinnerFlowingFradient"),
-                                                          R(16), T(6), C(ImColor(200, 80, 0)), CB(ImColor(80, 80, 80)), S(5) * velocity, A(PI_2)); break;
-          case $(67) ImSpinner::SpinnerRotateSegments   (Name("SpinnerRotateSegments"),
-                                                          R(16), T(4), C(white), S(3) * velocity, DT(4), MDT(1), M(0)); break;
-          case $(68) ImSpinner::SpinnerRotateSegments   (Name("SpinnerRotateSegments2"),
-                                                          R(16), T(3), C(white), S(2.4f) * velocity, DT(4), MDT(2), M(0)); break;
-          case $(69) ImSpinner::SpinnerRotateSegments   (Name("SpinnerRotateSegments3"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(4), MDT(3), M(0)); break;
-          case $(70) ImSpinner::SpinnerLemniscate       (Name("SpinnerLemniscate"),
-                                                          R(20), T(3), C(white), S(2.1f) * velocity, 3); break;
-          case $(71) ImSpinner::SpinnerRotateGear       (Name("SpinnerRotateGear"),
-                                                          R(16), T(6), C(white), S(2.1f) * velocity, 8); break;
-          case $(72) ImSpinner::SpinnerRotatedAtom      (Name("SpinnerRotatedAtom"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(3), M(0)); break;
-          case $(73) ImSpinner::SpinnerAtom             (Name("SpinnerAtom"),
-                                                          R(16), T(2), C(white), S(4.1f) * velocity, 3); break;
-          case $(74) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls"),
-                                                          R(16), T(4), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(5), M(0), MDT(1), MX(0)); break;
-          case $(75) ImSpinner::SpinnerCamera           (Name("SpinnerCamera"),
-                                                          R(16), T(8), [] (int i) { return ImColor::HSV(i * 0.25f, 0.8f, 0.8f); }, S(4.8f) * velocity, DT(8), M(0)); break;
-          case $(76) ImSpinner::SpinnerArcPolarFade     (Name("SpinnerArcPolarFade"),
-                                                          R(16), C(white), S(6) * velocity, DT(6), M(0)); break;
-          case $(77) ImSpinner::SpinnerArcPolarRadius   (Name("SpinnerArcPolarRadius"),
-                                                          R(16), C(ImColor::HSV(0.25f, 0.8f, 0.8f)), S(6.f) * velocity, DT(6), M(0)); break;
-          case $(78) ImSpinner::SpinnerCaleidoscope     (Name("SpinnerArcPolarPies"),
-                                                          R(16), T(4), C(ImColor::HSV(0.25f, 0.8f, 0.8f)), S(2.6f) * velocity, DT(10), M(0)); break;
-          case $(79) ImSpinner::SpinnerCaleidoscope     (Name("SpinnerArcPolarPies2"),
-                                                          R(16), T(4), C(ImColor::HSV(0.35f, 0.8f, 0.8f)), S(3.2f) * velocity, 10, 1); break;
-          case $(80) ImSpinner::SpinnerScaleBlocks      (Name("SpinnerScaleBlocks"),
-                                                          R(16), T(8), ImColor::HSV(hue * 0.005f, 0.8f, 0.8f), S(5) * velocity); break;
-          case $(81) ImSpinner::SpinnerRotateTriangles  (Name("SpinnerRotateTriangles"),
-                                                          R(16), T(2), C(white), S(6.f) * velocity, DT(3), M(0)); break;
-          case $(82) ImSpinner::SpinnerArcWedges        (Name("SpinnerArcWedges"),
-                                                          R(16), C(ImColor::HSV(0.3f, 0.8f, 0.8f)), S(2.8f) * velocity, DT(4), M(0)); break;
-          case $(83) ImSpinner::SpinnerScaleSquares     (Name("SpinnerScaleSquares"),
-                                                          R(16), T(8), ImColor::HSV(hue * 0.005f, 0.8f, 0.8f), S(5) * velocity); break;
-          case $(84) ImSpinner::SpinnerHboDots          (Name("SpinnerHboDots"), R(16),
-                                                          T(4), C(white), 0.f, 0.f, S(1.1f) * velocity, DT(6), M(0)); break;
-          case $(85) ImSpinner::SpinnerHboDots          (Name("SpinnerHboDots2"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(1.1f) * velocity, DT(6), M(0)); break;
-          case $(86) ImSpinner::Spinner<e_st_bounce_ball>(Name("SpinnerBounceBall3"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, Speed{S(3.2f) * velocity}, Dots{DT(5)}); break;
-          case $(87) ImSpinner::SpinnerBounceBall       (Name("SpinnerBounceBallShadow"),
-                                                          R(16), T(4), C(white), S(2.2f) * velocity, DT(1), true); break;
-          case $(88) ImSpinner::SpinnerBounceBall       (Name("SpinnerBounceBall5Shadow"),
-                                                          R(16), T(4), C(white), S(3.6f) * velocity, DT(5), true); break;
-          case $(89) ImSpinner::SpinnerSquareStrokeFade (Name("SpinnerSquareStrokeFade"),
-                                                          R(13), T(5), C(white), S(3) * velocity); break;
-          case $(90) ImSpinner::SpinnerSquareStrokeFill (Name("SpinnerSquareStrokeFill"),
-                                                          R(13), T(5), C(white), S(3) * velocity); break;
-          case $(91) ImSpinner::SpinnerSwingDots        (Name("SpinnerSwingDots"),
-                                                          R(16), T(6), C(ImColor(255, 0, 0)), S(4.1f) * velocity); break;
-          case $(92) ImSpinner::SpinnerRotateWheel      (Name("SpinnerRotateWheel"),
-                                                          R(16), T(10), C(ImColor(255, 255, 0)), CB(white), S(2.1f) * velocity, 8); break;
-          case $(93) ImSpinner::SpinnerWaveDots         (Name("SpinnerWaveDots"), R(16),
-                                                          T(3), C(white), S(6) * velocity, DT(8)); break;
-          case $(94) ImSpinner::SpinnerRotateShapes     (Name("SpinnerRotateShapes"),
-                                                          R(16), T(2), C(white), S(6.f) * velocity, DT(4), MDT(4)); break;
-          case $(95) ImSpinner::SpinnerSquareStrokeLoading(Name("SpinnerSquareStrokeLoanding"),
-                                                          R(13), T(5), C(white), S(3) * velocity); break;
-          case $(96) ImSpinner::SpinnerSinSquares       (Name("SpinnerSinSquares"),
-                                                          R(16), T(2), C(white), S(1.f) * velocity, M(0)); break;
-          case $(97) ImSpinner::SpinnerZipDots          (Name("SpinnerZipDots"), R(16),
-                                                          T(3), C(white), S(6) * velocity, DT(5)); break;
-          case $(98) ImSpinner::SpinnerDotsToBar        (Name("SpinnerDotsToBar"), R(16),
-                                                          T(3), D(0.5f), C(ImColor::HSV(0.31f, 0.8f, 0.8f)), S(5) * velocity, DT(5)); break;
-          case $(99) ImSpinner::SpinnerSineArcs         (Name("SpinnerSineArcs"), R(16),
-                                                          T(1), C(white), S(3) * velocity);
-          case $(100) ImSpinner::SpinnerTrianglesShift  (Name("SpinnerTrianglesShift"),
-                                                          R(16), T(8), C(ImColor(0, 0, 0)), CB(white), S(1.8f) * velocity, DT(8)); break;
-          case $(101) ImSpinner::SpinnerCircularLines   (Name("SpinnerCircularLines"),
-                                                          R(16), C(white), S(1.5f) * velocity, DT(8), M(0));  break;
-          case $(102) ImSpinner::SpinnerLoadingRing     (Name("SpinnerLoadingRing"),
-                                                          R(16), T(6), C(red), CB(ImColor(255, 255, 255, 128)), S(1.f) * velocity, DT(5)); break;
-          case $(103) ImSpinner::SpinnerPatternRings    (Name("SpinnerPatternRings"),
-                                                          R(16), T(2), C(white), S(4.1f) * velocity, DT(3)); break;
-          case $(104) ImSpinner::SpinnerPatternSphere   (Name("SpinnerPatternSphere"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(6)); break;
-          case $(105) ImSpinner::SpinnerRingSynchronous (Name("SpinnerRingSnchronous"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(3)); break;
-          case $(106) ImSpinner::SpinnerRingWatermarks  (Name("SpinnerRingWatermarks"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(3)); break;
-          case $(107) ImSpinner::SpinnerFilledArcRing   (Name("SpinnerFilledArcRing"),
-                                                          R(16), T(6), C(red), CB(white), S(2.8f) * velocity, DT(8)); break;
-          case $(108) ImSpinner::SpinnerPointsShift     (Name("SpinnerPointsShift"),
-                                                          R(16), T(3), C(ImColor(0, 0, 0)), CB(white), S(1.8f) * velocity, DT(10)); break;
-          case $(109) ImSpinner::SpinnerCircularPoints  (Name("SpinnerCircularPoints"),
-                                                          R(16), T(1.2f), C(white), S(10.f) * velocity, DT(7));  break;
-          case $(110) ImSpinner::SpinnerCurvedCircle    (Name("SpinnerCurvedCircle"),
-                                                          R(16), T(1.2f), C(white), S(1.f) * velocity, DT(3));  break;
-          case $(111) ImSpinner::SpinnerModCircle       (Name("SpinnerModCirclre"),
-                                                          R(16), T(1.2f), C(white), AMN(1.f), AMX(2.f), S(3.f) * velocity);  break;
-          case $(112) ImSpinner::SpinnerModCircle       (Name("SpinnerModCirclre2"),
-                                                          R(16), T(1.2f), C(white), AMN(1.11f), AMX(3.33f), S(3.f) * velocity);  break;
-          case $(113) ImSpinner::SpinnerPatternEclipse  (Name("SpinnerPatternEclipse"),
-                                                          R(16), T(2), C(white), S(4.1f) * velocity, DT(5), AMN(2.f), AMX(0.f)); break;
-          case $(114) ImSpinner::SpinnerPatternEclipse  (Name("SpinnerPatternEclipse2"),
-                                                          R(16), T(2), C(white), S(4.1f) * velocity, DT(9), AMN(4.f), AMX(1.f)); break;
-          case $(115) ImSpinner::SpinnerMultiFadeDots   (Name("SpinnerMultiFadeDots"), R(16),
-                                                          T(2), C(white), S(8) * velocity, DT(8)); break;
-          case $(116) ImSpinner::SpinnerRainbowShot     (Name("SpinnerRainbowShot"),
-                                                          R(16), T(4), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(5), M(0)); break;
-          case $(117) ImSpinner::SpinnerSpiral          (Name("SpinnerSpiral"),
-                                                          R(16), T(2), C(white), S(6) * velocity, DT(5)); break;
-          case $(118) ImSpinner::SpinnerSpiralEye       (Name("SpinnerSpiralEye"),
-                                                          R(16), T(1), C(white), S(3) * velocity); break;
-          case $(119) ImSpinner::SpinnerWifiIndicator   (Name("SpinnerWifiIndicator"),
-                                                          R(16), T(1.5f), C(ImColor(0, 0, 0)), CB(white), S(7.8f) * velocity, AMN(5.52f), DT(3)); break;
-          case $(120) ImSpinner::SpinnerHboDots         (Name("SpinnerHboDots"), R(16),
-                                                          T(2), C(white), 0.f, 0.f, S(1.1f) * velocity, DT(10)); break;
-          case $(121) ImSpinner::SpinnerHboDots         (Name("SpinnerHboDots2"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(1.1f) * velocity, DT(2)); break;
-          case $(122) ImSpinner::SpinnerHboDots         (Name("SpinnerHboDots4"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(1.1f) * velocity, DT(3)); break;
-          case $(123) ImSpinner::SpinnerDnaDots         (Name("SpinnerDnaDotsH"), R(16),
-                                                          T(3), C(white), S(2) * velocity, DT(8), D(0.25f)); break;
-          case $(124) ImSpinner::SpinnerDnaDots         (Name("SpinnerDnaDotsV"), R(16),
-                                                          T(3), C(white), S(2) * velocity, DT(8), D(0.25f), true); break;
-          case $(125) ImSpinner::SpinnerRotateDots      (Name("SpinnerRotateDots2"),
-                                                          R(16), T(6), C(white), S(4) * velocity, ImMax<int>(int(ImSin((float)ImGui::GetTime() * 0.5f) * 8), 3)); break;
-          case $(126) ImSpinner::SpinnerSevenSegments   (Name("SpinnerSevenSegments"), "012345679ABCDEF",
-                                                          R(16), T(2), C(white), S(4) * velocity); break;
-          case $(127) ImSpinner::SpinnerSolarBalls      (Name("SpinnerSolarBalls"),
-                                                          R(16), T(4), C(red), CB(white), S(5) * velocity, DT(4)); break;
-          case $(128) ImSpinner::SpinnerSolarArcs       (Name("SpinnerSolarArcs"),
-                                                          R(16), T(4), C(red), CB(white), S(5) * velocity, DT(4)); break;
-          case $(129) ImSpinner::SpinnerRainbow         (Name("Spinner"),
-                                                          R(16), T(2), ImColor::HSV(++hue * 0.005f, 0.8f, 0.8f), S(8) * velocity, AMN(0.f), AMX(PI_2), DT(3)); break;
-          case $(130) ImSpinner::SpinnerRotatingHeart   (Name("SpinnerRotatedHeart"),
-                                                          R(16), T(2), C(red), S(8) * velocity, AMN(0.f)); break;
-          case $(131) ImSpinner::SpinnerSolarScaleBalls (Name("SpinnerSolarScaleBalls"),
-                                                          R(16), T(1.3f), C(red), S(1) * velocity, DT(36)); break;
-          case $(132) ImSpinner::SpinnerOrionDots       (Name("SpinnerOrionDots"),
-                                                          R(16), T(1.3f), C(white), S(4) * velocity, DT(12)); break;
-          case $(133) ImSpinner::SpinnerGalaxyDots      (Name("SpinnerGalaxyDots"),
-                                                          R(16), T(1.3f), C(white), S(0.2f) * velocity, DT(6)); break;
-          case $(134) ImSpinner::SpinnerAsciiSymbolPoints(Name("SpinnerAsciiSymbolPoints"), "012345679ABCDEF",
-                                                          R(16), T(2), C(white), S(4) * velocity); break;
-          case $(135) ImSpinner::SpinnerRainbowCircle   (Name("SpinnerRainbowCircle"),
-                                                          R(16), T(4), C(ImColor::HSV(0.25f, 0.8f, 0.8f)), S(1) * velocity, DT(4)); break;
-          case $(136) ImSpinner::SpinnerRainbowCircle   (Name("SpinnerRainbowCircle2"),
-                                                          R(16), T(2), ImColor::HSV(hue * 0.001f, 0.8f, 0.8f), S(2) * velocity, DT(8), D(0)); break;
-          case $(137) ImSpinner::Spinner<e_st_vdots>    (Name("SpinnerVDots2"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.1f) * velocity}, Dots{DT(2)}, MiddleDots{6}); break;
-          case $(138) ImSpinner::Spinner<e_st_vdots>    (Name("SpinnerVDots3"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.9f) * velocity}, Dots{DT(3)}, MiddleDots{6}); break;
-          case $(139) ImSpinner::SpinnerSquareRandomDots(Name("SpinnerSquareRandomDots"),
-                                                          R(16), T(2.8f), C(ImColor(255, 255, 255, 30)), CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)), S(5) * velocity); break;
-          case $(140) ImSpinner::SpinnerFluidPoints     (Name("SpinnerFluidPoints"),
-                                                          R(16), T(2.8f), C(ImColor(0, 0, 255)), S(3.8f) * velocity, Dots{DT(4)}, D(0.45f)); break;
-          case $(141) ImSpinner::SpinnerDotsLoading     (Name("SpinnerDotsLoading"),
-                                                          R(16), T(4.f), C(white), CB(white), S(2.f) * velocity); break;
-          case $(142) ImSpinner::SpinnerDotsToPoints    (Name("SpinnerDotsToPoints"), R(16),
-                                                          T(3), D(0.5f), C(ImColor::HSV(0.31f, 0.8f, 0.8f)), S(1.8) * velocity, DT(5)); break;
-          case $(143) ImSpinner::SpinnerThreeDots       (Name("SpinnerThreeDots"), R(16),
-                                                          T(6), C(white), S(4) * velocity, DT(8)); break;
-          case $(144) ImSpinner::Spinner4Caleidospcope  (Name("Spinner4Caleidospcope"), R(16),
-                                                          T(6), ImColor::HSV(hue * 0.0031f, 0.8f, 0.8f), S(4) * velocity, DT(8)); break;
-          case $(145) ImSpinner::SpinnerFiveDots        (Name("SpinnerSixDots"), R(16),
-                                                          T(6), C(white), S(4) * velocity, DT(8)); break;
-          case $(146) ImSpinner::SpinnerFillingMem      (Name("SpinnerFillingMem"),
-                                                          R(16), T(6), ImColor::HSV(hue * 0.001f, 0.8f, 0.8f), spinner_filling_meb_bg, S(4) * velocity); break;
-          case $(147) ImSpinner::SpinnerHerbertBalls    (Name("SpinnerHerbertBalls"),
-                                                          R(16), T(2.3f), C(white), S(2.f) * velocity, DT(4)); break;
-          case $(148) ImSpinner::SpinnerHerbertBalls3D  (Name("SpinnerHerbertBalls3D"),
-                                                          R(16), T(3.f), C(white), S(1.4f) * velocity); break;
-          case $(149) ImSpinner::SpinnerSquareLoading   (Name("SpinnerSquareLoanding"),
-                                                          R(16), T(2), C(white), S(3) * velocity); break;
-#ifdef _IMSPINNER_TEXT_H_
-          case $(150) ImSpinner::SpinnerTextFading      (Name("SpinnerTextFading"), "Loading",
-                                                          R(16), T(15), C(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f)), S(4) * velocity); break;
-#endif
-          case $(151) ImSpinner::SpinnerBarChartAdvSine (Name("SpinnerBarChartAdvSine"),
-                                                          R(16), T(5), C(white), S(4.8f) * velocity, 0); break;
-          case $(152) ImSpinner::SpinnerBarChartAdvSineFade(Name("SpinnerBarChartAdvSineFade"),
-                                                          R(16), T(5), C(white), S(4.8f) * velocity, 0); break;
-          case $(153) ImSpinner::SpinnerMovingArcs       (Name("SpinnerMovingArcs"),
-                                                          R(16), T(4), C(white), S(2) * velocity, DT(4)); break;
-          case $(154) ImSpinner::SpinnerFadeTris         (Name("SpinnerFadeTris"),
-                                                          R(20), C(white), S(5.f) * velocity, DT(2), false, M(0)); break;
-          case $(155) ImSpinner::SpinnerBounceDots       (Name("SpinnerBounceDots1"), R(16),
-                                                          T(2.5), C(white), S(3) * velocity, DT(6), M(1)); break;
-          case $(156) ImSpinner::SpinnerRotateDots       (Name("SpinnerRotateDots"),
-                                                          R(16), T(2), C(white), S(4) * velocity, DT(16), 1); break;
-          case $(157) ImSpinner::SpinnerTwinAng360       (Name("SpinnerTwinAng360"),
-                                                          R(16), 11, T(2), C(white), CB(ImColor(255, 0, 0)), 2.4f, 2.1f, 1); break;
-          case $(158) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin1"),
-                                                          R(18), 13, T(2), C(ImColor(255, 0, 0)), CB(white), S(3) * velocity, A(1.3), DT(3), 1); break;
-          case $(159) ImSpinner::SpinnerGooeyBalls       (Name("SpinnerGooeyBalls"),
-                                                          R(16), C(white), S(2.f) * velocity, 1); break;
-          case $(160) ImSpinner::SpinnerArcRotation      (Name("SpinnerArcRotation"),
-                                                          R(13), T(2.5), C(white), S(3) * velocity, DT(15), 1); break;
-          case $(161) ImSpinner::SpinnerAng              (Name("SpinnerAng90Gravity"),
-                                                          R(16), T(1), C(white), CB(ImColor(255, 255, 255, 128)), S(8.f) * velocity, A(PI_DIV_2), M(1)); break;
-          case $(162) ImSpinner::SpinnerAng              (Name("SpinnerAng90SinRad"),
-                                                          R(16), T(1), C(white), CB(ImColor(255, 255, 255, 0)), S(8.f) * velocity, A(0.75f * PI_2), M(2)); break;
-          case $(163) ImSpinner::SpinnerSquishSquare     (Name("SpinnerSquishSquare"),
-                                                          R(16), C(white), S(8.f) * velocity); break;
-          case $(164) ImSpinner::SpinnerPulsarBall       (Name("SpinnerBounceBall"),
-                                                          R(16), T(2), C(white), S(4) * velocity, DT(1)); break;
-          case $(165) ImSpinner::SpinnerRainbowMix       (Name("Spinner"),
-                                                          R(16), T(2), ImColor::HSV(0.005f, 0.8f, 0.8f), S(8) * velocity, AMN(0.f), AMX(PI_2), DT(5), 1); break;
-          case $(166) ImSpinner::SpinnerAngMix           (Name("SpinnerAngMix"),
-                                                          R(16), T(1), C(white), S(8.f) * velocity, A(IM_PI), DT(4), 0); break;
-          case $(167) ImSpinner::SpinnerAngMix           (Name("SpinnerAngMixGravity"),
-                                                          R(16), T(1), C(white), S(8.f) * velocity, A(PI_DIV_2), DT(6), 1); break;
-          case $(168) ImSpinner::SpinnerScaleBlocks      (Name("SpinnerScaleBlocks"),
-                                                          R(16), T(8), ImColor::HSV(hue * 0.005f, 0.8f, 0.8f), S(5) * velocity, 1); break;
-          case $(169) ImSpinner::SpinnerFadeDots         (Name("SpinnerFadeDots3"), R(16),
-                                                          T(6), C(white), S(8) * velocity, DT(4), 1); break;
-          case $(170) ImSpinner::SpinnerFadeDots         (Name("SpinnerFadeDots6"), R(16),
-                                                          T(3), C(white), S(8) * velocity, DT(4), 1); break;
-          case $(171) ImSpinner::SpinnerFadeDots         (Name("SpinnerFadeDots2"), R(16),
-                                                          T(2), C(white), S(5) * velocity, DT(8)); break;
-          case $(172) ImSpinner::SpinnerScaleDots        (Name("SpinnerScaleDots2"), R(16),
-                                                          T(2), C(white), S(4) * velocity, DT(8)); break;
-          case $(173) ImSpinner::Spinner3SmuggleDots     (Name("Spinner3SmuggleDots"), R(16),
-                                                          T(3), C(white), S(4) * velocity, DT(8), D(0.25f), true); break;
-          case $(174) ImSpinner::SpinnerSimpleArcFade    (Name("SpinnerSimpleArcFade"),
-                                                          R(13), T(2), C(white), S(4) * velocity); break;
-          case $(175) ImSpinner::SpinnerTwinHboDots      (Name("SpinnerTwinHboDots"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(1.1f) * velocity, DT(6), D(0.f)); break;
-          case $(176) ImSpinner::SpinnerTwinHboDots      (Name("SpinnerTwinHboDots2"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(3.1f) * velocity, DT(3), D(-0.5f)); break;
-          case $(177) ImSpinner::SpinnerThreeDotsStar    (Name("SpinnerThreeDotsStar"), R(16),
-                                                          T(4), C(white), 0.1f, 0.5f, S(5.1f) * velocity, D(-0.2f)); break;
-          case $(178) ImSpinner::SpinnerSquareSpins      (Name("SpinnerSquareSpins"), R(16),
-                                                          T(6), C(white), S(2) * velocity); break;
-          case $(179) ImSpinner::SpinnerMoonDots         (Name("SpinnerMoonDots"), R(16),
-                                                          T(8), C(white), CB(ImColor(0, 0, 0)), S(1.1f) * velocity); break;
-          case $(180) ImSpinner::SpinnerFilledArcFade    (Name("SpinnerFilledArcFade7"),
-                                                          R(16), C(white), S(6) * velocity, DT(6), 1); break;
-          case $(181) ImSpinner::SpinnerRotateSegmentsPulsar(Name("SpinnerRotateSegmentsPulsar"),
-                                                          R(16), T(2), C(white), S(1.1f) * velocity, DT(4), MDT(2)); break;
-          case $(182) ImSpinner::SpinnerRotateSegmentsPulsar(Name("SpinnerRotateSegmentsPulsar2"),
-                                                          R(16), T(2), C(white), S(1.1f) * velocity, DT(1), MDT(3)); break;
-          case $(183) ImSpinner::SpinnerRotateSegmentsPulsar(Name("SpinnerRotateSegmentsPulsar3"),
-                                                          R(16), T(2), C(white), S(1.1f) * velocity, DT(3), MDT(3)); break;
-          case $(184) ImSpinner::SpinnerPointsArcBounce  (Name("SpinnerPointsArcBounce"),
-                                                          R(16), T(2), C(white), S(3) * velocity, DT(12), 1, 0.f); break;
-          case $(185) ImSpinner::SpinnerSomeScaleDots    (Name("SpinnerSomeScaleDots0"),
-                                                          R(16), T(4), C(white), S(5.6f) * velocity, 6, 0); break;
-          case $(186) ImSpinner::SpinnerSomeScaleDots    (Name("SpinnerSomeScaleDots1"),
-                                                          R(16), T(4), C(white), S(6.6f) * velocity, 6, 1); break;
-          case $(187) ImSpinner::SpinnerPointsArcBounce  (Name("SpinnerPointsArcBounce2"),
-                                                          R(16), T(2), C(white), S(3) * velocity, DT(12), 1, 0.5f); break;
-          case $(188) ImSpinner::SpinnerPointsArcBounce  (Name("SpinnerPointsArcBounce3"),
-                                                          R(16), T(2), C(white), S(3) * velocity, DT(12), 2, 0.3f); break;
-          case $(189) ImSpinner::SpinnerPointsArcBounce  (Name("SpinnerPointsArcBounce4"),
-                                                          R(16), T(2), C(white), S(3) * velocity, DT(12), 3, 0.3f); break;
-          case $(190) ImSpinner::SpinnerTwinBlocks       (Name("SpinnerTwinBlocks"),
-                                                          R(16), T(7), C(ImColor(255, 255, 255, 30)), CB(ImColor::HSV(hue * 0.005f, 0.8f, 0.8f)), S(5) * velocity); break;
-          case $(191) ImSpinner::SpinnerAng              (Name("SpinnerAng90"),
-                                                          R(16), T(4), C(white), CB(ImColor(255, 255, 255, 128)), S(8.f) * velocity, A(PI_DIV_2), M(3)); break;
-          case $(192) ImSpinner::SpinnerSplineAng        (Name("SpinnerSplineAng90"),
-                                                          R(16), T(2), C(white), CB(ImColor(255, 255, 255, 128)), S(8.f) * velocity, A(PI_DIV_2), M(0)); break;
-          case $(193) ImSpinner::Spinner<e_st_ang>       (Name("SpinnerAngNoBg"),
-                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 0))}, Speed{S(6) * velocity}, Angle{A(IM_PI)}, Mode{M(0)}); break;
-          case $(194) ImSpinner::SpinnerBounceDots       (Name("SpinnerBounceDots2"), R(16),
-                                                          T(2.5), C(white), S(1) * velocity, DT(6), M(2)); break;
-          case $(195) ImSpinner::SpinnerRotateDots       (Name("SpinnerRotateDots"),
-                                                          R(16), T(1.3), C(white), S(4) * velocity, DT(6), M(0)); break;
-          case $(196) ImSpinner::SpinnerRotateDots       (Name("SpinnerRotateDots"),
-                                                          R(16), T(2.3), C(white), S(4) * velocity, DT(5), M(2)); break;
-          case $(197) ImSpinner::SpinnerTwinAng360       (Name("SpinnerTwinAng360"),
-                                                          R(16), 11, T(4), C(white), CB(ImColor(255, 0, 0)), S(4) * velocity); break;
-          case $(198) ImSpinner::SpinnerDots             (Name("SpinnerDotsWoBg2"),
-                                                          &nextdot2, R(16), T(4), C(white), S(0.3f) * velocity, DT(6), A(1.49f), M(0)); break;
-          case $(199) ImSpinner::SpinnerDots             (Name("SpinnerDotsWoBg3"),
-                                                          &nextdot2, R(16), T(4), C(white), S(0.3f) * velocity, DT(4), A(1.49f), M(1)); break;
-          case $(200) ImSpinner::SpinnerIncScaleDots     (Name("SpinnerIncScaleDots2"),
-                                                          R(16), T(4), C(white), S(6.6f) * velocity, DT(8), A(1.22), M(1)); break;
-          case $(201) ImSpinner::SpinnerPulsar           (Name("SpinnerPulsar2"),
-                                                          R(16), T(2), C(white), S(1) * velocity, true, A(PI_2), M(1)); break;
-          case $(202) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin4"),
-                                                          R(16), 13, T(2), C(ImColor(255, 0, 0)), CB(white), S(1.6f) * velocity, A(3.14), DT(1), M(2)); break;
-          case $(203) ImSpinner::SpinnerAngTwin          (Name("SpinnerAngTwin5"),
-                                                          R(14), 16, T(2), C(ImColor(255, 0, 0)), CB(white), S(0.8f) * velocity, A(1.57), DT(3), M(2)); break;
-          case $(204) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDotsX3"),
-                                                          Radius{R(16)}, Thickness{T(2.3)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(3)}, MinThickness{-1.f}, Mode{M(2)}); break;
-          case $(205) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDotsX13"),
-                                                          Radius{R(16)}, Thickness{T(2.3)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(13)}, MinThickness{-1.f}, Mode{M(2)}); break;
-          case $(206) ImSpinner::Spinner<e_st_angle>     (Name("SpinnerAng"),
-                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(2.8) * velocity}, Angle{A(PI_DIV_2)}, Mode{M(4)}); break;
-          case $(207) ImSpinner::SpinnerTwinAng180       (Name("SpinnerTwinAngX"),
-                                                          R(16), 12, T(2), C(white), CB(ImColor(255, 0, 0)), S(0.5f) * velocity, A(PI_DIV_4), M(2)); break;
-          case $(208) ImSpinner::SpinnerAng8             (Name("SpinnerAng8"),
-                                                          R(21), T(2), C(white), CB(0), S(8.f) * velocity, A(PI_DIV_4 * 6), M(3), D(0.5f)); break;
-          case $(209) ImSpinner::SpinnerAng8             (Name("SpinnerAng8.1"),
-                                                          R(14.5), T(2.5), C(white), CB(0), S(4) * velocity, A(PI_DIV_4), M(4), D(0.5f)); break;
-          case $(210) ImSpinner::SpinnerAng8             (Name("SpinnerAng8.2"),
-                                                          R(12), T(2.5), C(white), CB(0), S(5) * velocity, A(5.0f), M(5), D(0.75f)); break;
-          case $(211) ImSpinner::SpinnerAng8             (Name("SpinnerAng8.3"),
-                                                          R(19), T(2.5), C(white), CB(0), S(5) * velocity, A(5.0f), M(0), D(0.70f)); break;
-          case $(212) ImSpinner::SpinnerRotateDots       (Name("SpinnerRotateDots"),
-                                                          R(16), T(3), C(white), S(4) * velocity, DT(4), M(3)); break;
-          case $(213) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDots/3"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(3)}); break;
-          case $(214) ImSpinner::Spinner<e_st_dots>      (Name("SpinnerDots/4"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, FloatPtr{&nextdot}, Speed{S(1) * velocity}, Dots{DT(12)}, MinThickness{-1.f}, Mode{M(4)}); break;
-          case $(215) ImSpinner::Spinner<e_st_vdots>     (Name("SpinnerVDots/1"),
-                                                          Radius{R(16)}, Thickness{T(4)}, Color{C(white)}, BgColor{CB(ImColor::HSV(hue * 0.0011f, 0.8f, 0.8f))}, Speed{S(2.7f) * velocity}, Dots{DT(12)}, MiddleDots{MDT(7)}, Mode{M(1)}); break;
-          case $(216) ImSpinner::SpinnerSinSquares       (Name("SpinnerSinSquares/1"),
-                                                          R(16), T(2), C(white), S(1.f) * velocity, M(1)); break;
-          case $(217) ImSpinner::SpinnerSinSquares       (Name("SpinnerSinSquares/2"),
-                                                          R(16), T(2), C(white), S(1.f) * velocity, M(2)); break;
-          case $(218) ImSpinner::SpinnerCamera           (Name("SpinnerCamera/1"),
-                                                          R(16), T(8), [] (int i) { return ImColor::HSV(i * 0.25f, 0.8f, 0.8f); }, S(2.8f) * velocity, DT(4), M(1)); break;
-          case $(219) ImSpinner::SpinnerCamera           (Name("SpinnerCamera/1"),
-                                                          R(16), T(8), [] (int i) { return ImColor::HSV(i * 0.25f, 0.8f, 0.8f); }, S(1.8f) * velocity, DT(3), M(1)); break;
-          case $(220) ImSpinner::SpinnerRotateSegments   (Name("SpinnerRotateSegments/1"),
-                                                          R(16), T(1.4), C(white), S(3) * velocity, DT(1), MDT(4), M(1)); break;
-          case $(221) ImSpinner::SpinnerRotateSegments   (Name("SpinnerRotateSegments/1"),
-                                                          R(16), T(4), C(white), S(3) * velocity, DT(4), MDT(1), M(1)); break;
-          case $(222) ImSpinner::Spinner<e_st_angle>     (Name("SpinnerAng"),
-                                                          Radius{R(16)}, Thickness{T(2)}, Color{C(white)}, BgColor{CB(ImColor(255, 255, 255, 128))}, Speed{S(8) * velocity}, Angle{A(IM_PI)}, Mode{M(1)}); break;
-          case $(223) ImSpinner::SpinnerArcRotation      (Name("SpinnerArcRotation/3"),
-                                                          R(13), T(5), C(white), S(3) * velocity, DT(4), M(3)); break;
-          case $(224) ImSpinner::SpinnerArcFade          (Name("SpinnerArcFade/2"),
-                                                          R(13), T(5), C(white), S(3) * velocity, DT(4), M(1)); break;
-          case $(225) ImSpinner::SpinnerIncScaleDots     (Name("SpinnerIncScaleDots"),
-                                                          R(16), T(4), C(white), S(4.6f) * velocity, DT(16), A(1), M(5)); break;
-          case $(226) ImSpinner::SpinnerTwinPulsar       (Name("SpinnerTwinPulsar/5"),
-                                                          R(16), T(2), C(white), S(0.5f) * velocity, DT(5), M(5)); break;
-          case $(227) ImSpinner::SpinnerTwinPulsar       (Name("SpinnerTwinPulsar/0"),
-                                                          R(16), T(2), C(white), S(0.5f) * velocity, DT(5), M(0)); break;
-          case $(228) ImSpinner::SpinnerCircularLines   (Name("SpinnerCircularLines/4"),
-                                                          R(16), C(white), S(1.5f) * velocity, DT(16), M(4));  break;
-          case $(229) ImSpinner::SpinnerRotatedAtom      (Name("SpinnerRotatedAtom/5"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(2), M(5)); break;
-          case $(230) ImSpinner::SpinnerRotatedAtom      (Name("SpinnerRotatedAtom/2"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(2), M(1)); break;
-          case $(231) ImSpinner::SpinnerRotatedAtom      (Name("SpinnerRotatedAtom/2"),
-                                                          R(16), T(2), C(white), S(2.1f) * velocity, DT(3), M(5)); break;
-          case $(232) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls/1"),
-                                                          R(16), T(4), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(3), M(1), MDT(1)); break;
-          case $(233) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls/5"),
-                                                          R(16), T(4), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(4), M(5), MDT(1)); break;
-          case $(234) ImSpinner::SpinnerPointsRoller     (Name("SpinnerPointsRoller"),
-                                                          R(16), T(3.5), C(white), S(1.4) * velocity, DT(8), MDT(1), 1.f); break;
-          case $(235) ImSpinner::SpinnerPointsRoller     (Name("SpinnerPointsRoller2"),
-                                                          R(16), T(1), C(white), S(1.0) * velocity, DT(18), MDT(3), 1.f); break;
-          case $(236) ImSpinner::SpinnerPointsRoller     (Name("SpinnerPointsRoller2"),
-                                                          R(16), T(3), C(white), S(1.0) * velocity, DT(2), MDT(12), 1.f); break;
-          case $(237) ImSpinner::SpinnerThickToSin       (Name("SpinnerThickToSin"),
-                                                          R(16), T(2), C(white), S(3) * velocity, MDT(1), DT(8) , M(0)); break;
-          case $(238) ImSpinner::SpinnerThickToSin       (Name("SpinnerThickToSin2"),
-                                                          R(16), T(1), C(white), S(3) * velocity, MDT(1), DT(20), M(5)); break;
-          case $(239) ImSpinner::SpinnerThickToSin       (Name("SpinnerThickToSin2"),
-                                                          R(16), T(1), C(white), S(3) * velocity, MDT(1), DT(20), M(6)); break;
-          case $(240) ImSpinner::SpinnerFadePulsarSquare (Name("SpinnerFadePulsarSquare"),
-                                                          R(16), C(white), S(1.5f) * velocity, DT(5), M(0));  break;
-          case $(241) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls1"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.4f) * velocity, DT(9), M(1), MDT(10), MX(1)); break;
-          case $(242) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls2"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(9), M(2), MDT(16), MX(1)); break;
-          case $(243) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls3"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(9), M(6), MDT(16), MX(1)); break;
-          case $(244) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls4"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(7), M(0), MDT(24), MX(3)); break;
-          case $(245) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls5"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(17), M(4), MDT(30), MX(4)); break;
-          case $(246) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls6"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(17), M(4), MDT(30), MX(5)); break;
-          case $(247) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls7"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(17), M(4), MDT(30), MX(6)); break;
-          case $(248) ImSpinner::SpinnerRainbowBalls     (Name("SpinnerRainbowBalls7"),
-                                                          R(16), T(1), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(0.9f) * velocity, DT(4), M(0), MDT(30), MX(8)); break;
-          case $(249) ImSpinner::SpinnerRainbowShot      (Name("SpinnerRainbowShot2"),
-                                                          R(16), T(2), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(30), M(1)); break;
-          case $(250) ImSpinner::SpinnerRainbowShot      (Name("SpinnerRainbowShot3"),
-                                                          R(16), T(2), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(30), M(3)); break;
-          case $(251) ImSpinner::SpinnerRainbowShot      (Name("SpinnerRainbowShot2"),
-                                                          R(16), T(2), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(30), M(5)); break;
-          case $(252) ImSpinner::SpinnerRainbowShot      (Name("SpinnerRainbowShot2"),
-                                                          R(16), T(2), ImColor::HSV(0.25f, 0.8f, 0.8f, 0.f), S(1.5f) * velocity, DT(30), M(6)); break;
-#ifdef _IMSPINNER_TEXT_H_
-          case $(253) ImSpinner::SpinnerTextFade        (Name("SpinnerTextFade"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(254) ImSpinner::SpinnerTextUnderline   (Name("SpinnerTextUnderline"),
-                                                          R(30), C(white), S(0.5f) * velocity, T(3), "Loading..."); break;
-          case $(255) ImSpinner::SpinnerTextUnderlineDots(Name("SpinnerTextUnderlineDots"),
-                                                          R(30), C(white), S(0.5f) * velocity, T(3), DT(6), "Loading..."); break;
-          case $(256) ImSpinner::SpinnerTextTyping      (Name("SpinnerTextTyping"),
-                                                          R(30), C(white), S(1.f) * velocity, DT(3), "Loading..."); break;
-          case $(257) ImSpinner::SpinnerTextTyping      (Name("SpinnerTextTypingFull"),
-                                                          R(30), C(white), S(0.5f) * velocity, DT(10), "Loading..."); break;
-          case $(258) ImSpinner::SpinnerTextScroll      (Name("SpinnerTextScroll"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(259) ImSpinner::SpinnerTextColorFill   (Name("SpinnerTextColorFill"),
-                                                          R(30), C(ImColor(0xC0, 0x29, 0x42)), CB(white), S(0.5f) * velocity, M(0), "Loading..."); break;
-          case $(260) ImSpinner::SpinnerTextColorFill   (Name("SpinnerTextColorHighlight"),
-                                                          R(30), C(ImColor(0xC0, 0x29, 0x42)), CB(white), S(0.5f) * velocity, M(1), "Loading..."); break;
-          case $(261) ImSpinner::SpinnerTextScrollColors(Name("SpinnerTextScrollColors"),
-                                                          R(30), C(white), S(0.2f) * velocity, "Loading..."); break;
-          case $(262) ImSpinner::SpinnerTextColorCycle  (Name("SpinnerTextColorCycle"),
-                                                          R(30), C(white), S(0.2f) * velocity, "Loading..."); break;
-          case $(263) ImSpinner::SpinnerTextBounce      (Name("SpinnerTextBounce"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(264) ImSpinner::SpinnerTextSplit       (Name("SpinnerTextSplit"),
-                                                          R(30), C(white), S(1.f) * velocity, M(0), "Loading..."); break;
-          case $(265) ImSpinner::SpinnerTextSplit       (Name("SpinnerTextSplitDelay"),
-                                                          R(30), C(white), S(0.5f) * velocity, M(1), "Loading..."); break;
-          case $(266) ImSpinner::SpinnerTextUnderlineScroll(Name("SpinnerTextUnderlineScroll"),
-                                                          R(30), C(white), S(0.66f) * velocity, T(3), "Loading..."); break;
-          case $(267) ImSpinner::SpinnerTextRoll        (Name("SpinnerTextRoll"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(268) ImSpinner::SpinnerTextColorful    (Name("SpinnerTextColorful"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(269) ImSpinner::SpinnerTextCascade     (Name("SpinnerTextCascade"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(270) ImSpinner::SpinnerTextConveyor    (Name("SpinnerTextConveyor"),
-                                                          R(30), C(white), S(0.33f) * velocity, "Loading..."); break;
-          case $(271) ImSpinner::SpinnerTextReveal      (Name("SpinnerTextReveal"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(272) ImSpinner::SpinnerTextWave        (Name("SpinnerTextWave"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(273) ImSpinner::SpinnerTextSweep       (Name("SpinnerTextSweep"),
-                                                          R(30), C(white), CB(ImColor(0, 0, 0)), S(0.5f) * velocity, "Loading..."); break;
-          case $(274) ImSpinner::SpinnerTextShine       (Name("SpinnerTextShine"),
-                                                          R(30), C(white), CB(ImColor(0, 0, 0)), S(0.5f) * velocity, "Loading..."); break;
-          case $(275) ImSpinner::SpinnerTextScrollSweep (Name("SpinnerTextScrollSweep"),
-                                                          R(30), C(white), CB(ImColor(0, 0, 0)), S(0.5f) * velocity, "Loading..."); break;
-          case $(276) ImSpinner::SpinnerTextSpotlight   (Name("SpinnerTextSpotlight"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(277) ImSpinner::SpinnerTextShake       (Name("SpinnerTextShake"),
-                                                          R(30), C(white), S(1.f) * velocity, M(0), "Loading..."); break;
-          case $(278) ImSpinner::SpinnerTextShake       (Name("SpinnerTextShakeSmooth"),
-                                                          R(30), C(white), S(1.f) * velocity, M(1), "Loading..."); break;
-          case $(279) ImSpinner::SpinnerTextFlip        (Name("SpinnerTextFlip"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(280) ImSpinner::SpinnerTextSpin        (Name("SpinnerTextSpin"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(281) ImSpinner::SpinnerTextTumble      (Name("SpinnerTextTumble"),
-                                                          R(30), C(white), S(0.5f) * velocity, M(0), "Loading..."); break;
-          case $(282) ImSpinner::SpinnerTextTumble      (Name("SpinnerTextTumblePersp"),
-                                                          R(30), C(white), S(0.5f) * velocity, M(1), "Loading..."); break;
-          case $(283) ImSpinner::SpinnerTextSwirl       (Name("SpinnerTextSwirl"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(284) ImSpinner::SpinnerTextRollWave    (Name("SpinnerTextRollWave"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(285) ImSpinner::SpinnerTextVibrate     (Name("SpinnerTextVibrate"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(286) ImSpinner::SpinnerTextGlitch      (Name("SpinnerTextGlitch"),
-                                                          R(30), S(1.f) * velocity, "Loading..."); break;
-          case $(287) ImSpinner::SpinnerTextBlur        (Name("SpinnerTextBlur"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(288) ImSpinner::SpinnerTextDropout     (Name("SpinnerTextDropout"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(289) ImSpinner::SpinnerTextScanline    (Name("SpinnerTextScanline"),
-                                                          R(30), C(white), S(1.f) * velocity, M(0), "Loading..."); break;
-          case $(290) ImSpinner::SpinnerTextScanline    (Name("SpinnerTextScanlineV"),
-                                                          R(30), C(white), S(1.f) * velocity, M(1), "Loading..."); break;
-          case $(291) ImSpinner::SpinnerTextSquash      (Name("SpinnerTextSquash"),
-                                                          R(30), C(white), S(1.f) * velocity, "Loading..."); break;
-          case $(292) ImSpinner::SpinnerTextScramble    (Name("SpinnerTextScramble"),
-                                                          R(30), C(white), S(1.f) * velocity); break;
-          case $(293) ImSpinner::SpinnerTextDecode      (Name("SpinnerTextDecode"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-          case $(294) ImSpinner::SpinnerTextVanish      (Name("SpinnerTextVanish"),
-                                                          R(30), C(white), S(0.5f) * velocity, "Loading..."); break;
-#endif
-          case $(295) ImSpinner::SpinnerDotsTyping      (Name("SpinnerDotsTyping"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, DT(3)); break;
-          case $(296) ImSpinner::SpinnerDotsStep        (Name("SpinnerDotsStep"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, DT(3)); break;
-          case $(297) ImSpinner::SpinnerDotsGather      (Name("SpinnerDotsGather"),
-                                                          R(16), T(4), C(white), S(0.5f) * velocity, DT(3)); break;
-          case $(298) ImSpinner::SpinnerDotsShift       (Name("SpinnerDotsShift"),
-                                                          R(16), T(4), C(white), S(0.5f) * velocity); break;
-          case $(299) ImSpinner::SpinnerDotsOrbit       (Name("SpinnerDotsOrbit"),
-                                                          R(16), T(4), C(white), S(0.66f) * velocity); break;
-          case $(300) ImSpinner::SpinnerDotsCircle      (Name("SpinnerDotsCircle"),
-                                                          R(16), T(4), C(white), S(0.66f) * velocity); break;
-          case $(301) ImSpinner::SpinnerDotsSquare      (Name("SpinnerDotsSquare"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(302) ImSpinner::SpinnerDotsShuffle     (Name("SpinnerDotsShuffle"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(303) ImSpinner::SpinnerDotsSplit       (Name("SpinnerDotsSplit"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(304) ImSpinner::SpinnerDotsLeader      (Name("SpinnerDotsLeader"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(305) ImSpinner::SpinnerDotsRolling     (Name("SpinnerDotsRolling"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(306) ImSpinner::SpinnerDotsTriangle    (Name("SpinnerDotsTriangle"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(307) ImSpinner::SpinnerDotsCascade     (Name("SpinnerDotsCascade"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(308) ImSpinner::SpinnerDotsSwap        (Name("SpinnerDotsSwap"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(309) ImSpinner::SpinnerDotsSpread      (Name("SpinnerDotsSpread"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(310) ImSpinner::SpinnerDotsTwin        (Name("SpinnerDotsTwin"),
-                                                          R(16), T(4), C(white), S(0.5f) * velocity); break;
-          case $(311) ImSpinner::SpinnerDotsHop         (Name("SpinnerDotsHop"),
-                                                          R(16), T(4), C(white), S(1.f / 1.5f) * velocity); break;
-          case $(312) ImSpinner::SpinnerDotsJiggle      (Name("SpinnerDotsJiggle"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(313) ImSpinner::SpinnerDotsVibrate     (Name("SpinnerDotsVibrate"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(314) ImSpinner::SpinnerDotsWiper       (Name("SpinnerDotsWiper"),
-                                                          R(16), T(4), C(white), S(2.f) * velocity); break;
-          case $(315) ImSpinner::SpinnerDotsCollapse    (Name("SpinnerDotsCollapse"),
-                                                          R(16), T(4), C(white), S(0.5f) * velocity); break;
-          case $(316) ImSpinner::SpinnerDotsFlip        (Name("SpinnerDotsFlip"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(317) ImSpinner::SpinnerDotsTurn        (Name("SpinnerDotsTurn"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(318) ImSpinner::SpinnerDotsCarousel    (Name("SpinnerDotsCarousel"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(319) ImSpinner::SpinnerDotsHalfTurn    (Name("SpinnerDotsHalfTurn"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(320) ImSpinner::SpinnerDotsSlideFlip    (Name("SpinnerDotsSlideFlip"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(321) ImSpinner::SpinnerDotsStaggerTurn  (Name("SpinnerDotsStaggerTurn"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(322) ImSpinner::SpinnerDotsStretch      (Name("SpinnerDotsStretch"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(323) ImSpinner::SpinnerDotsMirrorStretch(Name("SpinnerDotsMirrorStretch"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(324) ImSpinner::SpinnerDotsPinch        (Name("SpinnerDotsPinch"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(325) ImSpinner::SpinnerDotsCorners      (Name("SpinnerDotsCorners"),
-                                                          R(16), T(4), C(white), S(2.f) * velocity); break;
-          case $(326) ImSpinner::SpinnerDotsNudgeRotate  (Name("SpinnerDotsNudgeRotate"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(327) ImSpinner::SpinnerDotsUnfold        (Name("SpinnerDotsUnfold"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(328) ImSpinner::SpinnerDotsShuttle     (Name("SpinnerDotsShuttle"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(329) ImSpinner::SpinnerDotsSpreadShuttle(Name("SpinnerDotsSpreadShuttle"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(330) ImSpinner::SpinnerDotsTriad         (Name("SpinnerDotsTriad"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(331) ImSpinner::SpinnerDotsSatellite   (Name("SpinnerDotsSatellite"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(332) ImSpinner::SpinnerDotsTrack       (Name("SpinnerDotsTrack"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity); break;
-          case $(333) ImSpinner::SpinnerBarsSeqPulse    (Name("SpinnerBarsSeqPulse"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(334) ImSpinner::SpinnerBarsCascadeGrow (Name("SpinnerBarsCascadeGrow"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(335) ImSpinner::SpinnerBarsRise        (Name("SpinnerBarsRise"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(336) ImSpinner::SpinnerBarsCornerHop   (Name("SpinnerBarsCornerHop"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(337) ImSpinner::SpinnerBarsDiagonalGrow(Name("SpinnerBarsDiagonalGrow"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(338) ImSpinner::SpinnerBarsBounceCenter(Name("SpinnerBarsBounceCenter"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(339) ImSpinner::SpinnerBarsScaleAlt    (Name("SpinnerBarsScaleAlt"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(340) ImSpinner::SpinnerBarsCornerWave  (Name("SpinnerBarsCornerWave"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(341) ImSpinner::SpinnerBarsJump        (Name("SpinnerBarsJump"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(342) ImSpinner::SpinnerBarsDoubleRow   (Name("SpinnerBarsDoubleRow"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(343) ImSpinner::SpinnerBarsSixPulse  (Name("SpinnerBarsSixPulse"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(344) ImSpinner::SpinnerBarsSixStagger (Name("SpinnerBarsSixStagger"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(345) ImSpinner::SpinnerBarsMorphPlus (Name("SpinnerBarsMorphPlus"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(346) ImSpinner::SpinnerBarsFlipSix   (Name("SpinnerBarsFlipSix"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(347) ImSpinner::SpinnerBarsSwapTriBottom(Name("SpinnerBarsSwapTriBottom"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(348) ImSpinner::SpinnerBarsSwapTriZigzag(Name("SpinnerBarsSwapTriZigzag"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(349) ImSpinner::SpinnerBarsMorphDiagonal(Name("SpinnerBarsMorphDiagonal"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(350) ImSpinner::SpinnerBarsSlideDiagonal(Name("SpinnerBarsSlideDiagonal"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(351) ImSpinner::SpinnerBarsConicAlternate(Name("SpinnerBarsConicAlternate"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(352) ImSpinner::SpinnerBarsConicWalk  (Name("SpinnerBarsConicWalk"),
-                                                          R(16), T(6), C(white), S(1.5f) * velocity, M(0)); break;
-          case $(353) ImSpinner::SpinnerBarsMarchIn   (Name("SpinnerBarsMarchIn"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(354) ImSpinner::SpinnerBarsMarchDown (Name("SpinnerBarsMarchDown"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(355) ImSpinner::SpinnerBarsWaveSkew  (Name("SpinnerBarsWaveSkew"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(356) ImSpinner::SpinnerBarsRowDrop   (Name("SpinnerBarsRowDrop"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(357) ImSpinner::SpinnerBarsZigzagRows(Name("SpinnerBarsZigzagRows"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(358) ImSpinner::SpinnerBarsFillCascade(Name("SpinnerBarsFillCascade"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(359) ImSpinner::SpinnerBarsPingPongRows(Name("SpinnerBarsPingPongRows"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(360) ImSpinner::SpinnerBarsWaveRowsWide(Name("SpinnerBarsWaveRowsWide"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(361) ImSpinner::SpinnerBarsGridFade  (Name("SpinnerBarsGridFade"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(0)); break;
-          case $(362) ImSpinner::SpinnerBarsGridSpread(Name("SpinnerBarsGridSpread"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(0)); break;
-          case $(363) ImSpinner::SpinnerBarsSeqPulse    (Name("SpinnerBarsSeqPulseM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(364) ImSpinner::SpinnerBarsCascadeGrow (Name("SpinnerBarsCascadeGrowM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(365) ImSpinner::SpinnerBarsRise        (Name("SpinnerBarsRiseM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(366) ImSpinner::SpinnerBarsCornerHop   (Name("SpinnerBarsCornerHopM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(367) ImSpinner::SpinnerBarsDiagonalGrow(Name("SpinnerBarsDiagonalGrowM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(368) ImSpinner::SpinnerBarsBounceCenter(Name("SpinnerBarsBounceCenterM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(369) ImSpinner::SpinnerBarsScaleAlt    (Name("SpinnerBarsScaleAltM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(370) ImSpinner::SpinnerBarsCornerWave  (Name("SpinnerBarsCornerWaveM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(371) ImSpinner::SpinnerBarsJump        (Name("SpinnerBarsJumpM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(372) ImSpinner::SpinnerBarsDoubleRow   (Name("SpinnerBarsDoubleRowM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(373) ImSpinner::SpinnerBarsSixPulse  (Name("SpinnerBarsSixPulseM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(374) ImSpinner::SpinnerBarsSixStagger (Name("SpinnerBarsSixStaggerM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(375) ImSpinner::SpinnerBarsMorphPlus (Name("SpinnerBarsMorphPlusM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(376) ImSpinner::SpinnerBarsFlipSix   (Name("SpinnerBarsFlipSixM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(377) ImSpinner::SpinnerBarsSwapTriBottom(Name("SpinnerBarsSwapTriBottomM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(378) ImSpinner::SpinnerBarsSwapTriZigzag(Name("SpinnerBarsSwapTriZigzagM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(379) ImSpinner::SpinnerBarsMorphDiagonal(Name("SpinnerBarsMorphDiagonalM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(380) ImSpinner::SpinnerBarsSlideDiagonal(Name("SpinnerBarsSlideDiagonalM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(381) ImSpinner::SpinnerBarsConicAlternate(Name("SpinnerBarsConicAlternateM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(382) ImSpinner::SpinnerBarsConicWalk  (Name("SpinnerBarsConicWalkM1"),
-                                                          R(16), T(6), C(white), S(1.5f) * velocity, M(2)); break;
-          case $(383) ImSpinner::SpinnerBarsMarchIn   (Name("SpinnerBarsMarchInM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(384) ImSpinner::SpinnerBarsMarchDown (Name("SpinnerBarsMarchDownM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(385) ImSpinner::SpinnerBarsWaveSkew  (Name("SpinnerBarsWaveSkewM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(386) ImSpinner::SpinnerBarsRowDrop   (Name("SpinnerBarsRowDropM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(387) ImSpinner::SpinnerBarsZigzagRows(Name("SpinnerBarsZigzagRowsM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(388) ImSpinner::SpinnerBarsFillCascade(Name("SpinnerBarsFillCascadeM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(389) ImSpinner::SpinnerBarsPingPongRows(Name("SpinnerBarsPingPongRowsM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(390) ImSpinner::SpinnerBarsWaveRowsWide(Name("SpinnerBarsWaveRowsWideM1"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(2)); break;
-          case $(391) ImSpinner::SpinnerBarsGridFade  (Name("SpinnerBarsGridFadeM1"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(2)); break;
-          case $(392) ImSpinner::SpinnerBarsGridSpread(Name("SpinnerBarsGridSpreadM1"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(2)); break;
-          case $(393) ImSpinner::SpinnerBarsStretch     (Name("SpinnerBarsStretch"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(394) ImSpinner::SpinnerBarsStretchSeq  (Name("SpinnerBarsStretchSeq"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(395) ImSpinner::SpinnerBarsBounceBall  (Name("SpinnerBarsBounceBall"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(396) ImSpinner::SpinnerBarsKnockDots   (Name("SpinnerBarsKnockDots"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(397) ImSpinner::SpinnerBarsStaircase   (Name("SpinnerBarsStaircase"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(398) ImSpinner::SpinnerBarsKnockAway   (Name("SpinnerBarsKnockAway"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(399) ImSpinner::SpinnerBarsGates       (Name("SpinnerBarsGates"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(400) ImSpinner::SpinnerBarsCapture     (Name("SpinnerBarsCapture"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(401) ImSpinner::SpinnerBarsEscape      (Name("SpinnerBarsEscape"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(402) ImSpinner::SpinnerBarsDevour      (Name("SpinnerBarsDevour"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(403) ImSpinner::SpinnerBarsLift        (Name("SpinnerBarsLift"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(404) ImSpinner::SpinnerBarsGapSlide    (Name("SpinnerBarsGapSlide"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(405) ImSpinner::SpinnerBarsConverge    (Name("SpinnerBarsConverge"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(406) ImSpinner::SpinnerBarsSwapEnds    (Name("SpinnerBarsSwapEnds"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(407) ImSpinner::SpinnerBarsRelay       (Name("SpinnerBarsRelay"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(408) ImSpinner::SpinnerBarsPush        (Name("SpinnerBarsPush"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(409) ImSpinner::SpinnerBarsPushWave    (Name("SpinnerBarsPushWave"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(410) ImSpinner::SpinnerBarsGather      (Name("SpinnerBarsGather"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(411) ImSpinner::SpinnerBarsSplit       (Name("SpinnerBarsSplit"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(412) ImSpinner::SpinnerBarsSlot        (Name("SpinnerBarsSlot"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(413) ImSpinner::SpinnerConicGrid       (Name("SpinnerConicGrid"),
-                                                          R(16), T(6), C(white), S(1.f) * velocity, M(0)); break;
-          case $(414) ImSpinner::SpinnerArcArrow        (Name("SpinnerArcArrow"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(0)); break;
-          case $(415) ImSpinner::SpinnerOrbitMoon       (Name("SpinnerOrbitMoon"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(0)); break;
-          case $(416) ImSpinner::SpinnerConicWheels     (Name("SpinnerConicWheels"),
-                                                          R(16), T(4), C(white), S(1.f) * velocity, M(0)); break;
-          case $(417) ImSpinner::SpinnerDotRing         (Name("SpinnerDotRing"),
-                                                          R(16), T(3), C(white), S(1.f) * velocity, M(0)); break;
-          case $(418) ImSpinner::SpinnerMorphShape      (Name("SpinnerMorphShape"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(419) ImSpinner::SpinnerFlipTriangle    (Name("SpinnerFlipTriangle"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(420) ImSpinner::SpinnerFoldSquare      (Name("SpinnerFoldSquare"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(421) ImSpinner::SpinnerPinwheel        (Name("SpinnerPinwheel"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(422) ImSpinner::SpinnerCornerSquares   (Name("SpinnerCornerSquares"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(423) ImSpinner::SpinnerSplitSquare     (Name("SpinnerSplitSquare"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(424) ImSpinner::SpinnerCornerBurst     (Name("SpinnerCornerBurst"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(425) ImSpinner::SpinnerSkewSquare      (Name("SpinnerSkewSquare"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(426) ImSpinner::SpinnerTumbleSquare    (Name("SpinnerTumbleSquare"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(427) ImSpinner::SpinnerTriDiamond      (Name("SpinnerTriDiamond"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(428) ImSpinner::SpinnerTwinBlades      (Name("SpinnerTwinBlades"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(429) ImSpinner::SpinnerCrossBlades     (Name("SpinnerCrossBlades"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(430) ImSpinner::SpinnerDriftSquare     (Name("SpinnerDriftSquare"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(431) ImSpinner::SpinnerPieBounce       (Name("SpinnerPieBounce"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(432) ImSpinner::SpinnerLeapFrog        (Name("SpinnerLeapFrog"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(433) ImSpinner::SpinnerPlusSquares     (Name("SpinnerPlusSquares"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(434) ImSpinner::SpinnerSevenMarch      (Name("SpinnerSevenMarch"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(435) ImSpinner::SpinnerCornerArcs      (Name("SpinnerCornerArcs"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(436) ImSpinner::SpinnerWalkBlocks      (Name("SpinnerWalkBlocks"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(437) ImSpinner::SpinnerTumbleHalfDisc  (Name("SpinnerTumbleHalfDisc"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(438) ImSpinner::SpinnerFoldHalfDisc    (Name("SpinnerFoldHalfDisc"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(439) ImSpinner::SpinnerWiperArrow      (Name("SpinnerWiperArrow"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(440) ImSpinner::SpinnerSkewSquares     (Name("SpinnerSkewSquares"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(441) ImSpinner::SpinnerStretchSquares  (Name("SpinnerStretchSquares"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(442) ImSpinner::SpinnerTriPie          (Name("SpinnerTriPie"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(443) ImSpinner::SpinnerShuffleBars     (Name("SpinnerShuffleBars"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(444) ImSpinner::SpinnerHingeTumble     (Name("SpinnerHingeTumble"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(445) ImSpinner::SpinnerDiagonalFlip    (Name("SpinnerDiagonalFlip"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(446) ImSpinner::SpinnerPulseGrid       (Name("SpinnerPulseGrid"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(447) ImSpinner::SpinnerMarchGrid       (Name("SpinnerMarchGrid"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(448) ImSpinner::SpinnerSpinBars        (Name("SpinnerSpinBars"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(449) ImSpinner::SpinnerMorphDots       (Name("SpinnerMorphDots"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(450) ImSpinner::SpinnerCombDiscs       (Name("SpinnerCombDiscs"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          case $(451) ImSpinner::SpinnerOrbitDisc       (Name("SpinnerOrbitDisc"),
-                                                          R(16), T(1), C(white), S(1.f) * velocity, M(0)); break;
-          }
-#undef $
+          ImDrawList *draw_list = ImGui::GetWindowDrawList();
+          const int vtx_begin = draw_list->VtxBuffer.Size, idx_begin = draw_list->IdxBuffer.Size, cmd_begin = draw_list->CmdBuffer.Size;
+          const auto time_begin = std::chrono::steady_clock::now();
+
+          cci = spinner_idx;
+          entries[spinner_idx].draw(entries[spinner_idx].name);
+
+          const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - time_begin).count();
+          SpinnerProfile &prof = profiles[spinner_idx];
+          prof.ns = (prof.ns > 0.0) ? (prof.ns * 0.95 + ns * 0.05) : ns;
+          prof.vtx = draw_list->VtxBuffer.Size - vtx_begin;
+          prof.idx = draw_list->IdxBuffer.Size - idx_begin;
+          prof.cmd = draw_list->CmdBuffer.Size - cmd_begin;
         }
         ImGui::PopID();
       };
@@ -1011,42 +1084,42 @@ namespace ImSpinner
             style.ItemSpacing = style.WindowPadding = {0.f, 0.f};
 
             // -----------------------------------------------------------------
-            // For drawing spinners used 'Row-wrap' layout, same as in
-            // Dear ImGui Demo > Layout > Basic Horizontal Layout > Manual wrapping:
-            //   https://github.com/ocornut/imgui/blob/1029f57b8aa9118d08413d1d8a6dd9d32cf0d5f1/imgui_demo.cpp#L2866-L2878
-
-            const float region_visible_x2 = ImGui::GetWindowPos().x + ImGui::GetColumnWidth();
+            // Spinners are laid out as a grid of fixed-size cells, as many per row as fit the column, and the
+            // rows are virtualized with ImGuiListClipper: only rows in view create child windows and draw.
 
             const ImVec2 item_size = ImVec2(widget_size, widget_size);
+            const float region_w = ImGui::GetWindowPos().x + ImGui::GetColumnWidth() - ImGui::GetCursorScreenPos().x;
+            const int columns = (item_size.x > 0.f) ? ImMax(1, (int)(region_w / item_size.x)) : 1;
 
-            // Text-based animation cells; everything else is a graphical spinner.
-            static const int text_spinners[] = { 134, 150, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294 };
-            static const int dot_spinners[] = { 2, 3, 6, 11, 12, 13, 14, 15, 22, 23, 24, 45, 84, 85, 91, 93, 97, 98, 115, 120, 121, 122, 123, 124, 125, 132, 133, 137, 138, 139, 141, 142, 143, 145, 155, 156, 169, 170, 171, 172, 173, 175, 176, 177, 179, 185, 186, 194, 195, 196, 198, 199, 200, 204, 205, 212, 213, 214, 215, 225, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332 };
-            static const int bar_spinners[] = { 10, 19, 27, 30, 31, 32, 33, 51, 140, 151, 152, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412 };
-            static const int shape_spinners[] = { 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451 };
-            auto in_list = [](const int *arr, int n, int idx) { for (int k = 0; k < n; ++k) if (arr[k] == idx) return true; return false; };
-            auto category = [&](int idx) {                   // 0 = spinners, 1 = text, 2 = dots, 3 = bars, 4 = shapes
-              if (in_list(text_spinners, (int)(sizeof(text_spinners) / sizeof(int)), idx)) return 1;
-              if (in_list(dot_spinners, (int)(sizeof(dot_spinners) / sizeof(int)), idx)) return 2;
-              if (in_list(bar_spinners, (int)(sizeof(bar_spinners) / sizeof(int)), idx)) return 3;
-              if (in_list(shape_spinners, (int)(sizeof(shape_spinners) / sizeof(int)), idx)) return 4;
-              return 0;
-            };
+            const auto gallery_begin = std::chrono::steady_clock::now();
 
-            // Pick the cells matching the current view mode.
-            std::vector<int> shown;
-            shown.reserve(num_spinners);
-            for (int i = 0; i < num_spinners; i++)
-              if (category(i) == view_mode)
-                shown.push_back(i);
+            // Cells of each view, in registry order. The registry is static, so this is built once.
+            static std::vector<int> views[e_sc_count];
+            static bool views_built = false;
+            if (!views_built) {
+              for (int i = 0; i < num_spinners; i++)
+                views[GetSpinnerInfo(entries[i].type).category].push_back(i);
+              views_built = true;
+            }
+            const std::vector<int> &shown = views[view_mode];
+            const int rows = ((int)shown.size() + columns - 1) / columns;
+            int drawn = 0;
 
-            for(size_t j = 0; j < shown.size(); j++)
+            ImGuiListClipper clipper;
+            clipper.Begin(rows, ImMax(item_size.y, 1.f));
+            while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            for (int j = row * columns; j < ImMin((row + 1) * columns, (int)shown.size()); j++)
             {
               const int current_spi = shown[j];
+              if (j > row * columns)
+                ImGui::SameLine();
+
               // BeginChild here needed to restrict item width&height by specific size
               if( ImGui::BeginChild(100 + current_spi, item_size, false, ImGuiWindowFlags_NoScrollbar) )
               {
                   draw_spinner(current_spi, widget_size);
+                  drawn++;
               }
               ImGui::EndChild();
 
@@ -1060,23 +1133,24 @@ namespace ImSpinner
                   ImGui::TextDisabled("%04u", current_spi);
 
                   // Spinner name
-                  if(__nn.count(current_spi)) {
-                      ImGui::SameLine();
-                      ImGui::Text(" - %s", __nn[current_spi] );
+                  ImGui::SameLine();
+                  ImGui::Text(" - %s", entries[current_spi].name);
+
+                  if (show_profile) {
+                      const SpinnerProfile &prof = profiles[current_spi];
+                      ImGui::Text("%.0f ns/frame, %d vtx, %d idx, %d cmd", prof.ns, prof.vtx, prof.idx, prof.cmd);
                   }
 
                   ImGui::EndTooltip();
                 }
               }
-
-              // -------------------------------------------------------------
-
-              const float last_item_x2 = ImGui::GetItemRectMax().x;
-              const float next_item_x2 = last_item_x2 + style.ItemSpacing.x + item_size.x; // Expected position if next item was on same line
-              if ((j + 1 < shown.size()) && (next_item_x2 < region_visible_x2)) {
-                ImGui::SameLine();
-              }
             }
+            clipper.End();
+
+            const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gallery_begin).count();
+            gallery_ns = (gallery_ns > 0.0) ? (gallery_ns * 0.95 + ns * 0.05) : ns;
+            gallery_cells = (int)shown.size();
+            gallery_drawn = drawn;
 
             // -----------------------------------------------------------------
 
@@ -1106,6 +1180,28 @@ namespace ImSpinner
           ImGui::SliderFloat("Velocity", &velocity, 0.0f, 10.0f, "velocity = %.2f");
           ImGui::Checkbox("Show Numbers", &show_number);
           ImGui::SliderFloat("Grid size", &widget_size, 0.0f, 100.0f, "size = %.2f");
+          static float update_rate = 0.f;
+          if (ImGui::SliderFloat("Update rate", &update_rate, 0.0f, 60.0f, update_rate > 0.f ? "%.0f Hz" : "every frame"))
+            SetSpinnerUpdateRate(update_rate);
+          static float quality = 1.f;
+          if (ImGui::SliderFloat("Quality", &quality, 0.25f, 4.0f, "quality = %.2f"))
+            SetSpinnerQuality(quality);
+          ImGui::Checkbox("Profile", &show_profile);
+          if (show_profile) {
+            ImGui::SameLine();
+            if (ImGui::Button("Copy CSV")) {
+              // Only spinners drawn at least once have a sample; switch through the views to collect them all.
+              ImGuiTextBuffer csv;
+              csv.append("id,name,ns_per_frame,vertices,indices,draw_cmds\n");
+              for (int i = 0; i < num_spinners; i++) {
+                const SpinnerProfile &prof = profiles[i];
+                if (prof.ns > 0.0)
+                  csv.appendf("%d,%s,%.0f,%d,%d,%d\n", i, entries[i].name, prof.ns, prof.vtx, prof.idx, prof.cmd);
+              }
+              ImGui::SetClipboardText(csv.c_str());
+            }
+            ImGui::Text("Gallery: %.1f us/frame, %d of %d cells drawn", gallery_ns / 1000.0, gallery_drawn, gallery_cells);
+          }
 
           // -----------------------------------------------------------------
           // Spinner-related parameters
@@ -1116,35 +1212,38 @@ namespace ImSpinner
             ImGuiColorEditFlags_NoInputs       |
             ImGuiColorEditFlags_NoAlpha;
 
-          if(__nn.count(last_cci)) ImGui::Separator();
+          ImGui::Separator();
 
-          if (__rr.count(last_cci)) ImGui::SliderFloat("Radius", &__rr[last_cci], 0.0f, 100.0f, "radius = %.2f");
-          if (__tt.count(last_cci)) ImGui::SliderFloat("Thickness", &__tt[last_cci], 0.0f, 100.0f, "thickness = %.2f");
-          if (__cc.count(last_cci)) {
-          ImGui::Checkbox("Change Color", &__hc[last_cci]);
-          if (__hc[last_cci]) { __cc[last_cci] = ImColor::HSV(hue * 0.005f, 0.8f, 0.8f); }
+          const unsigned has = params.has[last_cci];
+          if (has & pf_r) ImGui::SliderFloat("Radius", &params.r[last_cci], 0.0f, 100.0f, "radius = %.2f");
+          if (has & pf_t) ImGui::SliderFloat("Thickness", &params.t[last_cci], 0.0f, 100.0f, "thickness = %.2f");
+          if (has & pf_c) {
+          bool cycle = (has & pf_hc) != 0;
+          if (ImGui::Checkbox("Change Color", &cycle)) { params.has[last_cci] ^= pf_hc; }
+          if (cycle) { params.c[last_cci] = ImColor::HSV(hue * 0.005f, 0.8f, 0.8f); }
           else {
               ImGui::SameLine(); ImGui::SetNextItemWidth(120);
-              ImGui::ColorPicker3("##MyColor", (float *)&__cc[last_cci], COLOR_EDIT_FLAGS);
+              ImGui::ColorPicker3("##MyColor", (float *)&params.c[last_cci], COLOR_EDIT_FLAGS);
           }
           }
-          if (__cb.count(last_cci)) {
-              ImGui::Checkbox("Change Bg Color", &__hcb[last_cci]);
-              if (__hcb[last_cci]) { __cb[last_cci] = ImColor::HSV(hue * 0.008f, 0.8f, 0.8f); }
+          if (has & pf_cb) {
+              bool cycle = (has & pf_hcb) != 0;
+              if (ImGui::Checkbox("Change Bg Color", &cycle)) { params.has[last_cci] ^= pf_hcb; }
+              if (cycle) { params.cb[last_cci] = ImColor::HSV(hue * 0.008f, 0.8f, 0.8f); }
               else {
                   ImGui::SameLine(); ImGui::SetNextItemWidth(120);
-                  ImGui::ColorPicker3("##MyBgColor", (float *)&__cb[last_cci], COLOR_EDIT_FLAGS);
+                  ImGui::ColorPicker3("##MyBgColor", (float *)&params.cb[last_cci], COLOR_EDIT_FLAGS);
               }
           }
-          if (__ss.count(last_cci)) ImGui::SliderFloat("Speed", &__ss[last_cci], 0.0f, 100.0f, "speed = %.2f");
-          if (__aa.count(last_cci)) ImGui::SliderFloat("Angle", &__aa[last_cci], 0.0f, PI_2, "angle = %.2f");
-          if (__amn.count(last_cci)) ImGui::SliderFloat("Angle Min", &__amn[last_cci], 0.0f, PI_2, "angle min = %.2f");
-          if (__amx.count(last_cci)) ImGui::SliderFloat("Angle Max", &__amx[last_cci], 0.0f, PI_2, "angle max = %.2f");
-          if (__dt.count(last_cci)) ImGui::SliderInt("Dots", &__dt[last_cci], 1, 100, "dots = %u");
-          if (__mdt.count(last_cci)) ImGui::SliderInt("MidDots", &__mdt[last_cci], 1, 100, "mid dots = %u");
-          if (__dd.count(last_cci)) ImGui::SliderFloat("Delta", &__dd[last_cci], -1.f, 1.f, "delta = %f");
-          if (__mm.count(last_cci)) ImGui::SliderInt("Mode", &__mm[last_cci], 0, 8, "mode = %d");
-          if (__mx.count(last_cci)) ImGui::SliderInt("Ext", &__mx[last_cci], 0, 8, "ext = %d");
+          if (has & pf_s) ImGui::SliderFloat("Speed", &params.s[last_cci], 0.0f, 100.0f, "speed = %.2f");
+          if (has & pf_a) ImGui::SliderFloat("Angle", &params.a[last_cci], 0.0f, PI_2, "angle = %.2f");
+          if (has & pf_amn) ImGui::SliderFloat("Angle Min", &params.amn[last_cci], 0.0f, PI_2, "angle min = %.2f");
+          if (has & pf_amx) ImGui::SliderFloat("Angle Max", &params.amx[last_cci], 0.0f, PI_2, "angle max = %.2f");
+          if (has & pf_dt) ImGui::SliderInt("Dots", &params.dt[last_cci], 1, 100, "dots = %u");
+          if (has & pf_mdt) ImGui::SliderInt("MidDots", &params.mdt[last_cci], 1, 100, "mid dots = %u");
+          if (has & pf_d) ImGui::SliderFloat("Delta", &params.d[last_cci], -1.f, 1.f, "delta = %f");
+          if (has & pf_m) ImGui::SliderInt("Mode", &params.m[last_cci], 0, 8, "mode = %d");
+          if (has & pf_mx) ImGui::SliderInt("Ext", &params.mx[last_cci], 0, 8, "ext = %d");
         }
 
         ImGui::EndTable();
@@ -16,13 +16,14 @@ namespace ImSpinner
     inline void SpinnerBounceDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 3, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float nextItemKoeff = 2.5f;
       const float heightKoeff = 2.f;
       const float heightSpeed = 0.8f;
       const float hsize = dots * (thickness * nextItemKoeff) / 2.f - (thickness * nextItemKoeff) * 0.5f;
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
       const float offset = PI_DIV(dots);
       for (size_t i = 0; i < dots; i++) {
         float a = start + (IM_PI - i * offset);
@@ -31,19 +32,20 @@ namespace ImSpinner
         case 2: a = damped_infinity((float)(start + i * PI_DIV(dots * 2)), radius).second; break;
         }
         float y =  centre.y + ImSin(a * heightSpeed) * thickness * heightKoeff;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), ImMin(y, centre.y)), thickness, color_alpha(color, 1.f), 8);
+        discs.Add(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), ImMin(y, centre.y)), thickness, color_alpha(color, 1.f), 8);
       }
     }
 
     inline void SpinnerZipDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 5)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float nextItemKoeff = 3.5f;
         const float heightKoeff = 2.f;
         const float heightSpeed = 0.8f;
         const float hsize = dots * (thickness * nextItemKoeff) / 2.f - (thickness * nextItemKoeff) * 0.5f;
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float offset = PI_DIV(dots);
 
         for (size_t i = 0; i < dots; i++)
@@ -51,18 +53,19 @@ namespace ImSpinner
             const float sina = ImSin((start + (IM_PI - i * offset)) * heightSpeed);
             const float y = ImMin(centre.y + sina * thickness * heightKoeff, centre.y);
             const float deltay = ImAbs(y - centre.y);
-            window->DrawList->AddCircleFilled(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), y), thickness, color_alpha(color, 1.f), 8);
-            window->DrawList->AddCircleFilled(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), y + 2 * deltay), thickness, color_alpha(color, 1.f), 8);
+            discs.Add(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), y), thickness, color_alpha(color, 1.f), 8);
+            discs.Add(ImVec2(centre.x - hsize + i * (thickness * nextItemKoeff), y + 2 * deltay), thickness, color_alpha(color, 1.f), 8);
         }
     }
 
     inline void SpinnerDotsToPoints(const char *label, float radius, float thickness, float offset_k, const ImColor &color = white, float speed = 1.8f, size_t dots = 5)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float nextItemKoeff = 3.5f;
         const float hsize = dots * (thickness * nextItemKoeff) / 2.f - (thickness * nextItemKoeff) * 0.5f;
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const float offset = PI_DIV(dots);
 
         float out_h, out_s, out_v;
@@ -72,7 +75,7 @@ namespace ImSpinner
             for (size_t i = 0; i < dots; i++) {
                 const float xx = ImMax(sina * (i * (thickness * nextItemKoeff)), 0.f);
                 ImColor c = color_alpha(ImColor::HSV(out_h + i * ((1.f / dots) * 2.f), out_s, out_v), 1.f);
-                window->DrawList->AddCircleFilled(ImVec2(centre.x - hsize + xx, centre.y), thickness, c, 8);
+                discs.Add(ImVec2(centre.x - hsize + xx, centre.y), thickness, c, 8);
             }
         } else {
             for (size_t i = 0; i < dots; i++) {
@@ -80,7 +83,7 @@ namespace ImSpinner
                 const float xx = ImMax(1.f * (i * (thickness * nextItemKoeff)), 0.f);
                 const float th = sina * thickness;
                 ImColor c = color_alpha(ImColor::HSV(out_h + i * ((1.f / dots) * 2.f), out_s, out_v), 1.f);
-                window->DrawList->AddCircleFilled(ImVec2(centre.x - hsize + xx, centre.y), th, c, 8);
+                discs.Add(ImVec2(centre.x - hsize + xx, centre.y), th, c, 8);
             }
         }
     }
@@ -92,7 +95,7 @@ namespace ImSpinner
         const float nextItemKoeff = 3.5f;
         const float heightSpeed = 0.8f;
         const float hsize = dots * (thickness * nextItemKoeff) / 2.f - (thickness * nextItemKoeff) * 0.5f;
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float offset = PI_DIV(dots);
         const float hradius = (radius);
 
@@ -118,11 +121,12 @@ namespace ImSpinner
     inline void SpinnerWaveDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int lt = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float nextItemKoeff = 2.5f;
         const float dots = (size.x / (thickness * nextItemKoeff));
         const float offset = PI_DIV(dots);
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         float out_h, out_s, out_v;
         ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
@@ -131,15 +135,16 @@ namespace ImSpinner
             float a = start + (IM_PI - i * offset);
             float y = centre.y + ImSin(a) * (size.y / 2.f);
             ImColor c = ImColor::HSV(out_h + i * (1.f / dots * 2.f), out_s, out_v);
-            window->DrawList->AddCircleFilled(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, y), thickness, color_alpha(c, 1.f), lt);
+            discs.Add(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, y), thickness, color_alpha(c, 1.f), lt);
         }
     }
 
     inline void SpinnerFadeDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int lt = 8, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float nextItemKoeff = 2.5f;
         const float dots = (size.x / (thickness * nextItemKoeff));
         const float heightSpeed = 0.8f;
@@ -149,15 +154,16 @@ namespace ImSpinner
           float a = mode 
                         ? damped_spring(1, 10.f, 1.0f, ImSin(ImFmod(start + (IM_PI - i * (IM_PI / dots)), PI_2)))
                         : ImSin(start + (IM_PI - i * (IM_PI / dots)) * heightSpeed);
-          window->DrawList->AddCircleFilled(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), thickness, color_alpha(color, ImMax(0.1f, a)), lt);
+          discs.Add(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), thickness, color_alpha(color, ImMax(0.1f, a)), lt);
         }
     }
 
     inline void SpinnerThreeDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int lt = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const float nextItemKoeff = 2.5f;
         const float offset = size.x / 4.f;
 
@@ -167,7 +173,7 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = ab + i * IM_PI - PI_DIV_2;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x - offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x - offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
 
         float ba = start; msize = 2;
@@ -175,15 +181,16 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = -ba + i * IM_PI + PI_DIV_2;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x + offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
     }
 
     inline void SpinnerFiveDots(const char *label, float radius, float thickness, const ImColor &color = 0xffffffff, float speed = 2.8f, int lt = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2 * 2);
+        const float start = detail::AnimTime(speed, PI_2 * 2);
         const float nextItemKoeff = 2.5f;
         const float offset = size.x / 4.f;
 
@@ -193,7 +200,7 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = -ab + i * IM_PI - PI_DIV_2;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x - offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x - offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
 
         float ba = 0; msize = 1;
@@ -201,7 +208,7 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = -ba + i * IM_PI;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(a) * offset, centre.y + offset + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x + ImSin(a) * offset, centre.y + offset + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
 
         float bc = 0; msize = 1;
@@ -209,7 +216,7 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = -bc + i * IM_PI - IM_PI;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(a) * offset, centre.y - offset + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x + ImSin(a) * offset, centre.y - offset + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
 
         float bd = 0; msize = 1;
@@ -217,15 +224,16 @@ namespace ImSpinner
         for (size_t i = 0; i < msize; i++)
         {
             float a = -bd + i * IM_PI + PI_DIV_2;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
+            discs.Add(ImVec2(centre.x + offset + ImSin(a) * offset, centre.y + ImCos(a) * offset), thickness, color_alpha(color, 1.f), lt);
         }
     }
 
     inline void SpinnerMultiFadeDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int lt = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         const float nextItemKoeff = 2.5f;
         const float dots = (size.x / (thickness * nextItemKoeff));
         const float heightSpeed = 0.8f;
@@ -235,7 +243,7 @@ namespace ImSpinner
             for (size_t i = 0; i < dots; i++)
             {
                 float a = start - (IM_PI - i * j * PI_DIV(dots));
-                window->DrawList->AddCircleFilled(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y - (size.y / 2.f) + j * thickness * nextItemKoeff), thickness, color_alpha(color, ImMax(0.1f, ImSin(a * heightSpeed))), lt);
+                discs.Add(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y - (size.y / 2.f) + j * thickness * nextItemKoeff), thickness, color_alpha(color, ImMax(0.1f, ImSin(a * heightSpeed))), lt);
             }
         }
     }
@@ -243,29 +251,31 @@ namespace ImSpinner
     inline void SpinnerScaleDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int lt = 8)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float nextItemKoeff = 2.5f;
         const float heightSpeed = 0.8f;
         const float dots = (size.x / (thickness * nextItemKoeff));
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         for (size_t i = 0; i < dots; i++)
         {
           const float a = start + (IM_PI - i * PI_DIV(dots));
           const float th = thickness * ImSin(a * heightSpeed);
-          window->DrawList->AddCircleFilled(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), thickness, color_alpha(color, 0.1f), lt);
-          window->DrawList->AddCircleFilled(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), th, color_alpha(color, 1.f), lt);
+          discs.Add(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), thickness, color_alpha(color, 0.1f), lt);
+          discs.Add(ImVec2(centre.x - (size.x / 2.f) + i * thickness * nextItemKoeff, centre.y), th, color_alpha(color, 1.f), lt);
         }
     }
 
     inline void SpinnerMovingDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 3)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float nextItemKoeff = 2.5f;
         const float heightKoeff = 2.f;
         const float heightSpeed = 0.8f;
-        const float start = ImFmod((float)ImGui::GetTime() * speed, size.x);
+        const float start = detail::AnimTime(speed, size.x);
 
         float offset = 0;
         for (size_t i = 0; i < dots; i++)
@@ -276,32 +286,38 @@ namespace ImSpinner
           if (offset < thickness) { th = offset; }
           if (offset > size.x - thickness) { th = size.x - offset; }
         
-          window->DrawList->AddCircleFilled(ImVec2(pos.x + offset - thickness, centre.y), th, color_alpha(color, 1.f), 8);
+          discs.Add(ImVec2(pos.x + offset - thickness, centre.y), th, color_alpha(color, 1.f), 8);
         }
     }
 
+    namespace detail {
+      // Angle of the accelerating / braking dots of SpinnerRotateDots, SpinnerOrionDots and SpinnerGalaxyDots.
+      // Each fixed step moves the angle by velocity * advance, speeds up by accel in the first quarter turn of
+      // every half turn and brakes by decel near its end.
+      inline float VelocityDotsStart(ImGuiID id, float accel, float decel, float advance) {
+        struct state_t { float velocity = 0.f, vtime = 0.f; };
+        auto &state = GetState<Integrated<state_t>>(id);
+        const float alpha = Integrate(state, [&] (state_t &s) {
+          const float dtime = ImFmod(s.vtime, IM_PI);
+          s.vtime += s.velocity * advance;
+          if (dtime > 0.f && dtime < PI_DIV_2) { s.velocity += accel; }
+          else if (dtime > IM_PI * 0.9f && dtime < IM_PI) { s.velocity -= decel; }
+          s.velocity = ImClamp(s.velocity, 0.01f, 0.1f);
+        });
+        // Whole turns (also for the 1.x multiples Galaxy uses), keeps the float angle precise over long uptimes.
+        if (state.cur.vtime > PI_2 * 10.f) { state.cur.vtime -= PI_2 * 10.f; state.prev.vtime -= PI_2 * 10.f; }
+        return ImLerp(state.prev.vtime, state.cur.vtime, alpha);
+      }
+    }
+
     inline void SpinnerRotateDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int dots = 2, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      ImGuiStorage* storage = window->DC.StateStorage;
-      const ImGuiID velocityId = window->GetID("##velocity");
-      const ImGuiID vtimeId = window->GetID("##velocitytime");
-
-      float velocity = storage->GetFloat(velocityId, 0.f);
-      float vtime = storage->GetFloat(vtimeId, 0.f);
-     
-      float dtime = ImFmod((float)vtime, IM_PI);
-      float start = (vtime += velocity);
-      if (dtime > 0.f && dtime < PI_DIV_2) { velocity += 0.001f * speed; }
-      else if (dtime > IM_PI * 0.9f && dtime < IM_PI) { velocity -= 0.01f * speed; }
-      if (velocity > 0.1f) velocity = 0.1f;
-      if (velocity < 0.01f) velocity = 0.01f;
+      const float start = detail::VelocityDotsStart(ImGui::GetItemID(), 0.001f * speed, 0.01f * speed, 1.f);
 
-      storage->SetFloat(velocityId, velocity);
-      storage->SetFloat(vtimeId, vtime);
-
-      window->DrawList->AddCircleFilled(centre, thickness, color_alpha(color, 1.f), 8);
+      discs.Add(centre, thickness, color_alpha(color, 1.f), 8);
 
       for (int i = 0; i < dots; i++)
       {
@@ -312,16 +328,16 @@ namespace ImSpinner
           default:
             a = start + (i * PI_2_DIV(dots));
           }
-          window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, color_alpha(color, 1.f), 8);
+          discs.Add(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, color_alpha(color, 1.f), 8);
       }
 
       if (mode == 3) {
           float sm_thickness = thickness * 0.5f;
-          const float bstart = (float)ImGui::GetTime() * speed;
+          const float bstart = detail::AnimTime(speed);
           for (size_t i = 0; i < dots; i++)
           {
               const float b = bstart + (IM_PI - i * PI_DIV(dots) * 2.f);
-              window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(b) * radius, centre.y + ImSin(b) * radius), sm_thickness, color_alpha(color, 1.f), 8);
+              discs.Add(ImVec2(centre.x + ImCos(b) * radius, centre.y + ImSin(b) * radius), sm_thickness, color_alpha(color, 1.f), 8);
           }
       }
     }
@@ -329,33 +345,18 @@ namespace ImSpinner
     inline void SpinnerOrionDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int arcs = 4)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        ImGuiStorage* storage = window->DC.StateStorage;
-        const ImGuiID velocityId = window->GetID("##velocity");
-        const ImGuiID vtimeId = window->GetID("##velocitytime");
-
-        float velocity = storage->GetFloat(velocityId, 0.f);
-        float vtime = storage->GetFloat(vtimeId, 0.f);
-
-        float dtime = ImFmod((float)vtime, IM_PI);
-        float start = (vtime += velocity);
-        if (dtime > 0.f && dtime < PI_DIV_2) { velocity += 0.001f * speed; }
-        else if (dtime > IM_PI * 0.9f && dtime < IM_PI) { velocity -= 0.01f * speed; }
+        const float start = detail::VelocityDotsStart(ImGui::GetItemID(), 0.001f * speed, 0.01f * speed, 1.f);
 
-        if (velocity > 0.1f) velocity = 0.1f;
-        if (velocity < 0.01f) velocity = 0.01f;
-
-        storage->SetFloat(velocityId, velocity);
-        storage->SetFloat(vtimeId, vtime);
-
-        window->DrawList->AddCircleFilled(centre, thickness, color_alpha(color, 1.f), 8);
+        discs.Add(centre, thickness, color_alpha(color, 1.f), 8);
 
         for (int j = 1; j < arcs; ++j) {
             const float r = (radius / (arcs + 1)) * j;
             for (int i = 0; i < j + 1; i++)
             {
                 const float a = start + (i * PI_2_DIV(j+1));
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thickness, color_alpha(color, 1.f), 8);
+                discs.Add(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thickness, color_alpha(color, 1.f), 8);
             }
         }
     }
@@ -363,33 +364,18 @@ namespace ImSpinner
     inline void SpinnerGalaxyDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, int arcs = 4)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        ImGuiStorage* storage = window->DC.StateStorage;
-        const ImGuiID velocityId = window->GetID("##velocity");
-        const ImGuiID vtimeId = window->GetID("##velocitytime");
-
-        float velocity = storage->GetFloat(velocityId, 0.f);
-        float vtime = storage->GetFloat(vtimeId, 0.f);
-
-        float dtime = ImFmod((float)vtime, IM_PI);
-        float start = (vtime += (velocity * speed));
-        if (dtime > 0.f && dtime < PI_DIV_2) { velocity += 0.001f; }
-        else if (dtime > IM_PI * 0.9f && dtime < IM_PI) { velocity -= 0.01f; }
+        const float start = detail::VelocityDotsStart(ImGui::GetItemID(), 0.001f, 0.01f, speed);
 
-        if (velocity > 0.1f) velocity = 0.1f;
-        if (velocity < 0.01f) velocity = 0.01f;
-
-        storage->SetFloat(velocityId, velocity);
-        storage->SetFloat(vtimeId, vtime);
-
-        window->DrawList->AddCircleFilled(centre, thickness, color_alpha(color, 1.f), 8);
+        discs.Add(centre, thickness, color_alpha(color, 1.f), 8);
 
         for (int j = 1; j < arcs; ++j) {
             const float r = ((j / (float)arcs) * radius);
             for (int i = 0; i < arcs; i++)
             {
                 const float a = start * (1.f + j * 0.1f) + (i * PI_2_DIV(arcs));
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thickness, color_alpha(color, 1.f), 8);
+                discs.Add(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thickness, color_alpha(color, 1.f), 8);
             }
         }
     }
@@ -397,8 +383,9 @@ namespace ImSpinner
     inline void SpinnerIncDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 6)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed, PI_2);  // one turn, a whole number of PI / dots steps
       float astart = ImFmod(start, PI_DIV(dots));
       start -= astart;
       dots = ImMin<size_t>(dots, 32);
@@ -407,16 +394,17 @@ namespace ImSpinner
       {
         float a = start + (i * PI_DIV(dots - 1));
         ImColor c = color_alpha(color, ImMax(0.1f, i / (float)dots));
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
+        discs.Add(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
       }
     }
 
     inline void SpinnerIncFullDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 4)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       dots = ImMin<size_t>(dots, 32);
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed, PI_2);
       float astart = ImFmod(start, IM_PI / dots);
       start -= astart;
       const float bg_angle_offset = IM_PI / dots;
@@ -425,22 +413,23 @@ namespace ImSpinner
       {
         float a = start + (i * bg_angle_offset);
         ImColor c = color_alpha(color, 0.1f);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
+        discs.Add(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
       }
 
       for (size_t i = 0; i < dots; i++)
       {
         float a = start + (i * bg_angle_offset);
         ImColor c = color_alpha(color, ImMax(0.1f, i / (float)dots));
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
+        discs.Add(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), thickness, c, 8);
       }
     }
 
     inline void SpinnerIncScaleDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 6, float angle = 0.f, int mode = 0)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      float start = (float)ImGui::GetTime() * speed;
+      float start = detail::AnimTime(speed);
       float astart = ImFmod(start, IM_PI / dots);
       start -= astart;
       const float bg_angle_offset = IM_PI / dots;
@@ -451,15 +440,17 @@ namespace ImSpinner
         float a = start + (i * bg_angle_offset);
         a += ease((ease_mode)mode, a, angle);
         float th = thickness * ImMax(0.1f, i / (float)dots);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), th, color_alpha(color, 1.f), 8);
+        discs.Add(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius), th, color_alpha(color, 1.f), 8);
       }
     }
 
     inline void SpinnerSomeScaleDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f, size_t dots = 6, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        float start = (float)ImGui::GetTime() * speed;
+        // mode 1 turns ring j at 1 + j / 20 times the base rate: 20 turns are a whole number of turns for all rings.
+        float start = detail::AnimTime(speed, mode ? PI_2 * 20.f : PI_2);
         float astart = ImFmod(start, IM_PI / dots);
         start -= astart;
         const float bg_angle_offset = IM_PI / dots;
@@ -473,7 +464,7 @@ namespace ImSpinner
                 float a = start * (mode ? (1.f + j * 0.05f) : 1.f) + (i * bg_angle_offset);
                 float th = thickness * ImMax(0.1f, i / (float)dots);
                 float thh = th * (1.f - (0.2f * j));
-                window->DrawList->AddCircleFilled(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thh, color_alpha(color, 1.f), 8);
+                discs.Add(ImVec2(centre.x + ImCos(a) * r, centre.y + ImSin(a) * r), thh, color_alpha(color, 1.f), 8);
             }
         }
     }
@@ -482,7 +473,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, IM_PI);
+        const float start = detail::AnimTime(speed, IM_PI);
         const float radius1 = (2.f * ImSin(start)) * radius;
 
         float startb = ImFmod(start, PI_DIV_2);
@@ -500,30 +491,28 @@ namespace ImSpinner
     inline void SpinnerSquareRandomDots(const char *label, float radius, float thickness, const ImColor &bg, const ImColor &color, float speed)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
         const float offset_block = radius * 2.f / 3.f;
         ImVec2 lt{centre.x - offset_block, centre.y - offset_block};
 
-        int start = (int)ImFmod((float)ImGui::GetTime() * speed, 9.f);
-
-        ImGuiStorage* storage = window->DC.StateStorage;
-        const ImGuiID vtimeId = window->GetID("##vtime");
-        const ImGuiID vvald = window->GetID("##vval");
-        int vtime = storage->GetInt(vtimeId, 0);
-        int vval = storage->GetInt(vvald, 0);
+        int start = (int)detail::AnimTime(speed, 9.f);
+        spinner_scope.NextChange(detail::NextStepTime(speed, 9.f));
 
-        if (vtime != start) {
-            vval = rand() % 9;
-            storage->SetInt(vvald, vval);
-            storage->SetInt(vtimeId, start);
+        struct state_t { int vtime = 0, vval = 0; };
+        state_t &state = detail::GetState<state_t>(ImGui::GetItemID());
+        if (state.vtime != start) {
+            state.vval = rand() % 9;
+            state.vtime = start;
         }
+        const int vval = state.vval;
 
         const ImVec2ih poses[] = {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}, {1, 1}};
         int ti = 0;
         for (const auto &rpos: poses)
         {
             const ImColor &c = (ti == vval) ? color : bg;
-            window->DrawList->AddCircleFilled(ImVec2(lt.x + rpos.x * (offset_block), lt.y + rpos.y * offset_block), thickness,
+            discs.Add(ImVec2(lt.x + rpos.x * (offset_block), lt.y + rpos.y * offset_block), thickness,
                                               color_alpha(c, 1.f));
             ti++;
         }
@@ -533,14 +522,15 @@ namespace ImSpinner
     inline void SpinnerHboDots(const char *label, float radius, float thickness, const ImColor &color = white, float minfade = 0.0f, float ryk = 0.f, float speed = 1.1f, size_t dots = 6, int mode = 0)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         for (size_t i = 0; i < dots; i++)
         {
             const float ab = ease((ease_mode)mode, start + i * PI_DIV(2) / dots, IM_PI, 1.0f, 0.0f);
             const float astart = start + ab + PI_2_DIV(dots) * i;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(astart) * radius, centre.y + ryk * ImCos(astart) * radius), thickness,
+            discs.Add(ImVec2(centre.x + ImSin(astart) * radius, centre.y + ryk * ImCos(astart) * radius), thickness,
                                               color_alpha(color, ImMax(minfade, ImSin(astart + PI_DIV_2))),
                                               8);
         }
@@ -550,7 +540,7 @@ namespace ImSpinner
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         const float astart = ImFmod(start, IM_PI * 2.f);
         const float bstart = astart + IM_PI;
@@ -572,13 +562,14 @@ namespace ImSpinner
     inline void SpinnerTwinHboDots(const char *label, float radius, float thickness, const ImColor &color = white, float minfade = 0.0f, float ryk = 0.f, float speed = 1.1f, size_t dots = 6, float delta = 0.f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
         for (size_t i = 0; i < dots; i++)
         {
             const float astart = start + PI_2_DIV(dots) * i;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(astart) * radius, centre.y + ryk * ImCos(astart) * radius + radius * delta), thickness,
+            discs.Add(ImVec2(centre.x + ImSin(astart) * radius, centre.y + ryk * ImCos(astart) * radius + radius * delta), thickness,
                                               color_alpha(color, ImMax(minfade, ImSin(astart + PI_DIV_2))),
                                               8);
         }
@@ -586,7 +577,7 @@ namespace ImSpinner
         for (size_t i = 0; i < dots; i++)
         {
             const float astart = start + PI_2_DIV(dots) * i;
-            window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(astart) * radius, centre.y - ryk * ImCos(astart) * radius - radius * delta), thickness,
+            discs.Add(ImVec2(centre.x + ImSin(astart) * radius, centre.y - ryk * ImCos(astart) * radius - radius * delta), thickness,
                                               color_alpha(color, ImMax(minfade, ImSin(astart + PI_DIV_2))),
                                               8);
         }
@@ -595,19 +586,21 @@ namespace ImSpinner
     inline void SpinnerThreeDotsStar(const char *label, float radius, float thickness, const ImColor &color = white, float minfade = 0.0f, float ryk = 0.f, float speed = 1.1f, float delta = 0.f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
 
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(-start) * radius, centre.y - ryk * ImCos(-start) * radius + radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(-start + PI_DIV_2))), 8);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(start) * radius, centre.y - ryk * ImCos(start) * radius - radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(start + PI_DIV_2))), 8);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ImSin(start + PI_DIV_4) * radius, centre.y - ryk * ImCos(start + PI_DIV_4) * radius - radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(start + PI_DIV_4 + PI_DIV_2))), 8);
+        discs.Add(ImVec2(centre.x + ImSin(-start) * radius, centre.y - ryk * ImCos(-start) * radius + radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(-start + PI_DIV_2))), 8);
+        discs.Add(ImVec2(centre.x + ImSin(start) * radius, centre.y - ryk * ImCos(start) * radius - radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(start + PI_DIV_2))), 8);
+        discs.Add(ImVec2(centre.x + ImSin(start + PI_DIV_4) * radius, centre.y - ryk * ImCos(start + PI_DIV_4) * radius - radius * delta), thickness, color_alpha(color, ImMax(minfade, ImSin(start + PI_DIV_4 + PI_DIV_2))), 8);
     }
 
     inline void SpinnerSwingDots(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.8f)
     {
         SPINNER_HEADER(pos, size, centre, num_segments);
+        detail::DiscBatch discs(window->DrawList);
 
-        const float start = (float)ImGui::GetTime() * speed;
+        const float start = detail::AnimTime(speed);
         constexpr int elipses = 2;
 
         auto get_rotated_ellipse_pos = [&] (float alpha, float start) {
@@ -629,7 +622,7 @@ namespace ImSpinner
             ImVec2 ppos = get_rotated_ellipse_pos((IM_PI * (float)i/ elipses) + PI_DIV_4, start + PI_DIV_2 * i);
             const float y_delta = ImAbs(centre.y - ppos.y);
             float th_koeff = ImMax((y_delta / size.y) * 4.f, 0.5f);
-            window->DrawList->AddCircleFilled(ppos, th_koeff * thickness, color_alpha(ImColor::HSV(out_h + i * 0.5f, out_s, out_v), 1.f), num_segments);
+            discs.Add(ppos, th_koeff * thickness, color_alpha(ImColor::HSV(out_h + i * 0.5f, out_s, out_v), 1.f), num_segments);
         }
     }
 
@@ -639,7 +632,7 @@ namespace ImSpinner
 
         const float nextItemKoeff = 2.5f;
         const float dots = (size.x / (thickness * nextItemKoeff));
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
 
         float out_h, out_s, out_v;
         ImGui::ColorConvertRGBtoHSV(color.Value.x, color.Value.y, color.Value.z, out_h, out_s, out_v);
@@ -669,7 +662,7 @@ namespace ImSpinner
 
         const float nextItemKoeff = 2.5f;
         const float dots = 2;// (size.x / (thickness * nextItemKoeff));
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
 
         auto draw_point = [&] (float angle, int i, float k) {
             float a = angle + k * start + k * (IM_PI - i * PI_DIV(dots));
@@ -698,15 +691,16 @@ namespace ImSpinner
     inline void SpinnerDotsTyping(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int dots = 3)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const int n = ImMax(1, dots);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int shown = ImMin(n, (int)(t * (n + 1)) + 1);    // 1..n (CSS steps(n+1))
       const float step = (radius * 2.f) / (float)n;
 
       for (int i = 0; i < shown; i++) {
         const ImVec2 c(centre.x - radius + (i + 0.5f) * step, centre.y);
-        window->DrawList->AddCircleFilled(c, thickness, color_alpha(color, 1.f), num_segments);
+        discs.Add(c, thickness, color_alpha(color, 1.f), num_segments);
       }
     }
 
@@ -716,13 +710,14 @@ namespace ImSpinner
     inline void SpinnerDotsStep(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f, int dots = 3)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const int n = ImMax(1, dots);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int k = ImMin(n - 1, (int)(t * n));              // current slot (CSS steps(n))
       const float step = (radius * 2.f) / (float)n;
       const ImVec2 c(centre.x - radius + (k + 0.5f) * step, centre.y);
-      window->DrawList->AddCircleFilled(c, thickness, color_alpha(color, 1.f), num_segments);
+      discs.Add(c, thickness, color_alpha(color, 1.f), num_segments);
     }
 
     // Gathering dots:
@@ -731,16 +726,17 @@ namespace ImSpinner
     inline void SpinnerDotsGather(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.5f, int dots = 3)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const int n = ImMax(1, dots);
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float ph = detail::AnimTime(speed, 1.f);
       const float tri = (ph < 0.5f) ? ph * 2.f : 2.f - ph * 2.f; // 0..1..0 (CSS alternate)
       const float s = 1.f - tri;                             // 1 = spread, 0 = gathered
       const float r = thickness * (1.f + 0.5f * tri);        // grow a bit when gathered
 
       for (int i = 0; i < n; i++) {
         const float off = (n > 1) ? ((float)i / (n - 1) - 0.5f) * 2.f * radius * s : 0.f;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + off, centre.y), r, color_alpha(color, 1.f), num_segments);
+        discs.Add(ImVec2(centre.x + off, centre.y), r, color_alpha(color, 1.f), num_segments);
       }
     }
 
@@ -751,8 +747,9 @@ namespace ImSpinner
     inline void SpinnerDotsShift(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.5f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float ph = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float ph = detail::AnimTime(speed, 1.f);
       const float u = (ph < 0.5f) ? ph * 2.f : 2.f - ph * 2.f; // 0..1..0 (CSS alternate)
       const float th = thickness;
       float lx, rx;                                          // left/right offsets, in dot-radii (CSS px / 7.5)
@@ -760,9 +757,9 @@ namespace ImSpinner
       else          { lx = -2.f * th; rx = (2.f + 1.33f * ((u - 0.5f) / 0.5f)) * th; }
 
       const ImColor c = color_alpha(color, 1.f);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + lx, centre.y), th, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x, centre.y), th, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + rx, centre.y), th, c, num_segments);
+      discs.Add(ImVec2(centre.x + lx, centre.y), th, c, num_segments);
+      discs.Add(ImVec2(centre.x, centre.y), th, c, num_segments);
+      discs.Add(ImVec2(centre.x + rx, centre.y), th, c, num_segments);
     }
 
     // Orbiting dots:
@@ -773,15 +770,16 @@ namespace ImSpinner
     inline void SpinnerDotsOrbit(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.66f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float th = thickness;
-      const float a = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float a = detail::AnimTime(speed, 1.f);
       const float p = (a < 0.5f) ? a * 2.f : 2.f - a * 2.f;  // 0..1..0
       const float flip = (a < 0.5f) ? 1.f : -1.f;            // scale(-1) every half-cycle (steps(2))
       const float theta = -IM_PI * p;
       const ImColor c = color_alpha(color, 1.f);
       auto dot = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + flip * x * th, centre.y + y * th), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + flip * x * th, centre.y + y * th), th, c, num_segments);
       };
       dot(-3.47f, 0.f);                                      // ::before main (fixed left)
       dot(3.47f * p, 0.f);                                   // ::before shadow (slides right)
@@ -794,14 +792,15 @@ namespace ImSpinner
     inline void SpinnerDotsCircle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.66f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float th = thickness;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float tx = (t < 0.5f) ? t * 2.f : 2.f - t * 2.f; // 0..1..0 (slide there and back)
       const float theta = -PI_2 * t;                         // full circle
       const ImColor c = color_alpha(color, 1.f);
       auto dot = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x * th, centre.y + y * th), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x * th, centre.y + y * th), th, c, num_segments);
       };
       dot(3.47f * tx, 0.f);                                  // ::before main (slides right and back)
       dot(3.47f * (tx - 1.f), 0.f);                          // ::before shadow (trails it)
@@ -815,6 +814,7 @@ namespace ImSpinner
     inline void SpinnerDotsSquare(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float th = thickness;
       const float r = ImMax(radius - thickness, thickness);
@@ -823,13 +823,13 @@ namespace ImSpinner
       const ImVec2 d2[5] = { BL, BL, TL, TL, TL };
       const ImVec2 d3[5] = { BR, BR, BR, BL, BL };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(3, (int)(t * 4.f));
       const float u = t * 4.f - seg;
       const ImColor c = color_alpha(color, 1.f);
       auto draw = [&](const ImVec2 *d) {
         const ImVec2 p(d[seg].x + (d[seg + 1].x - d[seg].x) * u, d[seg].y + (d[seg + 1].y - d[seg].y) * u);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
       };
       draw(d1);
       draw(d2);
@@ -843,6 +843,7 @@ namespace ImSpinner
     inline void SpinnerDotsShuffle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float th = thickness;
       const ImVec2 d1[4] = { ImVec2(-3.f, 0.f), ImVec2(-3.f, -1.f), ImVec2(0.f, -1.f), ImVec2(0.f, 0.f) };
@@ -850,14 +851,14 @@ namespace ImSpinner
       const ImVec2 d3[4] = { ImVec2(0.f, 0.f), ImVec2(0.f, 1.f), ImVec2(3.f, 1.f), ImVec2(3.f, 0.f) };
       const ImVec2 d4[4] = { ImVec2(3.f, 0.f), ImVec2(3.f, -1.f), ImVec2(0.f, -1.f), ImVec2(0.f, 0.f) };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(2, (int)(t * 3.f));
       const float u = t * 3.f - seg;
       const ImColor c = color_alpha(color, 1.f);
       auto draw = [&](const ImVec2 *d) {
         const float x = (d[seg].x + (d[seg + 1].x - d[seg].x) * u) * th;
         const float y = (d[seg].y + (d[seg + 1].y - d[seg].y) * u) * th;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       };
       draw(d1);
       draw(d2);
@@ -872,6 +873,7 @@ namespace ImSpinner
     inline void SpinnerDotsSplit(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       // upper / lower dot Y per column over 6 keyframes (0, 1/6 .. 5/6); -1=top, +1=bottom, ±0.25=closed.
       static const float U[3][6] = {
@@ -888,7 +890,7 @@ namespace ImSpinner
       const float th = thickness;
       const float colspan = radius * 0.7f;
       const float spread = radius * 0.6f;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(5, (int)(t * 6.f));
       const int nxt = (seg + 1) % 6;
       const float u = t * 6.f - seg;
@@ -898,8 +900,8 @@ namespace ImSpinner
         const float x = centre.x + (col - 1) * colspan;
         const float yu = (U[col][seg] + (U[col][nxt] - U[col][seg]) * u) * spread;
         const float yl = (L[col][seg] + (L[col][nxt] - L[col][seg]) * u) * spread;
-        window->DrawList->AddCircleFilled(ImVec2(x, centre.y + yu), th, c, num_segments);
-        window->DrawList->AddCircleFilled(ImVec2(x, centre.y + yl), th, c, num_segments);
+        discs.Add(ImVec2(x, centre.y + yu), th, c, num_segments);
+        discs.Add(ImVec2(x, centre.y + yl), th, c, num_segments);
       }
     }
 
@@ -910,6 +912,7 @@ namespace ImSpinner
     inline void SpinnerDotsLeader(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       static const float X[5][4] = {
         { -1.f, -1.f,  1.f,  1.f },                          // leader
@@ -922,7 +925,7 @@ namespace ImSpinner
         { -0.25f, -1.f, -1.f, -0.25f }, { 0.25f, 1.f, 1.f, 0.25f }
       };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       int seg, nxt; float u;
       if (t < 0.75f) { seg = (int)(t / 0.25f); u = (t - seg * 0.25f) / 0.25f; nxt = seg + 1; } // move
       else           { seg = 3; nxt = 3; u = 0.f; }                                            // hold, then jump-loop
@@ -932,7 +935,7 @@ namespace ImSpinner
       for (int d = 0; d < 5; d++) {
         const float x = (X[d][seg] + (X[d][nxt] - X[d][seg]) * u) * cs;
         const float y = (Y[d][seg] + (Y[d][nxt] - Y[d][seg]) * u) * sp;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       }
     }
 
@@ -944,11 +947,12 @@ namespace ImSpinner
     inline void SpinnerDotsRolling(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W = radius * 2.f;
       const float tw = W * 0.75f;
-      const float t0 = ImFmod((float)ImGui::GetTime() * speed, 1.f);
-      const float t1 = ImFmod((float)ImGui::GetTime() * speed * 2.f, 1.f);
+      const float t0 = detail::AnimTime(speed, 1.f);
+      const float t1 = detail::AnimTime(speed * 2.f, 1.f);
       const float flip = (t0 < 0.5f) ? 1.f : -1.f;
       const float rot = (t1 <= 0.8f) ? (t1 / 0.8f) * PI_2 : PI_2;
       const float tx = -0.375f * W;
@@ -978,16 +982,17 @@ namespace ImSpinner
       }
 
       for (int i = 0; i < ndots; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
     }
 
     inline void SpinnerDotsTriangle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float hy = radius / 1.154f;                              // aspect-ratio 1.154 (width / height)
       const ImVec2 TOP(0.f, -hy), BL(-radius, hy), BR(radius, hy);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float u = (t < 0.5f) ? t * 2.f : 1.f;                    // 0..1 over first half, then hold
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
@@ -996,7 +1001,7 @@ namespace ImSpinner
       };
       auto draw = [&](const ImVec2 &a, const ImVec2 &b) {
         const ImVec2 p = lerp(a, b, u);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
       };
       draw(TOP, BR);                                                 // dot 1: top -> bottom-right
       draw(BL, TOP);                                                 // dot 2: bottom-left -> top
@@ -1006,13 +1011,14 @@ namespace ImSpinner
     inline void SpinnerDotsCascade(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       struct KF { float t, x, y; };
       static const KF d1[] = { { 0.f, -1.f, -2.f }, { 0.1667f, -1.f, 0.f }, { 0.6667f, -1.f, 2.f }, { 1.f, -1.f, 2.f } };
       static const KF d2[] = { { 0.f,  0.f, -2.f }, { 0.3333f,  0.f, 0.f }, { 0.8333f,  0.f, 2.f }, { 1.f,  0.f, 2.f } };
       static const KF d3[] = { { 0.f,  1.f, -2.f }, { 0.45f,  1.f, 0.f }, { 0.8333f,  1.f, 0.f }, { 1.f,  1.f, 2.f } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
 
@@ -1028,19 +1034,20 @@ namespace ImSpinner
 
       const ImVec2 ps[] = { eval(d1, 4), eval(d2, 4), eval(d3, 4) };
       for (int i = 0; i < 3; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + ps[i].x, centre.y + ps[i].y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + ps[i].x, centre.y + ps[i].y), th, c, num_segments);
     }
 
     inline void SpinnerDotsSwap(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float d = (20.f / 7.5f) * thickness;
       struct KF { float t, x, y; };
       static const KF s1[] = { { 0.f, -1.f, 0.f }, { 0.25f, -1.f, -1.f }, { 0.5f, 0.f, -1.f }, { 0.75f, 1.f, -1.f }, { 1.f, 1.f, 0.f } };
       static const KF s2[] = { { 0.f,  1.f, 0.f }, { 0.25f,  1.f,  1.f }, { 0.5f, 0.f,  1.f }, { 0.75f, -1.f,  1.f }, { 1.f, -1.f, 0.f } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
 
@@ -1054,15 +1061,16 @@ namespace ImSpinner
                       (k[seg].y + (k[seg + 1].y - k[seg].y) * u) * d);
       };
 
-      window->DrawList->AddCircleFilled(centre, th, c, num_segments);
+      discs.Add(centre, th, c, num_segments);
       const ImVec2 p1 = eval(s1, 5), p2 = eval(s2, 5);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + p1.x, centre.y + p1.y), th, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + p2.x, centre.y + p2.y), th, c, num_segments);
+      discs.Add(ImVec2(centre.x + p1.x, centre.y + p1.y), th, c, num_segments);
+      discs.Add(ImVec2(centre.x + p2.x, centre.y + p2.y), th, c, num_segments);
     }
 
     inline void SpinnerDotsSpread(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float th = thickness;
       const float farr = 60.f / 7.5f, nearr = 19.f / 7.5f;
@@ -1071,7 +1079,7 @@ namespace ImSpinner
       static const KF s2[] = { { 0.f, -farr }, { 0.3333f, 0.f }, { 0.8333f, farr }, { 1.f, farr } };
       static const KF s3[] = { { 0.f, -farr }, { 0.1667f, nearr }, { 0.6667f, farr }, { 1.f, farr } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
 
       auto eval = [&](const KF *k, int n) {
@@ -1083,19 +1091,20 @@ namespace ImSpinner
         return (k[seg].x + (k[seg + 1].x - k[seg].x) * u) * th;
       };
 
-      window->DrawList->AddCircleFilled(centre, th, c, num_segments);
+      discs.Add(centre, th, c, num_segments);
       const float xs[] = { eval(s1, 3), eval(s2, 4), eval(s3, 4) };
       for (int i = 0; i < 3; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + xs[i], centre.y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + xs[i], centre.y), th, c, num_segments);
     }
 
     inline void SpinnerDotsTwin(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.5f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float pw = radius;                                       // half width (flex:1 each)
       const float tw = pw * 0.75f;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       float txf, rot;
       if (t <= 0.25f)      { txf = -0.25f * (t / 0.25f); rot = 0.f; }
       else if (t <= 0.5f)  { txf = -0.25f; rot = (t - 0.25f) / 0.25f * PI_2; }
@@ -1128,22 +1137,23 @@ namespace ImSpinner
       }
 
       for (int i = 0; i < ndots; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
     }
 
     inline void SpinnerDotsHop(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f / 1.5f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       struct KF { float t, x, y; };
       static const KF d1[] = { { 0.f, 0.f, -1.f }, { 0.31f, 0.f, -1.f }, { 0.33f, 0.f, 1.f }, { 0.43f, 0.f, -1.f }, { 1.f, 0.f, -1.f } };
       static const KF d2[] = { { 0.f, 1.f, -1.f }, { 0.64f, 1.f, -1.f }, { 0.66f, 1.f, 1.f }, { 0.79f, 1.f, -1.f }, { 1.f, 1.f, -1.f } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float hy = radius * 28.f / 50.f;                         // aspect 50×28
       const float gx = (t <= 0.79f) ? 0.f : -(t - 0.79f) / 0.21f * radius * 2.f / 3.f;
       const float xr = radius * (-0.76f + 2.28f * t);              // ::before left 0 → 100%+7px
-      const float tb = ImFmod((float)ImGui::GetTime() * speed * 3.f, 1.f);
+      const float tb = detail::AnimTime(speed * 3.f, 1.f);
       const float hop = ImSin(tb * IM_PI) * hy * 0.12f;              // l23-2 bounce (0.5s)
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
@@ -1159,7 +1169,7 @@ namespace ImSpinner
       };
 
       auto draw = [&](ImVec2 p) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
       };
 
       draw(eval(d1, 5));
@@ -1173,12 +1183,13 @@ namespace ImSpinner
     inline void SpinnerDotsJiggle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       struct KF { float t, x; };
       static const KF d1[] = { { 0.f, -0.5f }, { 0.24f, -0.5f }, { 0.89f, -0.5f }, { 0.90f, -0.7f }, { 1.f, -0.5f } };
       static const KF d2[] = { { 0.f,  0.5f }, { 0.40f,  0.7f }, { 0.50f,  0.5f }, { 1.f,  0.5f } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float ty = -radius * 6.f / 44.f;                         // aspect 88×12, top row
       const float end = radius * 0.1f / 44.f;                        // l24-1 translate(0.1px)
       const float shake = end * t + radius * 0.06f * ImSin(t * IM_PI * 10.f) * (1.f - t);
@@ -1195,7 +1206,7 @@ namespace ImSpinner
       };
 
       auto draw = [&](float x) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + ty), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + ty), th, c, num_segments);
       };
 
       draw(eval(d1, 5));
@@ -1210,12 +1221,13 @@ namespace ImSpinner
     inline void SpinnerDotsVibrate(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float ty = -radius * 6.f / 25.f;                         // aspect 50×12, top row
       const float lx = -radius * 19.f / 25.f;                          // left dot (12px at left edge)
       const float rx =  radius * 19.f / 25.f;
-      const float t  = ImFmod((float)ImGui::GetTime() * speed, 1.f);
-      const float tv = ImFmod((float)ImGui::GetTime() * speed * 2.f, 1.f);
+      const float t  = detail::AnimTime(speed, 1.f);
+      const float tv = detail::AnimTime(speed * 2.f, 1.f);
       const float end_x = radius * 0.12f / 25.f;
       const float end_y = -radius * 0.15f / 25.f;
       const float shake_x = end_x * t  + radius * 0.06f * ImSin(t  * IM_PI * 10.f) * (1.f - t);
@@ -1224,7 +1236,7 @@ namespace ImSpinner
       const float th = thickness;
 
       auto draw = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       };
 
       draw(lx, ty);
@@ -1238,10 +1250,11 @@ namespace ImSpinner
     inline void SpinnerDotsWiper(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float rc = radius * 0.25f;                               // circle r = height/2 (aspect 4)
       const float sx = radius * 0.75f;                               // background dots at left/right
-      const float phase = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float phase = detail::AnimTime(speed, 2.f);
       const float u = (phase < 1.f) ? phase : 2.f - phase;           // alternate ping-pong
       const float rot = (u <= 0.4f) ? 0.f : (u - 0.4f) / 0.6f * IM_PI * 0.5f;
       const float c = ImCos(rot), s = ImSin(rot);
@@ -1249,7 +1262,7 @@ namespace ImSpinner
       const float th = thickness;
 
       auto draw = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, col, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, col, num_segments);
       };
 
       draw(-sx, 0.f);
@@ -1264,6 +1277,7 @@ namespace ImSpinner
     inline void SpinnerDotsCollapse(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.5f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float u = thickness / 6.f;                               // CSS dot radius 6px
       struct KF { float t, v; };
@@ -1273,7 +1287,7 @@ namespace ImSpinner
       static const KF by[]     = { { 0.f, 40.f }, { 0.5f, 12.f }, { 0.6f, 0.f }, { 0.9f, 40.f }, { 1.f, 40.f } };
       static const KF ty[]     = { { 0.f, -40.f }, { 0.7f, -12.f }, { 0.8f, 0.f }, { 0.9f, -40.f }, { 1.f, -40.f } };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
 
@@ -1288,10 +1302,10 @@ namespace ImSpinner
 
       const float sp = eval(spread, 7);
       auto draw = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       };
 
-      window->DrawList->AddCircleFilled(centre, th + sp, c, num_segments); // 0 0 0 spread ring
+      discs.Add(centre, th + sp, c, num_segments); // 0 0 0 spread ring
       draw(eval(rx, 5), 0.f);
       draw(eval(lx, 5), 0.f);
       draw(0.f, eval(by, 5));
@@ -1304,19 +1318,20 @@ namespace ImSpinner
     inline void SpinnerDotsFlip(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float s   = thickness * 2.f;                             // --s dot size
       const float col = s * 0.665f;                                  // column x (space-between)
       const float sep = s * 1.33f;                                   // top↔bottom spacing
       const float py  = s * 0.665f;                                  // bottom pivot y
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const float gy  = t * (s - 2.33f * s);                         // l29-0 translateY(s − 100%)
       const float a   = IM_PI * t;
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
 
       auto draw = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       };
 
       auto column = [&](float cx, float sign) {
@@ -1335,18 +1350,19 @@ namespace ImSpinner
     inline void SpinnerDotsTurn(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float s   = thickness * 2.f;
       const float col = s * 0.665f;
       const float sep = s * 1.33f;
       const float py  = s * 0.665f;
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const float a   = (t <= 0.7f) ? 0.f : (t - 0.7f) / 0.3f * (-IM_PI * 1.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
 
       auto draw = [&](float x, float y) {
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y + y), th, c, num_segments);
       };
 
       draw(-col,  py);                                               // ::before pivot (bottom)
@@ -1361,10 +1377,11 @@ namespace ImSpinner
     inline void SpinnerDotsCarousel(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W = radius * 2.f;
       const float tx = 0.375f * W;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float th_rot = IM_PI * t;
       const float cs = ImCos(th_rot), sn = ImSin(th_rot);
       const float loader_tx = tx * t;
@@ -1397,7 +1414,7 @@ namespace ImSpinner
       try_add(p2.x + loader_tx, p2.y);
 
       for (int i = 0; i < ndots; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, col, num_segments);
+        discs.Add(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, col, num_segments);
     }
 
     // Half-turn dots, a port of the CSS dots/l32:
@@ -1406,8 +1423,9 @@ namespace ImSpinner
     inline void SpinnerDotsHalfTurn(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float a_fwd = (t <= 0.8f) ? 0.f : (t - 0.8f) / 0.2f * IM_PI;
       const float a_rev = (t <= 0.8f) ? IM_PI : IM_PI - (t - 0.8f) / 0.2f * IM_PI;
       const ImColor c = color_alpha(color, 1.f);
@@ -1420,7 +1438,7 @@ namespace ImSpinner
 
       auto draw_rot = [&](float x, float y, float cs, float sn) {
         const float rx = x * cs - y * sn, ry = x * sn + y * cs;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + rx, centre.y + ry), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + rx, centre.y + ry), th, c, num_segments);
       };
 
       for (int i = 0; i < 2; i++) {
@@ -1435,10 +1453,11 @@ namespace ImSpinner
     inline void SpinnerDotsSlideFlip(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W  = radius * 2.f;
       const float Wp = W * (140.f / 300.f);                          // width calc(140%/3)
-      const float t  = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t  = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th = thickness;
       const float ox_b = Wp * (3.f / 14.f);                          // ::before pivot (left dot)
@@ -1464,7 +1483,7 @@ namespace ImSpinner
       const float bases[4] = { base_b, base_b, base_a, base_a };
 
       for (int i = 0; i < 4; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + bases[i] + pts[i].x, centre.y + pts[i].y), th, c, num_segments);
     }
 
@@ -1474,10 +1493,11 @@ namespace ImSpinner
     inline void SpinnerDotsStaggerTurn(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W   = radius * 2.f;
       const float td  = 0.375f * W;                                  // ::after --d: 37.5%
-      const float t   = (float)ImGui::GetTime() * speed;
+      const float t   = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th  = thickness;
       const float lx[2] = { -0.75f * radius, 0.75f * radius };       // background-size 25%
@@ -1508,7 +1528,7 @@ namespace ImSpinner
       }
 
       for (int i = 0; i < ndots; i++)
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + dots[i].x, centre.y + dots[i].y), th, c, num_segments);
     }
 
     // Stretch dots:
@@ -1517,10 +1537,11 @@ namespace ImSpinner
     inline void SpinnerDotsStretch(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float Hc    = radius * 2.f / 5.f;                        // loader height (aspect-ratio 5)
       const float tyMax = (8.f / 15.f) * Hc;                         // translateY 8px
-      const float t     = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t     = detail::AnimTime(speed, 1.f);
       const ImColor c   = color_alpha(color, 1.f);
       const float th    = thickness;
 
@@ -1541,8 +1562,8 @@ namespace ImSpinner
 
       auto draw_layer = [&](float base_x, float sign) {
         const float y = sign * ty;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + base_x + half, centre.y + y), th, c, num_segments);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + base_x + pw - half, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + base_x + half, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + base_x + pw - half, centre.y + y), th, c, num_segments);
       };
 
       draw_layer(-radius,  1.f);                                     // ::before, --s: 1
@@ -1554,11 +1575,12 @@ namespace ImSpinner
     inline void SpinnerDotsMirrorStretch(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float Hc    = radius * 2.f / 5.f;
       const float tyMax = (8.f / 15.f) * Hc;
       const float txMax = (19.f / 15.f) * Hc;
-      const float time  = (float)ImGui::GetTime() * speed;
+      const float time  = detail::AnimTime(speed, 2.f);
       const float t     = ImFmod(time, 1.f);
       const float flipY = (ImFmod(time, 2.f) >= 1.f) ? -1.f : 1.f;
       const ImColor c   = color_alpha(color, 1.f);
@@ -1585,8 +1607,8 @@ namespace ImSpinner
       auto draw_layer = [&](float base_x, float sign) {
         const float dx = sign * tx;
         const float y  = flipY * sign * ty;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + base_x + half + dx, centre.y + y), th, c, num_segments);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + base_x + pw - half + dx, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + base_x + half + dx, centre.y + y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + base_x + pw - half + dx, centre.y + y), th, c, num_segments);
       };
 
       draw_layer(-radius,       1.f);
@@ -1599,8 +1621,9 @@ namespace ImSpinner
     inline void SpinnerDotsPinch(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 3.f);
       const float u    = thickness / 3.f;                            // CSS centre radius 3 px (6 px wide)
       const ImColor c  = color_alpha(color, 1.f);
 
@@ -1623,13 +1646,13 @@ namespace ImSpinner
       const float ar[4] = { thickness * 2.f, thickness * 2.f, thickness * 2.f, thickness * 2.f };
       const float br[4] = { thickness * 3.f, thickness * 2.f, thickness * 2.f, thickness * 3.f };
 
-      window->DrawList->AddCircleFilled(centre, thickness, c, num_segments);
+      discs.Add(centre, thickness, c, num_segments);
 
       for (int i = 0; i < 4; i++) {
         const float x = ax[i] + (bx[i] - ax[i]) * pinch;
         const float r = ar[i] + (br[i] - ar[i]) * pinch;
         const float rx = x * cs, ry = x * sn;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + rx, centre.y + ry), r, c, num_segments);
+        discs.Add(ImVec2(centre.x + rx, centre.y + ry), r, c, num_segments);
       }
     }
 
@@ -1639,8 +1662,9 @@ namespace ImSpinner
     inline void SpinnerDotsCorners(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 2.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float t  = ImFmod((float)ImGui::GetTime() * speed, 1.f); // speed 2 → 0.5 s cycle
+      const float t  = detail::AnimTime(speed, 1.f); // speed 2 → 0.5 s cycle
       const float c  = radius * 0.6f;                                // dot inset (40% tile / 2)
       const ImColor col = color_alpha(color, 1.f);
       const ImVec2 p0(-c, -c), p1(c, -c), p2(c, c), p3(-c, c);
@@ -1649,7 +1673,7 @@ namespace ImSpinner
 
       for (int i = 0; i < 4; i++) {
         const ImVec2 p(a[i].x + (b[i].x - a[i].x) * t, a[i].y + (b[i].y - a[i].y) * t);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + p.x, centre.y + p.y), thickness, col, num_segments);
+        discs.Add(ImVec2(centre.x + p.x, centre.y + p.y), thickness, col, num_segments);
       }
     }
 
@@ -1659,10 +1683,11 @@ namespace ImSpinner
     inline void SpinnerDotsNudgeRotate(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W   = radius * 2.f;
       const float Wp  = W * (140.f / 300.f);
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float th  = thickness;
       const float dot_l = Wp * (3.f / 14.f);
@@ -1690,7 +1715,7 @@ namespace ImSpinner
       };
 
       for (int i = 0; i < 4; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + xs[i] * cs, centre.y + xs[i] * sn), th, c, num_segments);
     }
 
@@ -1700,8 +1725,9 @@ namespace ImSpinner
     inline void SpinnerDotsUnfold(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 3.f);
       const ImColor c  = color_alpha(color, 1.f);
 
       const float p1 = ImFmod(time / 0.75f, 2.f);
@@ -1736,7 +1762,7 @@ namespace ImSpinner
         const int   i1 = ImMin(i0 + 1, 3);
         const float f  = s - (float)i0;
         const float x  = flip * radius * (slot_x[i0] + (slot_x[i1] - slot_x[i0]) * f);
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + x, centre.y), thickness, c, num_segments);
+        discs.Add(ImVec2(centre.x + x, centre.y), thickness, c, num_segments);
       }
     }
 
@@ -1746,11 +1772,12 @@ namespace ImSpinner
     inline void SpinnerDotsShuttle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W   = radius * 2.f;
       const float Hc  = W / 5.f;
       const float r   = Hc * 0.5f;
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float bx_l = -radius + r;
       const float bx_r =  radius - r;
@@ -1774,11 +1801,11 @@ namespace ImSpinner
       };
 
       for (int i = 0; i < 2; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + mid_x[i], centre.y), thickness, c, num_segments);
 
       for (int i = 0; i < 2; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + movers[i].x, centre.y + movers[i].y), thickness, c, num_segments);
     }
 
@@ -1788,11 +1815,12 @@ namespace ImSpinner
     inline void SpinnerDotsSpreadShuttle(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float W   = radius * 2.f;
       const float Hc  = W / 5.f;
       const float r   = Hc * 0.5f;
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float bx_l = -radius + r;
       const float bx_r =  radius - r;
@@ -1824,11 +1852,11 @@ namespace ImSpinner
       };
 
       for (int i = 0; i < 2; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + mid_x[i], centre.y), thickness, c, num_segments);
 
       for (int i = 0; i < 2; i++)
-        window->DrawList->AddCircleFilled(
+        discs.Add(
           ImVec2(centre.x + movers[i].x, centre.y + movers[i].y), thickness, c, num_segments);
     }
 
@@ -1838,6 +1866,7 @@ namespace ImSpinner
     inline void SpinnerDotsTriad(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       struct KF { float t, x, y; };
       static const KF lm[] = { { 0.f, -1.f, 0.f }, { 0.33f, -1.f, 0.f }, { 0.66f, -1.f / 3.f, 0.f }, { 1.f, -1.f / 3.f, 0.f } };
@@ -1847,7 +1876,7 @@ namespace ImSpinner
       static const KF rt[] = { { 0.f, 1.f / 3.f, 0.1f }, { 0.33f, 1.f / 3.f, 0.4f }, { 0.66f, 1.f, 0.4f }, { 1.f, 1.f, 0.1f } };
       static const KF rb[] = { { 0.f, 1.f / 3.f, -0.1f }, { 0.33f, 1.f / 3.f, -0.4f }, { 0.66f, 1.f, -0.4f }, { 1.f, 1.f, -0.1f } };
 
-      const float t  = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t  = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
 
       auto eval = [&](const KF *k, int n) {
@@ -1865,7 +1894,7 @@ namespace ImSpinner
       for (int i = 0; i < 6; i++) {
         const ImVec2 p = eval(tracks[i], 4);
         const float th = (i == 0 || i == 3) ? th_mid : thickness;
-        window->DrawList->AddCircleFilled(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
+        discs.Add(ImVec2(centre.x + p.x, centre.y + p.y), th, c, num_segments);
       }
     }
 
@@ -1875,9 +1904,10 @@ namespace ImSpinner
     inline void SpinnerDotsSatellite(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 1.f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       const float orbit = 0.75f * radius;                            // 25% tile, pivot at ±75%
-      const float time  = (float)ImGui::GetTime() * speed;
+      const float time  = detail::AnimTime(speed, 1.f);
       const ImColor c   = color_alpha(color, 1.f);
 
       auto spin = [](float phase) {
@@ -1898,10 +1928,10 @@ namespace ImSpinner
       const ImVec2 sat_l(pivot_l.x + r_l.x, pivot_l.y + r_l.y);
       const ImVec2 sat_r(pivot_r.x + r_a.x, pivot_r.y + r_a.y);
 
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + pivot_l.x, centre.y), thickness, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + pivot_r.x, centre.y), thickness, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + sat_l.x, centre.y + sat_l.y), thickness, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + sat_r.x, centre.y + sat_r.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + pivot_l.x, centre.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + pivot_r.x, centre.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + sat_l.x, centre.y + sat_l.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + sat_r.x, centre.y + sat_r.y), thickness, c, num_segments);
     }
 
     // Track dots:
@@ -1910,6 +1940,7 @@ namespace ImSpinner
     inline void SpinnerDotsTrack(const char *label, float radius, float thickness, const ImColor &color = white, float speed = 0.5f)
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
+      detail::DiscBatch discs(window->DrawList);
 
       struct KF { float t; float tx; float deg; };
       static const KF k[] = {
@@ -1923,7 +1954,7 @@ namespace ImSpinner
       };
 
       const float W   = radius * 2.f;
-      const float t   = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t   = detail::AnimTime(speed, 1.f);
       const ImColor c = color_alpha(color, 1.f);
       const float edge = 0.75f * radius;
 
@@ -1941,12 +1972,12 @@ namespace ImSpinner
         return ImVec2(lx * cs + tdx, lx * sn);
       };
 
-      window->DrawList->AddCircleFilled(ImVec2(centre.x - edge, centre.y), thickness, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + edge, centre.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x - edge, centre.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + edge, centre.y), thickness, c, num_segments);
 
       const ImVec2 p0 = xform(-edge), p1 = xform(edge);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + p0.x, centre.y + p0.y), thickness, c, num_segments);
-      window->DrawList->AddCircleFilled(ImVec2(centre.x + p1.x, centre.y + p1.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + p0.x, centre.y + p0.y), thickness, c, num_segments);
+      discs.Add(ImVec2(centre.x + p1.x, centre.y + p1.y), thickness, c, num_segments);
     }
 }
 
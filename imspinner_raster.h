@@ -0,0 +1,351 @@
+#ifndef _IMSPINNER_RASTER_H_
+#define _IMSPINNER_RASTER_H_
+
+/*
+ * imspinner raster add-on
+ *
+ * Software rasterizer for the ImDrawList / ImDrawData the spinners produce, so they
+ * can be rendered into RGBA buffers without a GPU backend (status pages, CI
+ * screenshots, thumbnails). Include this header (it pulls in "imspinner.h").
+ *
+ * Triangles are rasterized with edge functions and binned into tiles. The inside test runs
+ * four pixels at a time with SSE2 when the compiler targets it; shading and blending are
+ * scalar. Tiles are shaded on the calling thread unless more threads are asked for.
+ * Every draw command samples the one texture passed in - normally the font atlas,
+ * which holds the white pixel and the glyphs all spinners draw with. Sampling is
+ * nearest-texel and blending matches the stock backends (straight alpha "over"), so
+ * over a transparent image the colour comes out premultiplied by alpha, as in a
+ * framebuffer; UnpremultiplyAlpha() turns that into a straight-alpha texture or PNG.
+ */
+
+#include <atomic>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMSPINNER_RASTER_SSE2
+#endif
+
+#include "imspinner.h"
+
+namespace ImSpinner
+{
+    namespace detail {
+      struct RasterVtx { float x, y, u, v, r, g, b, a; };
+
+      struct RasterTri {
+        RasterVtx v[3];
+        float inv_area;
+        float ea[3], eb[3], ec[3];   // edge k (opposite vertex k): w = ea * x + eb * y + ec
+        bool tl[3];                  // top-left edges own the pixels exactly on them
+        int x0, y0, x1, y1;          // pixel bounds, clip rect applied, x1/y1 exclusive
+      };
+
+      // Per-rasterization buffers: the set-up triangles and the tile bins, as the triangle indices of every tile
+      // stored back to back (tile n owns bin_tris[bin_start[n], bin_start[n + 1])). Kept with the image and
+      // reused, so drawing into the same image every frame does not allocate once they have grown.
+      struct RasterScratch {
+        std::vector<RasterTri> tris;
+        std::vector<int> bin_start, bin_tris;
+      };
+    }
+
+    // RGBA8 image the rasterizer draws into; pixels use the IM_COL32 byte order.
+    struct RasterImage {
+      int width = 0, height = 0;
+      std::vector<ImU32> pixels;
+      detail::RasterScratch scratch;
+
+      void Resize(int w, int h) { width = w; height = h; pixels.assign((size_t)w * h, 0); }
+      void Clear(ImU32 col = 0) { std::fill(pixels.begin(), pixels.end(), col); }
+    };
+
+    // Texture sampled by every draw command: 4 bytes per texel (RGBA32) or 1 (alpha only, read as white).
+    struct RasterTexture {
+      const unsigned char *pixels = nullptr;
+      int width = 0, height = 0, bytes_per_pixel = 4;
+    };
+
+    inline RasterTexture GetFontRasterTexture(ImFontAtlas *atlas = nullptr)
+    {
+      if (!atlas)
+        atlas = ImGui::GetIO().Fonts;
+
+      RasterTexture tex;
+#if IMGUI_VERSION_NUM < 19197
+      unsigned char *pixels = nullptr;
+      atlas->GetTexDataAsRGBA32(&pixels, &tex.width, &tex.height);
+      tex.pixels = pixels;
+      tex.bytes_per_pixel = 4;
+#else
+      tex.pixels = atlas->TexData->Pixels;
+      tex.width = atlas->TexData->Width;
+      tex.height = atlas->TexData->Height;
+      tex.bytes_per_pixel = atlas->TexData->BytesPerPixel;
+#endif
+      return tex;
+    }
+
+    namespace detail {
+      inline bool SetupRasterTri(RasterTri &t, const ImDrawVert &a, const ImDrawVert &b, const ImDrawVert &c,
+                                 const ImVec2 &origin, const ImVec2 &scale, int cx0, int cy0, int cx1, int cy1)
+      {
+        const ImDrawVert *src[3] = { &a, &b, &c };
+        for (int k = 0; k < 3; k++) {
+          const ImDrawVert &s = *src[k];
+          t.v[k] = { (s.pos.x - origin.x) * scale.x, (s.pos.y - origin.y) * scale.y, s.uv.x, s.uv.y,
+                     (float)((s.col >> IM_COL32_R_SHIFT) & 0xFF), (float)((s.col >> IM_COL32_G_SHIFT) & 0xFF),
+                     (float)((s.col >> IM_COL32_B_SHIFT) & 0xFF), (float)((s.col >> IM_COL32_A_SHIFT) & 0xFF) };
+        }
+
+        auto area_of = [] (const RasterVtx &p0, const RasterVtx &p1, const RasterVtx &p2) {
+          return (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x);
+        };
+        float area = area_of(t.v[0], t.v[1], t.v[2]);
+        if (area == 0.f || (t.v[0].a == 0.f && t.v[1].a == 0.f && t.v[2].a == 0.f))
+          return false;
+        if (area < 0.f) { ImSwap(t.v[1], t.v[2]); area = -area; }
+        t.inv_area = 1.f / area;
+
+        for (int k = 0; k < 3; k++) {
+          const RasterVtx &p0 = t.v[(k + 1) % 3], &p1 = t.v[(k + 2) % 3];
+          const float dx = p1.x - p0.x, dy = p1.y - p0.y;
+          t.ea[k] = -dy;
+          t.eb[k] = dx;
+          t.ec[k] = dy * p0.x - dx * p0.y;
+          t.tl[k] = (dy == 0.f && dx > 0.f) || dy < 0.f;
+        }
+
+        const float minx = ImMin(t.v[0].x, ImMin(t.v[1].x, t.v[2].x)), maxx = ImMax(t.v[0].x, ImMax(t.v[1].x, t.v[2].x));
+        const float miny = ImMin(t.v[0].y, ImMin(t.v[1].y, t.v[2].y)), maxy = ImMax(t.v[0].y, ImMax(t.v[1].y, t.v[2].y));
+        t.x0 = ImMax(cx0, (int)ImFloor(minx));
+        t.y0 = ImMax(cy0, (int)ImFloor(miny));
+        t.x1 = ImMin(cx1, (int)std::ceil(maxx));
+        t.y1 = ImMin(cy1, (int)std::ceil(maxy));
+        return t.x0 < t.x1 && t.y0 < t.y1;
+      }
+
+      inline void RasterShade(ImU32 *dst, const RasterTri &t, float w0, float w1, float w2, const RasterTexture &tex)
+      {
+        w0 *= t.inv_area; w1 *= t.inv_area; w2 *= t.inv_area;
+        const RasterVtx &a = t.v[0], &b = t.v[1], &c = t.v[2];
+        float sr = a.r * w0 + b.r * w1 + c.r * w2;
+        float sg = a.g * w0 + b.g * w1 + c.g * w2;
+        float sb = a.b * w0 + b.b * w1 + c.b * w2;
+        float sa = a.a * w0 + b.a * w1 + c.a * w2;
+
+        if (tex.pixels) {
+          const float u = a.u * w0 + b.u * w1 + c.u * w2;
+          const float v = a.v * w0 + b.v * w1 + c.v * w2;
+          const int tx = ImClamp((int)(u * tex.width), 0, tex.width - 1);
+          const int ty = ImClamp((int)(v * tex.height), 0, tex.height - 1);
+          const unsigned char *texel = tex.pixels + ((size_t)ty * tex.width + tx) * tex.bytes_per_pixel;
+          if (tex.bytes_per_pixel == 4) {
+            sr *= texel[0] / 255.f; sg *= texel[1] / 255.f; sb *= texel[2] / 255.f; sa *= texel[3] / 255.f;
+          } else {
+            sa *= texel[0] / 255.f;
+          }
+        }
+        if (sa <= 0.f)
+          return;
+
+        const float k = sa / 255.f, ik = 1.f - k;
+        const ImU32 d = *dst;
+        const float dr = (float)((d >> IM_COL32_R_SHIFT) & 0xFF), dg = (float)((d >> IM_COL32_G_SHIFT) & 0xFF);
+        const float db = (float)((d >> IM_COL32_B_SHIFT) & 0xFF), da = (float)((d >> IM_COL32_A_SHIFT) & 0xFF);
+        const ImU32 r = (ImU32)ImClamp(sr * k + dr * ik + 0.5f, 0.f, 255.f);
+        const ImU32 g = (ImU32)ImClamp(sg * k + dg * ik + 0.5f, 0.f, 255.f);
+        const ImU32 bl = (ImU32)ImClamp(sb * k + db * ik + 0.5f, 0.f, 255.f);
+        const ImU32 al = (ImU32)ImClamp(sa + da * ik + 0.5f, 0.f, 255.f);
+        *dst = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (bl << IM_COL32_B_SHIFT) | (al << IM_COL32_A_SHIFT);
+      }
+
+      // Rasterizes the part of t inside [rx0, rx1) x [ry0, ry1), sampling at pixel centres.
+      inline void RasterTriangle(RasterImage &image, const RasterTri &t, int rx0, int ry0, int rx1, int ry1, const RasterTexture &tex)
+      {
+        const int x0 = ImMax(t.x0, rx0), x1 = ImMin(t.x1, rx1);
+        const int y0 = ImMax(t.y0, ry0), y1 = ImMin(t.y1, ry1);
+        if (x0 >= x1 || y0 >= y1)
+          return;
+
+#ifdef IMSPINNER_RASTER_SSE2
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 lanes = _mm_set_ps(3.f, 2.f, 1.f, 0.f);
+        __m128 ea[3], tl[3];
+        for (int k = 0; k < 3; k++) {
+          ea[k] = _mm_set1_ps(t.ea[k]);
+          tl[k] = _mm_castsi128_ps(_mm_set1_epi32(t.tl[k] ? -1 : 0));
+        }
+#endif
+        for (int y = y0; y < y1; y++) {
+          const float py = y + 0.5f, px = x0 + 0.5f;
+          float row[3];
+          for (int k = 0; k < 3; k++)
+            row[k] = t.ea[k] * px + t.eb[k] * py + t.ec[k];
+
+          ImU32 *line = image.pixels.data() + (size_t)y * image.width;
+          int x = x0;
+#ifdef IMSPINNER_RASTER_SSE2
+          for (; x < x1; x += 4) {
+            const float dx = (float)(x - x0);
+            __m128 w[3], inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int k = 0; k < 3; k++) {
+              w[k] = _mm_add_ps(_mm_set1_ps(row[k] + t.ea[k] * dx), _mm_mul_ps(ea[k], lanes));
+              const __m128 on_edge = _mm_and_ps(_mm_cmpeq_ps(w[k], zero), tl[k]);
+              inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(w[k], zero), on_edge));
+            }
+            int mask = _mm_movemask_ps(inside);
+            if (!mask)
+              continue;
+
+            alignas(16) float w0[4], w1[4], w2[4];
+            _mm_store_ps(w0, w[0]); _mm_store_ps(w1, w[1]); _mm_store_ps(w2, w[2]);
+            for (int lane = 0; lane < 4 && x + lane < x1; lane++)
+              if (mask & (1 << lane))
+                RasterShade(line + x + lane, t, w0[lane], w1[lane], w2[lane], tex);
+          }
+#else
+          for (; x < x1; x++) {
+            const float dx = (float)(x - x0);
+            float w[3];
+            bool inside = true;
+            for (int k = 0; k < 3 && inside; k++) {
+              w[k] = row[k] + t.ea[k] * dx;
+              inside = w[k] > 0.f || (w[k] == 0.f && t.tl[k]);
+            }
+            if (inside)
+              RasterShade(line + x, t, w[0], w[1], w[2], tex);
+          }
+#endif
+        }
+      }
+
+      inline void RasterAppendDrawList(std::vector<RasterTri> &tris, const ImDrawList *draw_list, const ImVec2 &origin, const ImVec2 &scale, int width, int height)
+      {
+        for (const ImDrawCmd &cmd : draw_list->CmdBuffer) {
+          if (cmd.UserCallback != nullptr || cmd.ElemCount == 0)
+            continue;
+
+          // Same scissor the stock backends derive from ClipRect.
+          const int cx0 = ImMax(0, (int)((cmd.ClipRect.x - origin.x) * scale.x));
+          const int cy0 = ImMax(0, (int)((cmd.ClipRect.y - origin.y) * scale.y));
+          const int cx1 = ImMin(width, (int)((cmd.ClipRect.z - origin.x) * scale.x));
+          const int cy1 = ImMin(height, (int)((cmd.ClipRect.w - origin.y) * scale.y));
+          if (cx0 >= cx1 || cy0 >= cy1)
+            continue;
+
+          const ImDrawVert *vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+          const ImDrawIdx *idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+          for (unsigned int i = 0; i + 2 < cmd.ElemCount; i += 3) {
+            RasterTri t;
+            if (SetupRasterTri(t, vtx[idx[i]], vtx[idx[i + 1]], vtx[idx[i + 2]], origin, scale, cx0, cy0, cx1, cy1))
+              tris.push_back(t);
+          }
+        }
+      }
+
+      // Bins image.scratch.tris into square tiles and shades the tiles on up to 'threads' threads (0 = one per core).
+      // Each extra thread needs min_tiles_per_thread tiles of work, so spinner sized images stay on the
+      // calling thread. Triangles keep their submission order inside every tile, so blending matches a serial draw.
+      inline void RasterTris(RasterImage &image, const RasterTexture &tex, int threads)
+      {
+        constexpr int tile = 64, min_tiles_per_thread = 8;
+        const int tiles_x = (image.width + tile - 1) / tile, tiles_y = (image.height + tile - 1) / tile;
+        const int tiles = tiles_x * tiles_y;
+        const std::vector<RasterTri> &tris = image.scratch.tris;
+        if (tris.empty() || tiles == 0)
+          return;
+
+        // Counting sort into the bins: count per tile, prefix sums, then fill in submission order.
+        std::vector<int> &bin_start = image.scratch.bin_start, &bin_tris = image.scratch.bin_tris;
+        bin_start.assign(tiles + 1, 0);
+        for (const RasterTri &t : tris)
+          for (int ty = t.y0 / tile; ty <= (t.y1 - 1) / tile; ty++)
+            for (int tx = t.x0 / tile; tx <= (t.x1 - 1) / tile; tx++)
+              bin_start[ty * tiles_x + tx + 1]++;
+        for (int n = 0; n < tiles; n++)
+          bin_start[n + 1] += bin_start[n];
+        bin_tris.resize(bin_start[tiles]);
+        for (int i = 0; i < (int)tris.size(); i++) {
+          const RasterTri &t = tris[i];
+          for (int ty = t.y0 / tile; ty <= (t.y1 - 1) / tile; ty++)
+            for (int tx = t.x0 / tile; tx <= (t.x1 - 1) / tile; tx++)
+              bin_tris[bin_start[ty * tiles_x + tx]++] = i;
+        }
+        for (int n = tiles; n > 0; n--)  // the fill advanced every start to the next bin's start
+          bin_start[n] = bin_start[n - 1];
+        bin_start[0] = 0;
+
+        std::atomic<int> next{0};
+        auto worker = [&] {
+          for (int n = next++; n < tiles; n = next++) {
+            const int rx0 = (n % tiles_x) * tile, ry0 = (n / tiles_x) * tile;
+            for (int b = bin_start[n]; b < bin_start[n + 1]; b++)
+              RasterTriangle(image, tris[bin_tris[b]], rx0, ry0, rx0 + tile, ry0 + tile, tex);
+          }
+        };
+
+        if (threads <= 0)
+          threads = (int)std::thread::hardware_concurrency();
+        threads = ImClamp(threads, 1, ImMax(1, tiles / min_tiles_per_thread));
+
+        if (threads == 1) {
+          worker();
+          return;
+        }
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (int i = 1; i < threads; i++)
+          pool.emplace_back(worker);
+        worker();
+        for (std::thread &th : pool)
+          th.join();
+      }
+    }
+
+    // Draws draw_list into image. Vertices are mapped to pixels as (pos - origin) * scale, the same transform
+    // a backend applies with DisplayPos / FramebufferScale.
+    inline void RasterizeDrawList(RasterImage &image, const ImDrawList *draw_list, const RasterTexture &tex,
+                                  const ImVec2 &origin = ImVec2(0, 0), const ImVec2 &scale = ImVec2(1, 1), int threads = 1)
+    {
+      image.scratch.tris.clear();
+      detail::RasterAppendDrawList(image.scratch.tris, draw_list, origin, scale, image.width, image.height);
+      detail::RasterTris(image, tex, threads);
+    }
+
+    // Converts an image drawn over a transparent background (premultiplied colour next to straight alpha) to
+    // straight alpha, for textures drawn with the stock blending (e.g. AddImage) or written to an image file.
+    inline void UnpremultiplyAlpha(RasterImage &image)
+    {
+      for (ImU32 &p : image.pixels) {
+        const ImU32 a = (p >> IM_COL32_A_SHIFT) & 0xFF;
+        if (a == 255)
+          continue;
+        if (a == 0) {
+          p = 0;
+          continue;
+        }
+        auto straight = [&] (int shift) { return ImMin(255u, (((p >> shift) & 0xFF) * 255 + a / 2) / a) << shift; };
+        p = straight(IM_COL32_R_SHIFT) | straight(IM_COL32_G_SHIFT) | straight(IM_COL32_B_SHIFT) | (a << IM_COL32_A_SHIFT);
+      }
+    }
+
+    // Draws a whole frame (ImGui::GetDrawData() after ImGui::Render()) into image, resizing it to the framebuffer.
+    // Pass threads = 0 (one per core) or a count to shade large frames in parallel.
+    inline void RasterizeDrawData(RasterImage &image, const ImDrawData *draw_data, const RasterTexture &tex, int threads = 1)
+    {
+      const int width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+      const int height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+      if (image.width != width || image.height != height)
+        image.Resize(width, height);
+
+      image.scratch.tris.clear();
+      for (int n = 0; n < draw_data->CmdListsCount; n++)
+        detail::RasterAppendDrawList(image.scratch.tris, draw_data->CmdLists[n], draw_data->DisplayPos, draw_data->FramebufferScale, width, height);
+      detail::RasterTris(image, tex, threads);
+    }
+
+}
+
+#endif // _IMSPINNER_RASTER_H_
@@ -30,7 +30,7 @@ namespace ImSpinner
       // strong ease-out within each keyframe segment (approx cubic-bezier(.3,1,0,1))
       auto ease = [](float u) { const float k = 1.f - u; return 1.f - k * k * k; };
 
-      const float time = (float)ImGui::GetTime() * speed;
+      const float time = detail::AnimTime(speed, 2.f);
       float p = ImFmod(time, 2.f) / 2.f;        // 0..1 over the 2 sec cycle
       if (mode == 2) p = 1.f - p;
 
@@ -106,7 +106,7 @@ namespace ImSpinner
 
       auto ease = [](float u) { const float k = 1.f - u; return 1.f - k * k * k; };
 
-      float p = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over the 2 sec cycle
+      float p = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over the 2 sec cycle
       if (mode == 2) p = 1.f - p;
       int seg = (int)(p * 4.f);
       if (seg > 3) seg = 3;
@@ -145,7 +145,7 @@ namespace ImSpinner
         return V[4];
       };
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       const float W = pwl(Wv, t), H = pwl(Hv, t), w2 = W * 0.5f;
@@ -190,7 +190,7 @@ namespace ImSpinner
 
       auto ease = [](float u) { const float kk = 1.f - u; return 1.f - kk * kk * kk; };  // ~cubic-bezier(.3,1,0,1)
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       float Sz, rot;                            // box side (px) and rotation (rad)
@@ -234,7 +234,7 @@ namespace ImSpinner
       auto ease = [](float u) { const float kk = 1.f - u; return 1.f - kk * kk * kk; };  // ~cubic-bezier(.3,1,0,1)
       const float th = 1.f / 3.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       float Sz, rf;                             // box side (px) and corner-rotation factor
@@ -268,7 +268,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(81, 75, 130), 1.f);  // #514b82
       const float box = radius;                  // vertical travel reaches +/- radius, so fit to that
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       auto cmf = [](float tt) { return ImClamp((tt - 1.f / 3.f) / (1.f / 3.f), 0.f, 1.f); };  // clip morph A->B
@@ -324,7 +324,7 @@ namespace ImSpinner
       auto ease = [](float u) { const float kk = 1.f - u; return 1.f - kk * kk * kk; };  // ~cubic-bezier(.3,1,0,1)
       const float th = 1.f / 3.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       float Sz, rot;                            // ::before box side (px) and rotation (rad)
@@ -371,7 +371,7 @@ namespace ImSpinner
         return V[n - 1];
       };
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       const float vx = pwl(vK, vX, 4, t), vy = pwl(vK, vY, 4, t);
@@ -415,7 +415,7 @@ namespace ImSpinner
         return V[n - 1];
       };
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       const float ty = pwl(tyK, tyV, 6, t) * 20.f;
@@ -467,7 +467,7 @@ namespace ImSpinner
         return V[n - 1];
       };
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       const float rp = pwl(rK, rV, 5, t);
@@ -516,7 +516,7 @@ namespace ImSpinner
         return V[n - 1];
       };
 
-      float tt = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;
+      float tt = detail::AnimTime(speed, 2.f) / 2.f;
       if (mode == 2) tt = 1.f - tt;
 
       const float angB = pwl(aK, aV, 6, tt) * (IM_PI / 180.f);
@@ -554,7 +554,7 @@ namespace ImSpinner
       window->DrawList->AddTriangleFilled(S(20, 20), S(0, 0), S(40, 0), c);
       window->DrawList->AddTriangleFilled(S(20, 20), S(40, 40), S(0, 40), c);
 
-      float phase = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      float phase = detail::AnimTime(speed, 2.f);
       if (mode == 2) phase = 2.f - phase;
       const float sx = (phase < 1.f) ? 1.f : -1.f;        // container scaleX flips at 1 sec
       const float f = (phase < 1.f) ? phase : (2.f - phase);   // 1 sec alternate -> triangle wave
@@ -606,7 +606,7 @@ namespace ImSpinner
         return V[n - 1];
       };
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;
+      float t = detail::AnimTime(speed, 2.f) / 2.f;
       if (mode == 2) t = 1.f - t;
 
       const float tx = pwl(tK, txV, 6, t), ty = pwl(tK, tyV, 6, t);
@@ -636,7 +636,7 @@ namespace ImSpinner
       const float k = r / 20.f;                  // CSS box is 40px -> half = 20px
 
       // outer: stepped 90deg rotation, held 1s each over a 4s cycle
-      float phase = ImFmod((float)ImGui::GetTime() * speed, 4.f);
+      float phase = detail::AnimTime(speed, 4.f);
       if (mode == 2) phase = 4.f - phase;
       const int step = (int)phase;               // 0..3
       const float base = (float)step * (IM_PI * 0.5f);
@@ -646,7 +646,7 @@ namespace ImSpinner
       };
 
       // ::before: 0.5s alternate diagonal bounce translate(0,0) <-> (-10,-10)
-      const float bt = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float bt = detail::AnimTime(speed, 1.f);
       const float tri = (bt < 0.5f) ? bt * 2.f : (1.f - bt) * 2.f;   // 0..1..0
       const float off = -10.f * tri * k;
 
@@ -685,7 +685,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(255, 165, 0), 1.f);   // orange
       const float k = radius / 50.f;            // fit the vertical tumble excursion
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       // parent l15-0: translateY (% of 40px height) + scaleY flip about y=50 (125%)
@@ -736,7 +736,7 @@ namespace ImSpinner
       window->DrawList->AddRectFilled(S(0, 15), S(40, 25), c);
       window->DrawList->AddRectFilled(S(15, 0), S(25, 40), c);
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       // l16: inset 0 -> -10 -> -10 -> 0, rotate 0 -> 0 -> 90 -> 90
@@ -781,7 +781,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(81, 75, 130), 1.f);   // #514b82
       const float k = radius / 50.f;            // fit the upward march excursion
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       // sp7 keyframes: translate(tx,ty) + rotate(deg), held at the ends
@@ -830,7 +830,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(240, 51, 85), 1.f);   // #f03355
       const float k = radius / 35.f;            // fit the split-apart reach
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       // l18: inset 0 -> -10 -> -10 -> 0 (pieces split by |inset|*sqrt2), rotate 0->0->90->90
@@ -880,7 +880,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(255, 165, 0), 1.f);   // orange
       const float k = radius / 40.f;            // fit the full walk-apart reach (~80 wide)
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -931,7 +931,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(240, 51, 85), 1.f);   // #f03355
       const float k = radius / 60.f;            // fit the full tumble sweep (~120 tall)
 
-      float t2 = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t2 = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t2 = 1.f - t2;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -992,7 +992,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(240, 51, 85), 1.f);   // #f03355
       const float k = radius / 40.f;            // fit the swap sweep (~80 wide/tall)
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1041,7 +1041,7 @@ namespace ImSpinner
       const float k = radius / 44.f;            // fit the wiper sweep (~87 wide)
       const float d2r = IM_PI / 180.f;
 
-      float t2 = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t2 = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t2 = 1.f - t2;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1098,7 +1098,7 @@ namespace ImSpinner
       const float k = radius / 47.f;            // fit skew sweep (~87 wide) + 3px shadow
       const float d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1167,7 +1167,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(255, 165, 0), 1.f);   // orange
       const float k = radius / 60.f;            // fit the full diagonal + stretch excursion
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t = 1.f - t;
 
       // l24 keyframes: translate (px, later signed by --s) + scale (unitless)
@@ -1219,7 +1219,7 @@ namespace ImSpinner
 
       auto ease = [](float u) { const float kk = 1.f - u; return 1.f - kk * kk * kk; };  // ~cubic-bezier(.3,1,0,1)
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t = 1.f - t;
 
       // l25: inset 0 -> -8 -> -8 -> 0 (bloom), rotate 0 -> 0 -> 180 -> 180
@@ -1275,7 +1275,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(81, 75, 130), 1.f);   // #514b82
       const float k = radius / 42.f;            // fit the 30px half-box + 12px slide
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1331,7 +1331,7 @@ namespace ImSpinner
       const float k = radius / (20.f * 1.41421356f);             // farthest corner is 20*sqrt2 from the pivot
       const float d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 2.f) / 2.f;   // 0..1 over 2s
+      float t = detail::AnimTime(speed, 2.f) / 2.f;   // 0..1 over 2s
       if (mode == 2) t = 1.f - t;
 
       // l28-0: square holds, snaps to a 180-deg point reflection at half, then
@@ -1382,7 +1382,7 @@ namespace ImSpinner
       const float k = radius / (20.f * 2.23606798f);             // farthest point is 20*sqrt5 from (40,20)
       const float d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;   // 0..1 over 1.5s
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;   // 0..1 over 1.5s
       if (mode == 2) t = 1.f - t;
 
       // l30-1 clip: third vertex slides BR(40,40) -> TR(40,0) over 33..66%, else BR
@@ -1438,7 +1438,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(255, 165, 0), 1.f);  // orange
       const float k = radius / 32.5f;           // expanded grid half-size (65px / 2)
 
-      float u = ImFmod((float)ImGui::GetTime() * speed, 1.f);   // 0..1 full ping-pong
+      float u = detail::AnimTime(speed, 1.f);   // 0..1 full ping-pong
       if (mode == 2) u = 1.f - u;
       const float p = (u < 0.5f) ? (u * 2.f) : ((1.f - u) * 2.f);   // 0.5s alternate -> triangle
 
@@ -1476,7 +1476,7 @@ namespace ImSpinner
       const float k = radius / 32.5f;           // expanded grid half-size (65px / 2)
       const float h = 8.f;                      // half square (16px)
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      float t = detail::AnimTime(speed, 1.f);
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1523,7 +1523,7 @@ namespace ImSpinner
       const float k = radius / 39.53f;          // outer-bar corner reach at full spread: sqrt(32.5^2 + 22.5^2)
       const float d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       auto pwl = [](const float *K, const float *V, int n, float tt) -> float {
@@ -1564,7 +1564,7 @@ namespace ImSpinner
       const ImColor c = color_alpha(ImColor(81, 75, 130), 1.f);  // #514b82
       const float k = radius / 30.f;            // box half-size (60px / 2)
 
-      float cyc = ImFmod((float)ImGui::GetTime() * speed, 4.f) / 4.f;   // 2s-alternate -> 4s ping-pong
+      float cyc = detail::AnimTime(speed, 4.f) / 4.f;   // 2s-alternate -> 4s ping-pong
       if (mode == 2) cyc = 1.f - cyc;
       const float p = (cyc < 0.5f) ? (cyc * 2.f) : ((1.f - cyc) * 2.f);  // keyframe progress 0..1..0
 
@@ -1612,7 +1612,7 @@ namespace ImSpinner
       const float k = radius / 50.f;            // discs slide to +/-25 px, +25 radius -> reach 50
       const float R = 25.f, d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       static const float tK[6]  = { 0.f, 0.1f, 0.35f, 0.66f, 0.9f, 1.f };
@@ -1672,7 +1672,7 @@ namespace ImSpinner
       const float k = radius / 75.f;            // orbit radius 50 + disc radius 25
       const float R = 25.f, d2r = IM_PI / 180.f;
 
-      float t = ImFmod((float)ImGui::GetTime() * speed, 1.5f) / 1.5f;
+      float t = detail::AnimTime(speed, 1.5f) / 1.5f;
       if (mode == 2) t = 1.f - t;
 
       static const float tK[6] = { 0.f, 0.1f, 0.35f, 0.66f, 0.9f, 1.f };
@@ -16,6 +16,58 @@
 
 namespace ImSpinner
 {
+    namespace detail {
+      // Text scaled down to fit a spinner cell: the fitted font size, the extent of the text at that size and
+      // the per-character advances / x offsets the per-letter spinners step through. Fitting and measuring cost
+      // several CalcTextSizeA passes over the string, so the result is cached per (font, base size, text contents,
+      // max width) and a steady-state frame only emits the glyphs. The key is a 32-bit hash, so an entry keeps
+      // the inputs it was built from and a hit is checked against them.
+      struct TextLayout {
+        const ImFont *font = nullptr;
+        float base_size = 0.f, max_width = 0.f;
+        std::vector<char> text;       // the measured text, without the terminator
+        float font_size = 0.f;
+        ImVec2 size;
+        std::vector<float> advances;  // width of text[i] alone, one per byte
+        std::vector<float> offsets;   // width of text[0, i), one per byte plus the end
+      };
+
+      inline const TextLayout &GetTextLayout(ImFont *font, float base_size, const char *text, float max_width) {
+        static BoundedCache<TextLayout, 512> cache;  // texts that change every frame keep adding entries
+        if (!text)
+          text = "";
+
+        struct { const ImFont *font; float base_size, max_width; } key_data = { font, base_size, max_width };
+        const int len = (int)strlen(text);
+        bool found;
+        TextLayout &layout = cache.Get(ImHashStr(text, 0, ImHashData(&key_data, sizeof(key_data))), found);
+        if (found && layout.font == font && layout.base_size == base_size && layout.max_width == max_width
+            && (int)layout.text.size() == len && (len == 0 || memcmp(layout.text.data(), text, len) == 0))
+          return layout;
+
+        // A new entry, or a hash collision rebuilt in place; its buffers are reused.
+        layout.font = font;
+        layout.base_size = base_size;
+        layout.max_width = max_width;
+        layout.text.assign(text, text + len);
+        layout.font_size = base_size;
+        layout.size = font->CalcTextSizeA(layout.font_size, 99999.f, 0.f, text);
+        if (layout.size.x > max_width && layout.size.x > 0.f) {
+          layout.font_size *= max_width / layout.size.x;
+          layout.size = font->CalcTextSizeA(layout.font_size, 99999.f, 0.f, text);
+        }
+
+        layout.advances.resize(len);
+        layout.offsets.resize(len + 1);
+        for (int i = 0; i < len; i++) {
+          layout.advances[i] = font->CalcTextSizeA(layout.font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+          layout.offsets[i] = font->CalcTextSizeA(layout.font_size, 99999.f, 0.f, text, text + i).x;
+        }
+        layout.offsets[len] = layout.size.x;
+        return layout;
+      }
+    }
+
     // Pulsing text loader, a port of the CSS:
     //   .loader:before { content:"Loading..." }
     //   @keyframes l1 { to { opacity: 0 } }   /* 1s linear infinite alternate */
@@ -25,18 +77,14 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float phase = ImFmod((float)ImGui::GetTime() * speed, 2.f);
+      const float phase = detail::AnimTime(speed, 2.f);
       const float opacity = (phase < 1.f) ? (1.f - phase) : (phase - 1.f);
 
       // Scale the font down so the text fits inside the spinner cell (2*radius wide).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       window->DrawList->AddText(font, font_size, ImVec2(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f),
                                 color_alpha(color, opacity), text);
@@ -51,7 +99,7 @@ namespace ImSpinner
         if (!text || !*text)
             return;
 
-        const float start = ImFmod((float)ImGui::GetTime() * speed, PI_2);
+        const float start = detail::AnimTime(speed, PI_2);
         const char *last_symbol = ImGui::FindRenderedTextEnd(text);
         const ImVec2 text_size = ImGui::CalcTextSize(text, last_symbol);
 #if IMGUI_VERSION_NUM < 19150
@@ -83,17 +131,13 @@ namespace ImSpinner
     {
       SPINNER_HEADER(pos, size, centre, num_segments);
 
-      const float progress = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float progress = detail::AnimTime(speed, 1.f);
 
       // Scale the font down so the text fits inside the spinner cell (2*radius wide).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
@@ -117,13 +161,9 @@ namespace ImSpinner
 
       // Scale the font down so the text fits inside the spinner cell (2*radius wide).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
@@ -132,7 +172,7 @@ namespace ImSpinner
       // Dashes light up one after another, left to right (CSS steps()): the count
       // grows from 1 to 'dashes' over the cycle, then resets. Dash fills 80% of the
       // period (8% solid / 2% gap in CSS).
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int shown = ImMin(ndashes, (int)(t * ndashes) + 1);
       const float period = ts.x / (float)ndashes;
       const float dash = period * 0.8f;
@@ -161,19 +201,16 @@ namespace ImSpinner
       const int ntail = (tail <= 0) ? len : ImMin(tail, len); // tail<=0 -> type out the whole text
       const int nsteps = ntail + 1;                          // hidden..fully revealed
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int step = ImMin(nsteps - 1, (int)(t * nsteps)); // 0..ntail (CSS steps())
+      spinner_scope.NextChange(detail::NextStepTime(speed, 1.f, (float)nsteps));
       const int visible = (len - ntail) + step;
 
       // Scale the font down so the FULL text fits the cell (so it never jumps).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       window->DrawList->AddText(font, font_size, tp, color_alpha(color, 1.f), text, text + visible);
@@ -196,17 +233,13 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the scroll window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const float ch = ts.x / (float)len;                    // monospace char width
       const float wrap = ts.x + ch;                          // 11ch for a 10-char string
-      const float shift = ImFmod((float)ImGui::GetTime() * speed, 1.f) * wrap;
+      const float shift = detail::AnimTime(speed, 1.f) * wrap;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
@@ -234,23 +267,19 @@ namespace ImSpinner
 
       const int len = (int)strlen(text);
       const int nsteps = len + 1;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int step = ImMin(len, (int)(t * nsteps));        // 0..len (CSS steps())
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor cfg = color_alpha(color, 1.f);
       const ImColor cbg = color_alpha(bg, 1.f);
-      auto char_x = [&](int n) { return tp.x + font->CalcTextSizeA(font_size, 99999.f, 0.f, text, text + n).x; };
+      auto char_x = [&](int n) { return tp.x + layout.offsets[n]; };
 
       if (mode == 0) {
         // Cumulative fill: prefix [0, step) in 'color', the rest in 'bg'.
@@ -282,13 +311,9 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the scroll window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const float ch = ts.x / (float)len;                    // monospace char width
       const float wrap = ts.x + ch;                          // 11ch for a 10-char string
@@ -296,7 +321,7 @@ namespace ImSpinner
       const int K = (int)(sizeof(palette) / sizeof(palette[0]));
 
       // Per-segment ease (each 1/(K-1) of the cycle shifts one wrap, cubic-bezier-ish).
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(K - 2, (int)(t * (K - 1)));
       const float local = t * (K - 1) - seg;
       const float shift = (seg + ease_outcubic(local)) * wrap;
@@ -326,19 +351,15 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImColor palette[] = { color, ImColor(0x8A, 0x9B, 0x0F), ImColor(0xC0, 0x29, 0x42), ImColor(0x00, 0xA0, 0xB0) };
       const int K = (int)(sizeof(palette) / sizeof(palette[0]));
 
       // Pick the current color pair and the eased wipe progress within the segment.
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(K - 1, (int)(t * K));
       const float e = ease_outcubic(t * K - seg);
       const ImColor cA = color_alpha(palette[seg], 1.f);
@@ -372,23 +393,19 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
-      const float osc = ImSin((float)ImGui::GetTime() * speed * PI_2); // -1..1, 1s period at speed 1
+      const float osc = ImSin(detail::AnimTime(speed, 1.f) * PI_2); // -1..1, 1s period at speed 1
       const float amp = ts.y * 0.25f;
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
         const float sign = (i & 1) ? -1.f : 1.f;
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y + sign * amp * osc), c, text + i, text + i + 1);
         x += cw;
       }
@@ -410,13 +427,9 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the slide window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
@@ -425,7 +438,7 @@ namespace ImSpinner
       // l12: move over 1/2 of the cycle, no delay; l13: move over 1/4, bottom half delayed half a cycle.
       const float move_frac = (mode == 0) ? 0.5f : 0.25f;
       const float delay = (mode == 0) ? 0.f : 0.5f;
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float shift_t = ease_inoutquad(ImMin(1.f, t / move_frac)) * ts.x;
       const float tb = ImFmod(t + delay, 1.f);
       const float shift_b = ease_inoutquad(ImMin(1.f, tb / move_frac)) * ts.x;
@@ -457,19 +470,15 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the scroll window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float wrap = ts.x;                               // 10ch == text width
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float fill_end = 0.8f;
       float bar_frac, shift;
       if (t < fill_end) { bar_frac = t / fill_end; shift = 0.f; }            // grow the bar, text still
@@ -501,25 +510,21 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float H = ts.y;                                  // one line-height roll distance
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float roll = ImMin(1.f, t / 0.8f);               // roll over 0..80%, hold 80..100%
 
       window->DrawList->PushClipRect(ImVec2(tp.x, tp.y), ImVec2(tp.x + ts.x, tp.y + ts.y), true);
       float x = tp.x;
       for (int i = 0; i < len; i++) {
         const float sign = (i & 1) ? -1.f : 1.f;             // neighbours roll opposite ways
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y + sign * roll * H), c, text + i, text + i + 1);          // rolling out
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y + sign * (roll - 1.f) * H), c, text + i, text + i + 1);  // rolling in
         x += cw;
@@ -544,13 +549,9 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImColor pal[] = {
         color,                       // 0: base (CSS currentColor)
@@ -572,7 +573,7 @@ namespace ImSpinner
         { 0, 5, 4, 8, 7, 1, 0, 6, 8, 0 }  // 80%
       };
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(4, (int)(t * 5.f));
       const float u = t * 5.f - seg;
       auto lerp = [](const ImColor &a, const ImColor &b, float k) {
@@ -583,7 +584,7 @@ namespace ImSpinner
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const ImColor col = (i < 10) ? lerp(pal[kf[seg][i]], pal[kf[(seg + 1) % 5][i]], u) : color;
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y), color_alpha(col, 1.f), text + i, text + i + 1);
         x += cw;
@@ -605,24 +606,20 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float H = ts.y;                                  // one line-height drop distance
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float step = 0.4f / (float)len;                  // per-letter stagger (0..40% in, 60..100% out)
 
       window->DrawList->PushClipRect(ImVec2(tp.x, tp.y), ImVec2(tp.x + ts.x, tp.y + ts.y), true);
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float in_s = i * step, in_e = in_s + step;                 // drops in: -H -> 0
         const float out_s = 0.6f + (len - 1 - i) * step, out_e = out_s + step; // falls out: 0 -> +H (last letter first)
         float y;
@@ -652,24 +649,20 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the slide window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float D = ts.x;                                  // off-window slide distance
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float step = 0.4f / (float)len;                  // per-letter stagger
 
       window->DrawList->PushClipRect(ImVec2(tp.x, tp.y), ImVec2(tp.x + ts.x, tp.y + ts.y), true);
       float nx = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float in_s = i * step, in_e = in_s + step;                 // slides in from the right: +D -> 0
         const float out_s = 0.6f + i * step, out_e = out_s + step;       // slides out to the left: 0 -> -D
         float dx;
@@ -699,21 +692,17 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float step = 0.4f / (float)len;                  // per-letter stagger
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float in_s = i * step, in_e = in_s + step;                 // fade in:  0 -> 1
         const float out_s = 0.6f + i * step, out_e = out_s + step;       // fade out: 1 -> 0
         float a;
@@ -742,23 +731,19 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor c = color_alpha(color, 1.f);
       const float amp = ts.y * 0.35f;                        // hop height (~10px at 30px font)
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float hw = 1.f / (float)(len + 1);               // half-width of each hop window
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float peak = (i + 1) * hw;                     // this letter's peak time
         float d = ImFabs(t - peak);
         d = ImMin(d, 1.f - d);                               // cyclic distance
@@ -782,18 +767,14 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor cfg = color_alpha(color, 1.f);
       const ImColor cbg = color_alpha(bg, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float boundary = tp.x + ts.x * t;                // bar covers [tp.x, boundary]
 
       // The bar (filled) behind the swept part, with inverted text on it.
@@ -821,18 +802,14 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor cfg = color_alpha(color, 1.f);
       const ImColor cbg = color_alpha(bg, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float halfw = ts.x * 0.14f;                      // band half-width (~1em)
       const float bc = tp.x - halfw + t * (ts.x + 2.f * halfw); // band centre sweeps left -> right
       const float x0 = ImMax(tp.x, bc - halfw);
@@ -866,18 +843,14 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell (the scroll window width).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor cfg = color_alpha(color, 1.f);
       const ImColor cbg = color_alpha(bg, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float shift = t * ts.x;                          // text scrolls left one word per cycle
       const float bl = tp.x + ts.x - t * 2.f * ts.x;         // band left edge: off-right -> full window -> off-left
       const float ix0 = ImMax(tp.x, bl);
@@ -915,23 +888,19 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const float R = ts.y * 0.8f;                           // spotlight radius (~one line height)
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float tri = (t < 0.5f) ? t * 2.f : 2.f - t * 2.f; // ping-pong 0..1..0 (CSS alternate)
       const float bx = tp.x + tri * ts.x;                    // spotlight centre
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float d = ImFabs((x + cw * 0.5f) - bx);        // distance from letter centre to spotlight
         const float b = ImClamp(1.f - d / R, 0.f, 1.f);
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y), color_alpha(color, 0.2f + 0.8f * b), text + i, text + i + 1);
@@ -952,13 +921,9 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const float k = font_size / 30.f;                      // CSS offsets are px at 30px font
@@ -966,7 +931,7 @@ namespace ImSpinner
         ImVec2(10, 0), ImVec2(4, -4), ImVec2(2, 8), ImVec2(12, -6),
         ImVec2(0, 12), ImVec2(-8, -4), ImVec2(-12, 6), ImVec2(6, 0)
       };
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(7, (int)(t * 8.f));
       ImVec2 o = off[seg];
       if (mode != 0) {                                       // smooth: lerp toward the next offset
@@ -991,16 +956,12 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       auto ramp = [](float v, float a, float b) { return ImClamp((v - a) / (b - a), 0.f, 1.f); };
       const float ax = ramp(t, 0.10f, 0.30f) * IM_PI;        // rotateX 0 -> 180
       const float ay = ramp(t, 0.36f, 0.63f) * IM_PI;        // rotateY 0 -> 180
@@ -1034,26 +995,22 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
       const int half = len / 2;
-      const float wA = font->CalcTextSizeA(font_size, 99999.f, 0.f, text, text + half).x;
+      const float wA = layout.offsets[half];
 
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float angA = PI_2 * ImMin(1.f, t / 0.5f);        // spins over first half, then holds
       const float tB = ImFmod(t + 0.5f, 1.f);                // second half delayed by half a cycle
       const float angB = PI_2 * ImMin(1.f, tB / 0.5f);
 
       auto drawPart = [&](const char *b, const char *e, float x, float ang) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, b, e).x;
+        const float cw = layout.offsets[e - text] - layout.offsets[b - text];
         const ImVec2 cc(x + cw * 0.5f, tp.y + ts.y * 0.5f);  // rotate about this half's centre
         const float co = ImCos(ang), si = ImSin(ang);
         const int v0 = window->DrawList->VtxBuffer.Size;
@@ -1083,16 +1040,12 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       auto ramp = [](float v, float a, float b) { return ImClamp((v - a) / (b - a), 0.f, 1.f); };
       const float rz = ramp(t, 0.10f, 0.30f) * IM_PI;        // in-plane rotate 0 -> 180
       const float ay = ramp(t, 0.36f, 0.63f) * IM_PI;        // rotateY 0 -> 180
@@ -1142,23 +1095,19 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImVec2 cc(tp.x + ts.x * 0.5f, tp.y + ts.y * 0.5f); // word centre
       const ImColor col = color_alpha(color, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float angle = PI_2 * ImMin(1.f, t / 0.8f);        // spin over 0..80%, then hold
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float ang = (i & 1) ? -angle : angle;          // even/odd counter-rotate
         const float co = ImCos(ang), si = ImSin(ang);
         const int v0 = window->DrawList->VtxBuffer.Size;
@@ -1188,23 +1137,19 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
       const float H = ts.y;                                  // one line-height roll distance
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
 
       window->DrawList->PushClipRect(ImVec2(tp.x, tp.y), ImVec2(tp.x + ts.x, tp.y + ts.y), true);
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float ph = (i & 1) ? ImFmod(t + 0.5f, 1.f) : t; // odd columns half a cycle behind
         const float yo = ph * H;
         window->DrawList->AddText(font, font_size, ImVec2(x, tp.y + yo), col, text + i, text + i + 1);         // rolling down
@@ -1229,22 +1174,18 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
-      const float a = (float)ImGui::GetTime() * speed;
+      const float a = detail::AnimTime(speed);
       const float A = font_size * 0.12f;                     // jitter amplitude
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         const float ox = A * ImSin(a * 38.f + i * 1.7f);     // per-letter, incommensurate x/y
         const float oy = A * ImSin(a * 47.f + i * 2.9f);
         window->DrawList->AddText(font, font_size, ImVec2(x + ox, tp.y + oy), col, text + i, text + i + 1);
@@ -1266,16 +1207,12 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
-      const float a = (float)ImGui::GetTime() * speed;
+      const float a = detail::AnimTime(speed);
       const float A = font_size * 0.06f;                     // split amplitude
       const int al = (int)(255.f * ImGui::GetStyle().Alpha);
 
@@ -1302,17 +1239,13 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const float k = font_size / 30.f;                      // CSS blur px at 30px font
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
 
       struct Pulse { int idx; float time; float blur; };
       static const Pulse pulses[] = {
@@ -1324,7 +1257,7 @@ namespace ImSpinner
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         float bl = 0.f;                                      // this letter's blur amount (px) right now
         for (int p = 0; p < np; p++)
           if (pulses[p].idx == i) {
@@ -1361,17 +1294,13 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
 
       // bit i set => char i is dropped (space); one mask per 5% keyframe from 20%..70%.
       static const unsigned masks[11] = {
@@ -1381,10 +1310,11 @@ namespace ImSpinner
       unsigned mask = 0u;
       if (t >= 0.20f && t < 0.75f)
         mask = masks[ImMin(10, (int)((t - 0.20f) / 0.05f))];
+      spinner_scope.NextChange(detail::NextStepTime(speed, 1.f, 20.f));   // keyframes are 5% apart
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         if (!((mask >> i) & 1u))                             // draw unless this char is dropped
           window->DrawList->AddText(font, font_size, ImVec2(x, tp.y), col, text + i, text + i + 1);
         x += cw;
@@ -1408,22 +1338,17 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
       const float k = font_size / 30.f;                      // CSS px at 30px font
-      const float a = (float)ImGui::GetTime();
-      const float t = ImFmod(a * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const int seg = ImMin(4, (int)(t * 5.f));
       const float u = t * 5.f - seg;
-      const float disp = 3.f * k * ImSin(a * speed * 60.f);  // fast displacement
+      const float disp = 3.f * k * ImSin(detail::AnimTime(speed * 60.f));  // fast displacement
 
       auto slice = [&](float lo, float hi, bool vertical) {
         // crisp text on both sides of [lo, hi], displaced text inside it
@@ -1480,17 +1405,13 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const ImColor col = color_alpha(color, 1.f);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float ch = ts.x / (float)len;
 
       // Band X schedule (ch positions; the 2nd/6th keyframes are 100% = ts.x).
@@ -1532,18 +1453,14 @@ namespace ImSpinner
       static const char *lines[6] = {
         "Loading...", "godnLai...", "oiaglni...", "Liongad...", "gindola...", "naloidg..."
       };
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const char *text = lines[ImMin(5, (int)(t * 6.f))];    // snap to one scramble (steps(6))
 
       // Scale the font down so the full text fits the cell (all lines share length).
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       window->DrawList->AddText(font, font_size, tp, color_alpha(color, 1.f), text);
@@ -1563,7 +1480,7 @@ namespace ImSpinner
       const int len = (int)strlen(text);
       static const char sym[] = "#@%&$*?+=~";
       const int symn = (int)(sizeof(sym) - 1);
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       const float tri = (t < 0.5f) ? t * 2.f : 2.f - t * 2.f; // ping-pong (CSS alternate)
       const int k = ImMin(len, (int)(tri * (len + 1)));       // 0..len chars encoded
 
@@ -1600,22 +1517,18 @@ namespace ImSpinner
 
       // Scale the font down so the full text fits the cell.
       ImFont *font = ImGui::GetFont();
-      float font_size = ImGui::GetFontSize();
-      const float max_width = radius * 2.f;
-      ImVec2 ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      if (ts.x > max_width && ts.x > 0.f) {
-        font_size *= max_width / ts.x;
-        ts = font->CalcTextSizeA(font_size, 99999.f, 0.f, text);
-      }
+      const detail::TextLayout &layout = detail::GetTextLayout(font, ImGui::GetFontSize(), text, radius * 2.f);
+      const float font_size = layout.font_size;
+      const ImVec2 ts = layout.size;
 
       const ImVec2 tp(centre.x - ts.x * 0.5f, centre.y - ts.y * 0.5f);
       const float k = font_size / 30.f;                      // CSS px at 30px font
-      const float t = ImFmod((float)ImGui::GetTime() * speed, 1.f);
+      const float t = detail::AnimTime(speed, 1.f);
       static const float vt[10] = { 0.27f, 0.72f, 0.09f, 0.90f, 0.54f, 0.36f, 0.18f, 0.81f, 0.45f, 0.63f }; // per-letter vanish time
 
       float x = tp.x;
       for (int i = 0; i < len; i++) {
-        const float cw = font->CalcTextSizeA(font_size, 99999.f, 0.f, text + i, text + i + 1).x;
+        const float cw = layout.advances[i];
         float y, a;
         if (t >= 0.90f) {                                    // all letters drop back in together
           const float rp = (t - 0.90f) / 0.10f;
@@ -0,0 +1,50 @@
+#ifndef _IMSPINNER_TESTS_ALLOC_COUNTER_H_
+#define _IMSPINNER_TESTS_ALLOC_COUNTER_H_
+
+/*
+ * Counts heap allocations made between Begin() and End(). Replaces the global
+ * operator new / delete, so include it from exactly one translation unit of a
+ * test executable.
+ */
+
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter
+{
+    inline bool &Counting() { static bool counting = false; return counting; }
+    inline long &Count() { static long count = 0; return count; }
+
+    inline void Begin() { Count() = 0; Counting() = true; }
+    inline long End() { Counting() = false; return Count(); }
+
+    inline void *Allocate(size_t size) {
+      if (Counting())
+        Count()++;
+      return malloc(size ? size : 1);
+    }
+
+    // Dear ImGui allocates through its own hooks (malloc by default); pass these to ImGui::SetAllocatorFunctions()
+    // before the context is created to count those too.
+    inline void *ImGuiAlloc(size_t size, void *) { return Allocate(size); }
+    inline void ImGuiFree(void *p, void *) { free(p); }
+}
+
+void *operator new(size_t size) {
+  if (void *p = alloc_counter::Allocate(size))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) {
+  if (void *p = alloc_counter::Allocate(size))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return alloc_counter::Allocate(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return alloc_counter::Allocate(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+#endif // _IMSPINNER_TESTS_ALLOC_COUNTER_H_
@@ -0,0 +1,68 @@
+// Per-point cost of the ring path behind SPINNER_HEADER's `circle` helper: the std::function path the helper
+// used to build, against detail::EmitCircle, which inlines the point generator. Both must emit the same
+// geometry; the timings are printed.
+
+#include "headless.h"
+
+#include <functional>
+
+static void EmitCircleStdFunction(ImDrawList *draw_list, const ImVec2 &centre, int num_segments, const std::function<ImVec2 (int)> &point_func, ImU32 col, float thickness)
+{
+  draw_list->PathClear();
+  for (int i = 0; i < num_segments; i++) {
+    ImVec2 p = point_func(i);
+    draw_list->PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y));
+  }
+  ImSpinner::detail::PathStroke(draw_list, col, thickness, 0);
+}
+
+int main()
+{
+  headless::Context context;
+  headless::BeginFrame(0.0);
+
+  ImDrawList draw_list(ImGui::GetDrawListSharedData());
+  const ImVec2 centre(100, 100);
+  const float radius = 16.f, start = 0.3f;
+  const ImU32 col = IM_COL32_WHITE;
+  auto reset = [&] { draw_list._ResetForNewFrame(); draw_list.PushClipRectFullScreen(); };
+
+  int failures = 0;
+  const int segment_counts[] = { 16, 64, 256 };
+  for (int segments : segment_counts) {
+    const float step = IM_PI * 2.f / segments;
+    auto point = [&] (int i) { const float a = start + i * step; return ImVec2(ImCos(a) * radius, ImSin(a) * radius); };
+
+    reset();
+    EmitCircleStdFunction(&draw_list, centre, segments, point, col, 2.f);
+    ImVector<ImDrawVert> expected;
+    expected.resize(draw_list.VtxBuffer.Size);
+    memcpy(expected.Data, draw_list.VtxBuffer.Data, (size_t)expected.Size * sizeof(ImDrawVert));
+
+    reset();
+    ImSpinner::detail::EmitCircle(&draw_list, centre, segments, point, col, 2.f);
+    if (draw_list.VtxBuffer.Size != expected.Size || memcmp(draw_list.VtxBuffer.Data, expected.Data, (size_t)expected.Size * sizeof(ImDrawVert)) != 0) {
+      printf("FAIL: EmitCircle geometry differs from the std::function path at %d segments\n", segments);
+      failures++;
+    }
+
+    // Path building only, then path plus stroke (what a spinner pays).
+    const int iterations = 200000 / segments;
+    const double path_old = headless::TimePerCall(iterations, [&] (int) {
+      const std::function<ImVec2 (int)> f = point;
+      draw_list.PathClear();
+      for (int i = 0; i < segments; i++) { const ImVec2 p = f(i); draw_list.PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y)); }
+    }) / segments;
+    const double path_new = headless::TimePerCall(iterations, [&] (int) {
+      draw_list.PathClear();
+      for (int i = 0; i < segments; i++) { const ImVec2 p = point(i); draw_list.PathLineTo(ImVec2(centre.x + p.x, centre.y + p.y)); }
+    }) / segments;
+    const double full_old = headless::TimePerCall(iterations, [&] (int) { reset(); EmitCircleStdFunction(&draw_list, centre, segments, point, col, 2.f); }) / segments;
+    const double full_new = headless::TimePerCall(iterations, [&] (int) { reset(); ImSpinner::detail::EmitCircle(&draw_list, centre, segments, point, col, 2.f); }) / segments;
+    printf("%4d segments: path %.2f -> %.2f ns/point, path + stroke %.2f -> %.2f ns/point (std::function -> EmitCircle)\n",
+           segments, path_old, path_new, full_old, full_new);
+  }
+
+  headless::EndFrame();
+  return failures ? 1 : 0;
+}
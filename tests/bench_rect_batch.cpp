@@ -0,0 +1,119 @@
+// Bar spinners add their filled rects through detail::RectBatch, which merges columns sharing an edge and
+// appends the whole spinner with one PrimReserve. Checks that it covers exactly what one AddRectFilled per rect
+// covers, in the same draw order and with no more vertices, and times both ways and SpinnerFluid per frame.
+
+#include "headless.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+struct Rect { ImVec2 a, b; ImU32 col; };
+
+// Colour seen at each sample point after drawing the triangles in order. Samples sit off the eighth-pixel grid
+// the test rects' edges lie on, so only a rect's own diagonal can pass through one.
+static void Rasterize(const ImDrawList &draw_list, int width, int height, ImVector<ImU32> &out)
+{
+  out.resize(width * height);
+  memset(out.Data, 0, (size_t)out.Size * sizeof(ImU32));
+  const ImDrawVert *vtx = draw_list.VtxBuffer.Data;
+  for (int i = 0; i + 2 < draw_list.IdxBuffer.Size; i += 3) {
+    const ImDrawVert &v0 = vtx[draw_list.IdxBuffer[i]], &v1 = vtx[draw_list.IdxBuffer[i + 1]], &v2 = vtx[draw_list.IdxBuffer[i + 2]];
+    const float area = (v1.pos.x - v0.pos.x) * (v2.pos.y - v0.pos.y) - (v1.pos.y - v0.pos.y) * (v2.pos.x - v0.pos.x);
+    if (area == 0.f)
+      continue;
+    const int x_min = ImMax(0, (int)ImMin(v0.pos.x, ImMin(v1.pos.x, v2.pos.x))), x_max = ImMin(width - 1, (int)ImMax(v0.pos.x, ImMax(v1.pos.x, v2.pos.x)));
+    const int y_min = ImMax(0, (int)ImMin(v0.pos.y, ImMin(v1.pos.y, v2.pos.y))), y_max = ImMin(height - 1, (int)ImMax(v0.pos.y, ImMax(v1.pos.y, v2.pos.y)));
+    for (int y = y_min; y <= y_max; y++)
+      for (int x = x_min; x <= x_max; x++) {
+        const ImVec2 p(x + 0.37f, y + 0.61f);
+        const float w0 = ((v1.pos.x - p.x) * (v2.pos.y - p.y) - (v1.pos.y - p.y) * (v2.pos.x - p.x)) / area;
+        const float w1 = ((v2.pos.x - p.x) * (v0.pos.y - p.y) - (v2.pos.y - p.y) * (v0.pos.x - p.x)) / area;
+        if (w0 >= -1e-4f && w1 >= -1e-4f && w0 + w1 <= 1.f + 1e-4f)  // either triangle of a rect's diagonal
+          out[y * width + x] = v0.col;
+      }
+  }
+}
+
+int main()
+{
+  headless::Context context;
+  headless::BeginFrame(0.0);
+
+  ImDrawList draw_list(ImGui::GetDrawListSharedData());
+  auto reset = [&] { draw_list._ResetForNewFrame(); draw_list.PushClipRectFullScreen(); };
+
+  // SpinnerFluid-like layers of columns on a shared bottom edge, hanging columns on a shared top edge, and
+  // random rects: overlapping, flipped corners, translucent and invisible.
+  std::vector<std::vector<Rect>> sets(3);
+  for (int layer = 0; layer < 4; layer++)
+    for (int j = 0; j < 32; j++) {
+      const float h = std::floor((10.f + 8.f * std::sin(layer + j * 0.3f)) * 4.f) / 4.f;  // edges on eighth pixels, clear of the samples
+      sets[0].push_back({ ImVec2(4.f + j, 60.f), ImVec2(5.f + j, 60.f - h * (layer + 1) * 0.5f), IM_COL32(255, 40 * layer, 0, 60 + 40 * layer) });
+      sets[1].push_back({ ImVec2(4.f + j * 2.5f, 4.f), ImVec2(6.5f + j * 2.5f, 4.f + h + layer * 3.f), layer & 1 ? IM_COL32(0, 255, 0, 255) : IM_COL32(0, 0, 255, 128) });
+    }
+  srand(7);
+  for (int i = 0; i < 400; i++) {
+    const ImVec2 a((float)(rand() % 120), (float)(rand() % 60)), b(a.x + (float)(rand() % 21 - 10), a.y + (float)(rand() % 21 - 10));
+    const ImU32 alpha = (i % 7 == 0) ? 0 : (ImU32)(rand() % 255 + 1);
+    sets[2].push_back({ a, b, IM_COL32(rand() % 256, rand() % 256, rand() % 256, alpha) });
+  }
+
+  int failures = 0;
+  const int width = 128, height = 72;
+  ImVector<ImU32> expected, actual;
+  for (int s = 0; s < (int)sets.size(); s++) {
+    const std::vector<Rect> &rects = sets[s];
+    reset();
+    for (const Rect &r : rects)
+      draw_list.AddRectFilled(r.a, r.b, r.col);
+    const int plain_vtx = draw_list.VtxBuffer.Size;
+    Rasterize(draw_list, width, height, expected);
+
+    reset();
+    {
+      ImSpinner::detail::RectBatch batch(&draw_list);
+      for (const Rect &r : rects)
+        batch.Add(r.a, r.b, r.col);
+    }
+    const int batch_vtx = draw_list.VtxBuffer.Size;
+    Rasterize(draw_list, width, height, actual);
+
+    if (memcmp(expected.Data, actual.Data, (size_t)expected.Size * sizeof(ImU32)) != 0 || batch_vtx > plain_vtx) {
+      printf("FAIL: rect set %d: batched coverage %s per-rect AddRectFilled, %d vs %d vertices\n", s,
+             memcmp(expected.Data, actual.Data, (size_t)expected.Size * sizeof(ImU32)) ? "differs from" : "matches", batch_vtx, plain_vtx);
+      failures++;
+    }
+
+    const double plain_ns = headless::TimePerCall(20000, [&] (int) {
+      reset();
+      for (const Rect &r : rects)
+        draw_list.AddRectFilled(r.a, r.b, r.col);
+    });
+    const double batch_ns = headless::TimePerCall(20000, [&] (int) {
+      reset();
+      ImSpinner::detail::RectBatch batch(&draw_list);
+      for (const Rect &r : rects)
+        batch.Add(r.a, r.b, r.col);
+    });
+    printf("rect set %d, %d rects: AddRectFilled %.0f ns, %d vertices; RectBatch %.0f ns, %d vertices\n",
+           s, (int)rects.size(), plain_ns, plain_vtx, batch_ns, batch_vtx);
+  }
+  headless::EndFrame();
+
+  // The whole spinner as the gallery draws it.
+  for (int cell = 0; cell < headless::CellCount(); cell++) {
+    if (strcmp(headless::CellInfo(cell).name, "SpinnerFluid") != 0)
+      continue;
+    headless::DrawCost best;
+    for (int frame = 0; frame < 30; frame++) {
+      headless::BeginFrame(frame / 60.0);
+      const headless::DrawCost cost = headless::Measure(ImGui::GetWindowDrawList(), [&] { headless::DrawCell(cell); });
+      best = (frame == 0 || cost.ns < best.ns) ? cost : best;
+      headless::EndFrame();
+    }
+    printf("SpinnerFluid: %.0f ns per frame, %d vertices, %d indices\n", best.ns, best.vtx, best.idx);
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,49 @@
+// Text spinners step through their string with detail::TextLayout instead of one CalcTextSizeA per character
+// per frame. Checks the cached advances against CalcTextSizeA and times both ways of getting them.
+
+#include "headless.h"
+
+#include <cmath>
+
+int main()
+{
+  headless::Context context;
+  headless::BeginFrame(0.0);
+
+  ImFont *font = ImGui::GetFont();
+  const float base_size = ImGui::GetFontSize(), max_width = 64.f;
+  const char *texts[] = { "Loading...", "Please wait", "Downloading update 42%" };
+
+  int failures = 0;
+  for (const char *text : texts) {
+    const ImSpinner::detail::TextLayout &layout = ImSpinner::detail::GetTextLayout(font, base_size, text, max_width);
+    const int len = (int)strlen(text);
+    for (int i = 0; i < len; i++) {
+      const float advance = font->CalcTextSizeA(layout.font_size, FLT_MAX, 0.f, text + i, text + i + 1).x;
+      const float offset = font->CalcTextSizeA(layout.font_size, FLT_MAX, 0.f, text, text + i).x;
+      if (std::fabs(layout.advances[i] - advance) > 1e-4f || std::fabs(layout.offsets[i] - offset) > 1e-4f) {
+        printf("FAIL: \"%s\" char %d: advance %g / %g, offset %g / %g\n", text, i, layout.advances[i], advance, layout.offsets[i], offset);
+        failures++;
+      }
+    }
+
+    // Per frame: what a per-letter spinner needs, the fitted size and every advance.
+    volatile float sink = 0.f;
+    const double per_char = headless::TimePerCall(20000, [&] (int) {
+      float size = base_size, w = font->CalcTextSizeA(size, FLT_MAX, 0.f, text).x;
+      if (w > max_width)
+        size *= max_width / w;
+      for (int i = 0; i < len; i++)
+        sink = sink + font->CalcTextSizeA(size, FLT_MAX, 0.f, text + i, text + i + 1).x;
+    });
+    const double cached = headless::TimePerCall(20000, [&] (int) {
+      const ImSpinner::detail::TextLayout &l = ImSpinner::detail::GetTextLayout(font, base_size, text, max_width);
+      for (int i = 0; i < len; i++)
+        sink = sink + l.advances[i];
+    });
+    printf("\"%s\": %.0f ns per frame with CalcTextSizeA per char, %.0f ns with TextLayout\n", text, per_char, cached);
+  }
+
+  headless::EndFrame();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+#ifndef _IMSPINNER_TESTS_HEADLESS_H_
+#define _IMSPINNER_TESTS_HEADLESS_H_
+
+/*
+ * Headless Dear ImGui context for the benchmark and the tests: no backend, no
+ * window, the font atlas built in memory. Frames are driven by hand with a
+ * simulated spinner clock, so every run draws the same geometry.
+ */
+
+#include "imspinner_demo.h"
+
+#include <chrono>
+#include <cstdio>
+
+namespace headless
+{
+    inline double &ClockTime() { static double time = 0.0; return time; }
+    inline double ReadClock() { return ClockTime(); }
+
+    struct Context {
+      ImGuiContext *ctx = nullptr;
+
+      explicit Context(const ImVec2 &display_size = ImVec2(1280, 720)) {
+        IMGUI_CHECKVERSION();
+        ctx = ImGui::CreateContext();
+        ImGuiIO &io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.LogFilename = nullptr;
+        io.DisplaySize = display_size;
+        io.DeltaTime = 1.f / 60.f;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // big frames split at 64k vertices
+
+        // Without a renderer the atlas is built here, as a backend's NewFrame would.
+        unsigned char *pixels = nullptr;
+        int width = 0, height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+        ImSpinner::SetTimeSource(ReadClock);
+      }
+
+      ~Context() {
+        ImSpinner::SetTimeSource(nullptr);
+        ImGui::DestroyContext(ctx);
+      }
+    };
+
+    // Opens a frame at spinner clock 'time' with one undecorated full-screen window to draw into.
+    inline void BeginFrame(double time) {
+      ClockTime() = time;
+      ImGui::NewFrame();
+      ImGui::SetNextWindowPos(ImVec2(0, 0));
+      ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+      ImGui::Begin("headless", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs);
+    }
+
+    inline void EndFrame() {
+      ImGui::End();
+      ImGui::Render();
+    }
+
+    inline int CellCount() {
+      ImSpinner::DemoCellQuery query;
+      ImSpinner::demoSpinners(&query);
+      return query.count;
+    }
+
+    inline ImSpinner::DemoCellQuery CellInfo(int cell) {
+      ImSpinner::DemoCellQuery query;
+      query.cell = cell;
+      ImSpinner::demoSpinners(&query);
+      return query;
+    }
+
+    // Draws gallery cell 'cell' at the top left of the current window.
+    inline void DrawCell(int cell) {
+      ImGui::SetCursorPos(ImVec2(8, 8));
+      ImSpinner::DemoCellQuery query;
+      query.cell = cell;
+      query.draw = true;
+      ImSpinner::demoSpinners(&query);
+    }
+
+    // What one draw call appended to a draw list.
+    struct DrawCost { double ns = 0.0; int vtx = 0, idx = 0, cmd = 0; };
+
+    template<typename F>
+    inline DrawCost Measure(ImDrawList *draw_list, const F &draw) {
+      const int vtx_begin = draw_list->VtxBuffer.Size, idx_begin = draw_list->IdxBuffer.Size, cmd_begin = draw_list->CmdBuffer.Size;
+      const auto time_begin = std::chrono::steady_clock::now();
+      draw();
+      DrawCost cost;
+      cost.ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - time_begin).count();
+      cost.vtx = draw_list->VtxBuffer.Size - vtx_begin;
+      cost.idx = draw_list->IdxBuffer.Size - idx_begin;
+      cost.cmd = draw_list->CmdBuffer.Size - cmd_begin;
+      return cost;
+    }
+
+    // Nanoseconds per call of f, best of 'rounds' runs of 'iterations' calls each.
+    template<typename F>
+    inline double TimePerCall(int iterations, const F &f, int rounds = 5) {
+      double best = 0.0;
+      for (int r = 0; r < rounds; r++) {
+        const auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+          f(i);
+        const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count() / iterations;
+        best = (r == 0 || ns < best) ? ns : best;
+      }
+      return best;
+    }
+}
+
+#endif // _IMSPINNER_TESTS_HEADLESS_H_
@@ -0,0 +1,124 @@
+// imspinner_bench: draws every spinner of the demo gallery headless and reports its cost per frame.
+//
+//   imspinner_bench [--frames N] [--warmup N] [--format csv|json] [--filter NAME] [--category N] [--gallery] [--out FILE]
+//
+// Each gallery cell is drawn alone for warmup + frames frames of a 60 Hz simulated clock. ns_per_frame is the
+// mean CPU time of the spinner call over the measured frames; vertices, indices and draw_cmds are what the
+// call appended to the draw list in the last frame. --filter keeps cells whose name contains NAME, --category
+// keeps one gallery view (0 = spinners, 1 = text, 2 = dots, 3 = bars, 4 = shapes).
+//
+// --gallery draws all the kept cells in every frame instead, the way demoSpinners() does, and reports one row
+// named "gallery" whose id is the number of cells: mean CPU time of the whole frame of cells and what it
+// appended. This is the number to compare when changing the gallery itself (parameter store, registry lookups).
+
+#include "headless.h"
+
+#include <cstdlib>
+#include <cstring>
+
+struct Result {
+  int cell;
+  const char *name;
+  int category;
+  headless::DrawCost cost;
+};
+
+int main(int argc, char **argv)
+{
+  int frames = 120, warmup = 10, category = -1;
+  bool gallery = false;
+  const char *format = "csv", *filter = nullptr, *out_path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (!strcmp(argv[i], "--frames") && has_value) frames = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--warmup") && has_value) warmup = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--format") && has_value) format = argv[++i];
+    else if (!strcmp(argv[i], "--filter") && has_value) filter = argv[++i];
+    else if (!strcmp(argv[i], "--category") && has_value) category = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--gallery")) gallery = true;
+    else if (!strcmp(argv[i], "--out") && has_value) out_path = argv[++i];
+    else {
+      fprintf(stderr, "usage: %s [--frames N] [--warmup N] [--format csv|json] [--filter NAME] [--category N] [--gallery] [--out FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+  const bool json = !strcmp(format, "json");
+  if (frames < 1 || (!json && strcmp(format, "csv"))) {
+    fprintf(stderr, "%s: --frames must be positive and --format csv or json\n", argv[0]);
+    return 2;
+  }
+
+  headless::Context context;
+  ImVector<Result> results;
+  const int cells = headless::CellCount();
+  for (int cell = 0; cell < cells; cell++) {
+    const ImSpinner::DemoCellQuery info = headless::CellInfo(cell);
+    if ((filter && !strstr(info.name, filter)) || (category >= 0 && info.category != category))
+      continue;
+    results.push_back({ cell, info.name, info.category, headless::DrawCost() });
+  }
+
+  if (gallery) {
+    // One row for the whole gallery: every kept cell drawn once per frame.
+    Result frame_result = { results.Size, "gallery", category, headless::DrawCost() };
+    double total_ns = 0.0;
+    for (int frame = 0; frame < warmup + frames; frame++) {
+      headless::BeginFrame(frame / 60.0);
+      const headless::DrawCost cost = headless::Measure(ImGui::GetWindowDrawList(), [&] {
+        for (const Result &r : results)
+          headless::DrawCell(r.cell);
+      });
+      headless::EndFrame();
+      if (frame >= warmup) {
+        total_ns += cost.ns;
+        frame_result.cost = cost;
+      }
+    }
+    frame_result.cost.ns = total_ns / frames;
+    if (results.Size > 0) {
+      results.resize(1);
+      results[0] = frame_result;
+    }
+  }
+  else
+    for (Result &result : results) {
+      double total_ns = 0.0;
+      for (int frame = 0; frame < warmup + frames; frame++) {
+        headless::BeginFrame(frame / 60.0);
+        const headless::DrawCost cost = headless::Measure(ImGui::GetWindowDrawList(), [&] { headless::DrawCell(result.cell); });
+        headless::EndFrame();
+        if (frame >= warmup) {
+          total_ns += cost.ns;
+          result.cost = cost;
+        }
+      }
+      result.cost.ns = total_ns / frames;
+    }
+
+  FILE *out = out_path ? fopen(out_path, "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], out_path);
+    return 1;
+  }
+  if (json) {
+    fprintf(out, "{\n  \"imgui\": \"%s\",\n  \"frames\": %d,\n  \"spinners\": [\n", IMGUI_VERSION, frames);
+    for (int i = 0; i < results.Size; i++) {
+      const Result &r = results[i];
+      fprintf(out, "    { \"id\": %d, \"name\": \"%s\", \"category\": %d, \"ns_per_frame\": %.0f, \"vertices\": %d, \"indices\": %d, \"draw_cmds\": %d }%s\n",
+              r.cell, r.name, r.category, r.cost.ns, r.cost.vtx, r.cost.idx, r.cost.cmd, i + 1 < results.Size ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+  } else {
+    fprintf(out, "id,name,category,ns_per_frame,vertices,indices,draw_cmds\n");
+    for (const Result &r : results)
+      fprintf(out, "%d,%s,%d,%.0f,%d,%d,%d\n", r.cell, r.name, r.category, r.cost.ns, r.cost.vtx, r.cost.idx, r.cost.cmd);
+  }
+  if (out != stdout)
+    fclose(out);
+
+  if (results.Size == 0) {
+    fprintf(stderr, "%s: no spinner matched\n", argv[0]);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+// Animation phases must not jump when AnimTime wraps. Spinners cycling over 1 .. 6 second periods are drawn
+// half a millisecond before and after the angle wrap (2pi * 2520 s), which is not a cycle edge for them, and the
+// two frames must be nearly the same picture. Far into the clock, a whole number of periods later, they must
+// still draw the same picture as early on. Around both wraps - the angle wrap and the spinner's own one - every
+// spinner, stepped ones included, must draw what it draws at the same phase of its first cycle.
+
+#include "headless.h"
+
+#include <cmath>
+
+using DrawFn = void (*)(const char *label);
+
+struct Case { const char *name; double period; DrawFn draw; bool stepped = false; };
+
+// Seconds per cycle of a spinner whose phase wraps at 'phase' and advances at 'speed' per second.
+static double Period(float phase, float speed) { return (double)phase / (double)speed; }
+
+static const Case cases[] = {
+  { "SpinnerBarsBounceBall",  3.0, [] (const char *l) { ImSpinner::SpinnerBarsBounceBall(l, 16.f, 4.f); } },
+  { "SpinnerBarsStaircase",   2.0, [] (const char *l) { ImSpinner::SpinnerBarsStaircase(l, 16.f, 4.f); } },
+  { "SpinnerBarsKnockAway",   1.5, [] (const char *l) { ImSpinner::SpinnerBarsKnockAway(l, 16.f, 4.f); } },
+  { "SpinnerBarsSplit",       4.0, [] (const char *l) { ImSpinner::SpinnerBarsSplit(l, 16.f, 4.f, ImSpinner::white, 1.f, 1); } },
+  { "SpinnerDotsStaggerTurn", 1.0, [] (const char *l) { ImSpinner::SpinnerDotsStaggerTurn(l, 16.f, 4.f); } },
+  { "SpinnerDotsPinch",       3.0, [] (const char *l) { ImSpinner::SpinnerDotsPinch(l, 16.f, 4.f); } },
+  { "SpinnerMorphShape",      2.0, [] (const char *l) { ImSpinner::SpinnerMorphShape(l, 16.f, 2.f); } },
+  { "SpinnerOrbitMoon",       6.0, [] (const char *l) { ImSpinner::SpinnerOrbitMoon(l, 16.f, 2.f); } },
+  // Bar heights read the angle through ImSin(a * 0.8f); the dots turn in whole PI / dots steps.
+  { "SpinnerFadeBars",        Period(ImSpinner::PI_2 / 0.8f, 2.8f), [] (const char *l) { ImSpinner::SpinnerFadeBars(l, 4.f); } },
+  { "SpinnerBarsScaleMiddle", Period(ImSpinner::PI_2 / 0.8f, 2.8f), [] (const char *l) { ImSpinner::SpinnerBarsScaleMiddle(l, 4.f); } },
+  { "SpinnerIncDots",         Period(ImSpinner::PI_2, 2.8f), [] (const char *l) { ImSpinner::SpinnerIncDots(l, 16.f, 2.f, ImSpinner::white, 2.8f, 12); }, true },
+  { "SpinnerIncFullDots",     Period(ImSpinner::PI_2, 2.8f), [] (const char *l) { ImSpinner::SpinnerIncFullDots(l, 16.f, 2.f, ImSpinner::white, 2.8f, 12); }, true },
+  { "SpinnerSomeScaleDots",   Period(ImSpinner::PI_2 * 20.f, 2.8f), [] (const char *l) { ImSpinner::SpinnerSomeScaleDots(l, 16.f, 2.f, ImSpinner::white, 2.8f, 12, 1); }, true },
+};
+
+// Vertex positions one spinner call appends at spinner clock 'time'.
+static void Capture(const Case &c, double time, ImVector<ImVec2> &out)
+{
+  headless::BeginFrame(time);
+  ImDrawList *draw_list = ImGui::GetWindowDrawList();
+  const int begin = draw_list->VtxBuffer.Size;
+  ImGui::SetCursorPos(ImVec2(8, 8));
+  c.draw(c.name);
+  out.resize(0);
+  for (int i = begin; i < draw_list->VtxBuffer.Size; i++)
+    out.push_back(draw_list->VtxBuffer[i].pos);
+  headless::EndFrame();
+}
+
+// Largest vertex movement between two captures, FLT_MAX when the geometry changed shape.
+static float Moved(const ImVector<ImVec2> &a, const ImVector<ImVec2> &b)
+{
+  if (a.Size != b.Size)
+    return FLT_MAX;
+  float moved = 0.f;
+  for (int i = 0; i < a.Size; i++)
+    moved = ImMax(moved, ImMax(ImFabs(b[i].x - a[i].x), ImFabs(b[i].y - a[i].y)));
+  return moved;
+}
+
+int main()
+{
+  headless::Context context;
+
+  const double angle_wrap = ImSpinner::detail::kAngleWrap, h = 0.0005;
+  int failures = 0;
+  ImVector<ImVec2> before, after;
+  for (const Case &c : cases) {
+    // A stepped spinner may take a step right at the wrap; it is held to the first-cycle check below.
+    if (!c.stepped) {
+      Capture(c, angle_wrap - h, before);
+      Capture(c, angle_wrap + h, after);
+      const float jump = Moved(before, after);
+      if (jump > 1.f) {
+        printf("FAIL: %s jumps across t = %.4f: %d -> %d vertices, moved %g px\n", c.name, angle_wrap, before.Size, after.Size, jump);
+        failures++;
+      }
+    }
+
+    const double wraps[] = { angle_wrap, std::floor(angle_wrap / c.period) * c.period };
+    for (double wrap : wraps)
+      for (double time : { wrap - h, wrap + h }) {
+        const double first = time - std::floor(time / c.period) * c.period;
+        Capture(c, first, before);
+        Capture(c, time, after);
+        const float moved = Moved(before, after);
+        if (moved > 0.05f) {
+          printf("FAIL: %s at t = %.4f differs from the same phase at t = %.4f: %d -> %d vertices, moved %g px\n", c.name, time, first, before.Size, after.Size, moved);
+          failures++;
+        }
+      }
+
+    const double offset = 0.37, later = std::floor(3.0 * angle_wrap / c.period) * c.period;
+    Capture(c, offset, before);
+    Capture(c, later + offset, after);
+    const float drift = Moved(before, after);
+    if (drift > 0.05f) {
+      printf("FAIL: %s at t = %.4f differs from t = %.2f: %d -> %d vertices, moved %g px\n", c.name, later + offset, offset, before.Size, after.Size, drift);
+      failures++;
+    }
+  }
+
+  // The phase itself, for the periods above and speeds that don't divide the angle wrap.
+  const double periods[] = { 1.0, 1.5, 2.0, 3.0, 4.0, 6.0 };
+  const float speeds[] = { 0.7f, 1.f, 2.8f };
+  for (double period : periods)
+    for (float speed : speeds) {
+      const double wrap = angle_wrap / speed;
+      float phase[2];
+      for (int k = 0; k < 2; k++) {
+        ImSpinner::detail::ClockScope clock(wrap + (k ? h : -h));
+        phase[k] = ImSpinner::detail::AnimTime(speed, period);
+      }
+      float step = phase[1] - phase[0];
+      if (step < 0.f)
+        step += (float)period;  // the phase may legitimately wrap its own period here
+      if (std::fabs(step - 2.0 * h * speed) > 1e-3) {
+        printf("FAIL: AnimTime(%g, %g) steps by %g across t = %.4f\n", speed, period, step, wrap);
+        failures++;
+      }
+    }
+
+  printf("%s\n", failures ? "phases jump at a wrap" : "no phase jumps at the wraps");
+  return failures ? 1 : 0;
+}
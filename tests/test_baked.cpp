@@ -0,0 +1,154 @@
+// A baked sheet drawn with AddImage must look like the spinner drawn live. The sheet is rasterized over a
+// transparent image and blended back with straight alpha, so every pixel - anti-aliased fringes and
+// translucent parts included - is compared against the live geometry rasterized straight onto the same
+// background. AddImage at 1:1 with nearest sampling is modelled as one straight-alpha "over" per pixel.
+
+#include "headless.h"
+#include "imspinner_baked.h"
+
+#include <cstdlib>
+
+using namespace ImSpinner;
+
+static const ImU32 background = IM_COL32(40, 90, 160, 255);
+
+// Straight-alpha "over", the stock backends' blend for AddImage.
+static ImU32 Over(ImU32 src, ImU32 dst)
+{
+  const float k = (float)((src >> IM_COL32_A_SHIFT) & 0xFF) / 255.f;
+  auto mix = [&] (int shift) { return (ImU32)(((src >> shift) & 0xFF) * k + ((dst >> shift) & 0xFF) * (1.f - k) + 0.5f) << shift; };
+  const ImU32 a = (ImU32)ImMin(255.f, ((src >> IM_COL32_A_SHIFT) & 0xFF) + ((dst >> IM_COL32_A_SHIFT) & 0xFF) * (1.f - k) + 0.5f);
+  return mix(IM_COL32_R_SHIFT) | mix(IM_COL32_G_SHIFT) | mix(IM_COL32_B_SHIFT) | (a << IM_COL32_A_SHIFT);
+}
+
+// Largest channel difference between the live image and cell (x0, y0) of sheet blended over the background.
+static int Compare(const RasterImage &live, const RasterImage &sheet, int x0, int y0, int &edge_pixels)
+{
+  int worst = 0;
+  edge_pixels = 0;
+  for (int y = 0; y < live.height; y++)
+    for (int x = 0; x < live.width; x++) {
+      const ImU32 src = sheet.pixels[(size_t)(y0 + y) * sheet.width + x0 + x];
+      const ImU32 a = live.pixels[(size_t)y * live.width + x], b = Over(src, background);
+      const ImU32 alpha = (src >> IM_COL32_A_SHIFT) & 0xFF;
+      edge_pixels += alpha > 0 && alpha < 255;
+      for (int shift = 0; shift < 32; shift += 8)
+        worst = ImMax(worst, ImAbs((int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF)));
+    }
+  return worst;
+}
+
+// Hand-made anti-aliased shapes as Dear ImGui emits them: an opaque or translucent core and a 1 px fringe
+// fading to alpha 0, overlapping in different colours.
+static void AddFringedQuad(ImDrawList &draw_list, const ImVec2 &a, const ImVec2 &b, ImU32 col)
+{
+  const ImU32 clear = col & ~IM_COL32_A_MASK;
+  const ImVec2 uv(0, 0);
+  const ImVec2 inner[4] = { a, ImVec2(b.x, a.y), b, ImVec2(a.x, b.y) };
+  const ImVec2 outer[4] = { ImVec2(a.x - 1, a.y - 1), ImVec2(b.x + 1, a.y - 1), ImVec2(b.x + 1, b.y + 1), ImVec2(a.x - 1, b.y + 1) };
+  ImDrawCmd cmd{};
+  cmd.ClipRect = ImVec4(0, 0, 4096, 4096);
+  cmd.VtxOffset = (unsigned int)draw_list.VtxBuffer.Size;
+  cmd.IdxOffset = (unsigned int)draw_list.IdxBuffer.Size;
+  for (int i = 0; i < 4; i++) draw_list.VtxBuffer.push_back({ inner[i], uv, col });
+  for (int i = 0; i < 4; i++) draw_list.VtxBuffer.push_back({ outer[i], uv, clear });
+  const ImDrawIdx idx[] = { 0, 1, 2, 0, 2, 3,  0, 4, 5, 0, 5, 1,  1, 5, 6, 1, 6, 2,  2, 6, 7, 2, 7, 3,  3, 7, 4, 3, 4, 0 };
+  for (ImDrawIdx i : idx) draw_list.IdxBuffer.push_back(i);
+  cmd.ElemCount = IM_ARRAYSIZE(idx);
+  draw_list.CmdBuffer.push_back(cmd);
+}
+
+// The spinner drawn live at clock time at screen position pos, rasterized onto the background.
+template<typename F>
+static void DrawLive(RasterImage &image, const F &draw, const char *label, double time, const ImVec2 &pos, int width, int height)
+{
+  ImGuiWindow *window = ImGui::GetCurrentWindow();
+  ImDrawList *window_draw_list = window->DrawList;
+  ImDrawList live(ImGui::GetDrawListSharedData());
+  live._ResetForNewFrame();
+  live.PushClipRectFullScreen();
+#if IMGUI_VERSION_NUM < 19197
+  live.PushTextureID(ImGui::GetIO().Fonts->TexID);
+#else
+  live.PushTexture(ImGui::GetIO().Fonts->TexRef);
+#endif
+  window->DrawList = &live;
+  ImGui::SetCursorScreenPos(pos);
+  {
+    detail::ClockScope clock(time);
+    draw(label);
+  }
+  window->DrawList = window_draw_list;
+
+  image.Resize(width, height);
+  image.Clear(background);
+  RasterizeDrawList(image, &live, GetFontRasterTexture(), pos);
+}
+
+int main()
+{
+  int failures = 0;
+
+  // The compositing itself, without Dear ImGui: fringed, overlapping and translucent quads.
+  {
+    ImDrawList draw_list(nullptr);
+    AddFringedQuad(draw_list, ImVec2(4.3f, 5.6f), ImVec2(20.7f, 14.2f), IM_COL32(255, 230, 40, 255));
+    AddFringedQuad(draw_list, ImVec2(10.5f, 9.5f), ImVec2(27.2f, 26.8f), IM_COL32(250, 60, 60, 140));
+    AddFringedQuad(draw_list, ImVec2(2.2f, 18.1f), ImVec2(14.9f, 29.4f), IM_COL32(255, 255, 255, 40));
+
+    RasterImage live, sheet;
+    live.Resize(32, 32);
+    live.Clear(background);
+    RasterizeDrawList(live, &draw_list, RasterTexture());
+    sheet.Resize(32, 32);
+    RasterizeDrawList(sheet, &draw_list, RasterTexture());
+
+    int edges;
+    const int premultiplied = Compare(live, sheet, 0, 0, edges);
+    UnpremultiplyAlpha(sheet);
+    const int straight = Compare(live, sheet, 0, 0, edges);
+    printf("fringed quads: %d partly transparent pixels, off by up to %d (%d left premultiplied)\n", edges, straight, premultiplied);
+    if (straight > 2) {
+      printf("FAIL: straight-alpha sheet differs from the live image by %d\n", straight);
+      failures++;
+    }
+  }
+
+  // Whole spinners, baked through detail::BakeSheet and drawn live at the same phases.
+  headless::Context context;
+  headless::BeginFrame(0.0);
+  struct Case { const char *name; float radius; float period; void (*draw)(const char *); };
+  const Case cases[] = {
+    { "SpinnerAng",      16.f, PI_2 / 2.8f, [] (const char *l) { SpinnerAng(l, 16.f, 2.f, white, half_white, 2.8f); } },
+    { "SpinnerFadeDots", 16.f, 4.f,         [] (const char *l) { SpinnerFadeDots(l, 16.f, 3.f, ImColor(255, 160, 40), 1.f); } },
+    { "SpinnerFadeTris", 20.f, PI_2 / 2.8f, [] (const char *l) { SpinnerFadeTris(l, 20.f, ImColor(120, 255, 160)); } },
+  };
+  const ImVec2 pos(8, 8);
+  const int frames = 6;
+  for (const Case &c : cases) {
+    const ImVec2 cell_size(c.radius * 2, (c.radius + ImGui::GetStyle().FramePadding.y) * 2);
+    const int cell_w = (int)ImCeil(cell_size.x), cell_h = (int)ImCeil(cell_size.y);
+    RasterImage sheet, live;
+    ImGui::SetCursorScreenPos(pos);
+    ImGui::PushID(c.name);
+    detail::BakeSheet(sheet, "baked", cell_size, ImVec2(1, 1), frames, frames, c.period, c.draw);
+    int worst = 0, edges = 0;
+    for (int k = 0; k < frames; k++) {
+      ImGui::PushID(k);
+      DrawLive(live, c.draw, "live", (double)c.period * k / frames, pos, cell_w, cell_h);
+      ImGui::PopID();
+      int e;
+      worst = ImMax(worst, Compare(live, sheet, k * cell_w, 0, e));
+      edges += e;
+    }
+    ImGui::PopID();
+    printf("%s: %d frames, %d partly transparent pixels, off by up to %d\n", c.name, frames, edges, worst);
+    if (worst > 2) {
+      printf("FAIL: baked %s differs from the live spinner by %d\n", c.name, worst);
+      failures++;
+    }
+  }
+  headless::EndFrame();
+
+  return failures ? 1 : 0;
+}
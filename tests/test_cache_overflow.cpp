@@ -0,0 +1,77 @@
+// The bounded caches behind UnitCircle, the SpinnerFadeTris mesh and the text layout drop all entries when they
+// fill up. Inputs that change every frame (animated radii, counters in a text) overflow them over and over; after
+// a few rounds the rebuilds must refill buffers the cache already has instead of allocating, and every lookup
+// must still return the data for its own inputs.
+
+#include "headless.h"
+#include "alloc_counter.h"
+
+#include <cmath>
+
+int main()
+{
+  headless::Context context;
+  headless::BeginFrame(0.0);
+  int failures = 0;
+
+  // Each round asks for more distinct keys than the cache holds, so every round rebuilds every entry. The keys
+  // of one cache need buffers of one size, as an animated radius or a fixed-width counter does.
+  auto check = [&] (const char *what, int keys, const auto &lookup) {
+    long allocations = 0;
+    for (int round = 0; round < 16; round++) {
+      if (round >= 12)
+        alloc_counter::Begin();
+      for (int k = 0; k < keys; k++)
+        failures += !lookup(k);
+      if (round >= 12)
+        allocations += alloc_counter::End();
+    }
+    printf("%s: %d keys per round, %ld allocations in the last 4 of 16 rounds\n", what, keys, allocations);
+    if (allocations) {
+      printf("FAIL: %s rebuilds allocate\n", what);
+      failures++;
+    }
+  };
+
+  check("UnitCircle", 300, [] (int k) {
+    const int count = 64;
+    const float step = 6.2831853f / (float)(count + k);
+    const ImVec2 *unit = ImSpinner::detail::UnitCircle(count, step);
+    for (int i = 0; i < count; i += 7)
+      if (std::fabs(unit[i].x - ImCos(i * step)) > 1e-6f || std::fabs(unit[i].y - ImSin(i * step)) > 1e-6f) {
+        printf("FAIL: UnitCircle(%d, %g) point %d\n", count, step, i);
+        return false;
+      }
+    return true;
+  });
+
+  check("FadeTris mesh", 80, [] (int k) {
+    const float radius = 8.f + k * 0.25f;
+    const size_t dim = 2;
+    const ImSpinner::detail::FadeTrisMesh &mesh = ImSpinner::detail::GetFadeTrisMesh(radius, dim);
+    const size_t tris = (size_t)1 << (2 * dim);
+    if (mesh.points.size() != tris * 3 || mesh.angles.size() != tris || std::fabs(mesh.points[0].y - radius) > 1e-4f) {
+      printf("FAIL: FadeTris mesh (%g, %d): %d points, %d angles\n", radius, (int)dim, (int)mesh.points.size(), (int)mesh.angles.size());
+      return false;
+    }
+    return true;
+  });
+
+  ImFont *font = ImGui::GetFont();
+  const float base_size = ImGui::GetFontSize();
+  check("TextLayout", 600, [&] (int k) {
+    char text[32];
+    snprintf(text, sizeof(text), "Downloading %03d%%", k);
+    const ImSpinner::detail::TextLayout &layout = ImSpinner::detail::GetTextLayout(font, base_size, text, 96.f);
+    const int len = (int)strlen(text);
+    if ((int)layout.text.size() != len || memcmp(layout.text.data(), text, len) != 0
+        || std::fabs(layout.size.x - font->CalcTextSizeA(layout.font_size, FLT_MAX, 0.f, text).x) > 1e-3f) {
+      printf("FAIL: TextLayout of \"%s\" holds other text or metrics\n", text);
+      return false;
+    }
+    return true;
+  });
+
+  headless::EndFrame();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,68 @@
+// damped_gravity: golden values against the original 0.01 step simulation loop, and a check that the table
+// lookup costs the same at any input time while the loop grew with it.
+
+#include "headless.h"
+
+#include <cmath>
+
+// The loop damped_gravity() replaced, verbatim.
+static float damped_gravity_loop(float limtime) {
+  float time = 0.0f, initialHeight = 10.f, height = initialHeight, velocity = 0.f, prtime = 0.0f;
+  (void)velocity;
+
+  while (height >= 0.0) {
+    if (prtime >= limtime) { return height / 10.f; }
+    time += 0.01f; prtime += 0.01f;
+    height = initialHeight - 0.5f * 9.81f * time * time;
+    if (height < 0.0) { initialHeight = 0.0; time = 0.0; }
+  }
+  return 0.f;
+}
+
+int main()
+{
+  int failures = 0;
+  auto check = [&] (float t) {
+    const float expected = damped_gravity_loop(t), got = ImSpinner::damped_gravity(t);
+    if (!(std::fabs(got - expected) <= 1e-6f)) {
+      if (failures < 10)
+        printf("FAIL: damped_gravity(%.9g) = %.9g, loop gives %.9g\n", t, got, expected);
+      failures++;
+    }
+  };
+
+  // A dense sweep, the step times themselves (accumulated the way the loop does and as k * 0.01f),
+  // the neighbouring floats of each, and the edges.
+  for (float t = -0.5f; t < 2.f; t += 0.00037f)
+    check(t);
+  float acc = 0.f;
+  for (int k = 0; k < 160; k++, acc += 0.01f) {
+    const float steps[] = { acc, k * 0.01f };
+    for (float s : steps) {
+      check(s);
+      check(std::nextafter(s, -1.f));
+      check(std::nextafter(s, 2.f));
+    }
+  }
+  const float edges[] = { 0.f, -0.f, -1e30f, 1e30f, INFINITY, -INFINITY, NAN };
+  for (float t : edges)
+    check(t);
+  printf("golden: %s\n", failures ? "mismatches" : "all inputs match the loop");
+
+  // Cost at the start and at the end of the fall (~1.43 s, where the loop ran ~143 iterations).
+  volatile float sink = 0.f;
+  const int iterations = 1000000;
+  const double table_near = headless::TimePerCall(iterations, [&] (int i) { sink = sink + ImSpinner::damped_gravity(0.02f + (i & 7) * 1e-4f); });
+  const double table_far = headless::TimePerCall(iterations, [&] (int i) { sink = sink + ImSpinner::damped_gravity(1.40f + (i & 7) * 1e-4f); });
+  const double loop_near = headless::TimePerCall(iterations / 10, [&] (int i) { sink = sink + damped_gravity_loop(0.02f + (i & 7) * 1e-4f); });
+  const double loop_far = headless::TimePerCall(iterations / 10, [&] (int i) { sink = sink + damped_gravity_loop(1.40f + (i & 7) * 1e-4f); });
+  printf("t = 0.02: table %.2f ns, loop %.2f ns\n", table_near, loop_near);
+  printf("t = 1.40: table %.2f ns, loop %.2f ns\n", table_far, loop_far);
+
+  // Generous bound for noisy machines; the loop is ~70x slower at the far end.
+  if (table_far > table_near * 4.0 + 5.0) {
+    printf("FAIL: damped_gravity cost grows with the input time\n");
+    failures++;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+// Disc sprites against the geometry they replace: with IMSPINNER_ENABLE_DISC_SPRITES and SetupDiscSprites(), a
+// batch of discs must come out as one 4-vertex quad per disc in the current draw command and rasterize like the
+// anti-aliased polygons AddDiscsBatch draws without them. Discs larger than the biggest sprite keep the polygons.
+// Builds against both font atlas APIs (custom rects before 1.92, ImFontAtlasRect from 1.92 on).
+
+#ifndef IMSPINNER_ENABLE_DISC_SPRITES
+#define IMSPINNER_ENABLE_DISC_SPRITES
+#endif
+
+#include "headless.h"
+#include "imspinner_raster.h"
+
+using namespace ImSpinner;
+
+struct Discs {
+  ImVector<ImVec2> centres;
+  ImVector<float> radii;
+  ImVector<ImU32> cols;
+
+  // Discs of the given radii in a row, far enough apart not to overlap.
+  explicit Discs(std::initializer_list<float> rs) {
+    float x = 2.f;
+    for (float r : rs) {
+      x += r + 2.f;
+      centres.push_back(ImVec2(x, 40.f));
+      radii.push_back(r);
+      cols.push_back(IM_COL32(255, 255, 255, 255));
+      x += r + 2.f;
+    }
+  }
+};
+
+// What AddDiscsBatch appended to a fresh draw list with the font texture bound, and that list rasterized.
+struct Drawn {
+  int vtx = 0, cmd = 0;
+  RasterImage image;
+};
+
+static Drawn Draw(const Discs &discs, bool sprites)
+{
+  detail::DiscSprites &state = detail::GetDiscSprites();
+  ImFontAtlas *atlas = state.atlas;
+  if (!sprites)
+    state.atlas = nullptr;
+
+  ImDrawList draw_list(ImGui::GetDrawListSharedData());
+  draw_list._ResetForNewFrame();
+  draw_list.PushClipRectFullScreen();
+#if IMGUI_VERSION_NUM < 19197
+  draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+#else
+  draw_list.PushTexture(ImGui::GetIO().Fonts->TexRef);
+#endif
+  const int cmd_begin = draw_list.CmdBuffer.Size;
+  detail::AddDiscsBatch(&draw_list, discs.centres.Data, discs.radii.Data, discs.cols.Data, discs.centres.Size, 0);
+  state.atlas = atlas;
+
+  Drawn d;
+  d.vtx = draw_list.VtxBuffer.Size;
+  d.cmd = draw_list.CmdBuffer.Size - cmd_begin;
+  d.image.Resize(400, 100);
+  d.image.Clear(IM_COL32(0, 0, 0, 255));
+  RasterizeDrawList(d.image, &draw_list, GetFontRasterTexture());
+  return d;
+}
+
+// Largest red-channel difference and the ratio of total coverage between two white-on-black images.
+static int Compare(const RasterImage &a, const RasterImage &b, double &coverage_ratio)
+{
+  int worst = 0;
+  double sum_a = 0.0, sum_b = 0.0;
+  for (size_t i = 0; i < a.pixels.size(); i++) {
+    const int ra = (int)((a.pixels[i] >> IM_COL32_R_SHIFT) & 0xFF), rb = (int)((b.pixels[i] >> IM_COL32_R_SHIFT) & 0xFF);
+    worst = ImMax(worst, ImAbs(ra - rb));
+    sum_a += ra;
+    sum_b += rb;
+  }
+  coverage_ratio = sum_b > 0.0 ? sum_a / sum_b : 0.0;
+  return worst;
+}
+
+int main()
+{
+  headless::Context context;
+  int failures = 0;
+
+  if (!SetupDiscSprites(ImGui::GetIO().Fonts)) {
+    printf("FAIL: SetupDiscSprites could not add the sprites to the font atlas\n");
+    return 1;
+  }
+
+  headless::BeginFrame(0.0);
+
+  // Radii of the sprites themselves, sampled 1:1, and radii in between, sampled from the next larger sprite.
+  struct Case { const char *name; Discs discs; int max_diff; double max_coverage_error; };
+  const Case cases[] = {
+    { "sprite radii", Discs{ 4.f, 8.f, 16.f, 32.f }, 96, 0.03 },
+    { "between",      Discs{ 3.f, 6.f, 12.f, 24.f }, 255, 0.10 },
+  };
+  for (const Case &c : cases) {
+    const Drawn sprite = Draw(c.discs, true), geometry = Draw(c.discs, false);
+    double ratio;
+    const int worst = Compare(sprite.image, geometry.image, ratio);
+    printf("%s: %d vertices as sprites, %d as geometry, coverage %.3f of the geometry, off by up to %d\n",
+           c.name, sprite.vtx, geometry.vtx, ratio, worst);
+    if (sprite.vtx != 4 * c.discs.centres.Size || sprite.cmd != 0) {
+      printf("FAIL: %s not drawn as one quad per disc in the current draw command\n", c.name);
+      failures++;
+    }
+    if (worst > c.max_diff || ImAbs(ratio - 1.0) > c.max_coverage_error) {
+      printf("FAIL: %s as sprites do not look like the geometry\n", c.name);
+      failures++;
+    }
+  }
+
+  // Larger than the biggest sprite: the whole batch stays geometry.
+  {
+    const Discs discs{ 8.f, 40.f };
+    const Drawn sprite = Draw(discs, true), geometry = Draw(discs, false);
+    printf("oversized: %d vertices with sprites set up, %d without\n", sprite.vtx, geometry.vtx);
+    if (sprite.vtx != geometry.vtx) {
+      printf("FAIL: a batch with a disc larger than the biggest sprite was not drawn as geometry\n");
+      failures++;
+    }
+  }
+
+  // A dot spinner drawn in the window goes through the same batch: 3 dots, 3 quads.
+  {
+    ImDrawList *draw_list = ImGui::GetWindowDrawList();
+    const int vtx_begin = draw_list->VtxBuffer.Size;
+    ImGui::SetCursorScreenPos(ImVec2(8, 8));
+    SpinnerBounceDots("##dots", 16.f, 6.f, white, 6.f, 3);
+    const int vtx = draw_list->VtxBuffer.Size - vtx_begin;
+    printf("SpinnerBounceDots: %d vertices\n", vtx);
+    if (vtx != 3 * 4) {
+      printf("FAIL: SpinnerBounceDots does not draw its dots as sprites\n");
+      failures++;
+    }
+  }
+
+  headless::EndFrame();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+// Instanced spinners against the prototype they copy: an instance appends exactly the prototype's vertices moved
+// by the difference of their positions, with indices rebased onto its own first vertex. A prototype whose drawing
+// opens a new draw command (here the 64k vertex split) cannot be captured; it stays drawn live and the next
+// instance becomes the prototype.
+
+#include "headless.h"
+
+#include <cmath>
+
+using namespace ImSpinner;
+
+// What one call appended to draw_list: vertex range and indices relative to its first vertex.
+struct Appended {
+  int vtx_start = 0, vtx_count = 0, cmd_count = 0;
+  std::vector<ImDrawIdx> idx;
+};
+
+template<typename F>
+static Appended Append(ImDrawList *draw_list, const F &draw)
+{
+  const detail::DrawSliceMark mark = detail::MarkDrawSlice(draw_list);
+  draw();
+  Appended a;
+  a.vtx_start = mark.vtx_start;
+  a.vtx_count = draw_list->VtxBuffer.Size - mark.vtx_start;
+  a.cmd_count = draw_list->CmdBuffer.Size - mark.cmd_count;
+  for (int i = mark.idx_start; i < draw_list->IdxBuffer.Size; i++)
+    a.idx.push_back((ImDrawIdx)(draw_list->IdxBuffer[i] - mark.vtx_base));
+  return a;
+}
+
+// Whether b holds a's vertices moved by offset, to within tolerance, in the same order and colours.
+static bool Moved(const ImDrawList *draw_list, const Appended &a, const Appended &b, const ImVec2 &offset, float tolerance)
+{
+  if (a.vtx_count != b.vtx_count)
+    return false;
+  for (int i = 0; i < a.vtx_count; i++) {
+    const ImDrawVert &u = draw_list->VtxBuffer[a.vtx_start + i], &v = draw_list->VtxBuffer[b.vtx_start + i];
+    if (std::fabs(u.pos.x + offset.x - v.pos.x) > tolerance || std::fabs(u.pos.y + offset.y - v.pos.y) > tolerance
+        || u.uv.x != v.uv.x || u.uv.y != v.uv.y || u.col != v.col)
+      return false;
+  }
+  return true;
+}
+
+int main()
+{
+  headless::Context context;
+  int failures = 0;
+  const ImVec2 p0(8, 8), p1(260.5f, 96.25f), p2(40, 300);
+
+  // A prototype and one instance: same vertices moved by p1 - p0, same triangles on rebased indices.
+  headless::BeginFrame(1.25);
+  {
+    ImDrawList *draw_list = ImGui::GetWindowDrawList();
+    BeginInstanced<e_st_ang>(Radius{16.f}, Thickness{2.f}, Speed{2.8f}, Angle{IM_PI * 0.75f});
+    ImGui::SetCursorScreenPos(p0);
+    const Appended proto = Append(draw_list, [] { Instance("##proto"); });
+    ImGui::SetCursorScreenPos(p1);
+    const Appended inst = Append(draw_list, [] { Instance("##inst"); });
+    const int prototypes = detail::GetInstancedState().count;
+    EndInstanced();
+
+    const ImVec2 offset(p1.x - p0.x, p1.y - p0.y);
+    printf("instance: %d vertices, %d indices, %d prototype(s)\n", inst.vtx_count, (int)inst.idx.size(), prototypes);
+    if (proto.vtx_count == 0 || prototypes != 1) {
+      printf("FAIL: the first instance was not captured as the prototype\n");
+      failures++;
+    }
+    if (!Moved(draw_list, proto, inst, offset, 0.f)) {
+      printf("FAIL: the instance's vertices are not the prototype's moved by (%g, %g)\n", offset.x, offset.y);
+      failures++;
+    }
+    if (inst.idx != proto.idx || inst.cmd_count != 0) {
+      printf("FAIL: the instance's indices are not the prototype's rebased onto its own vertices\n");
+      failures++;
+    }
+  }
+  headless::EndFrame();
+
+  // Fill the draw list up to the 64k vertex split, so the prototype's drawing opens a new draw command.
+  if (sizeof(ImDrawIdx) == 2) {
+    headless::BeginFrame(2.5);
+    ImDrawList *draw_list = ImGui::GetWindowDrawList();
+    while (draw_list->_VtxCurrentIdx < (1 << 16) - 8)
+      draw_list->AddRectFilled(ImVec2(0, 0), ImVec2(1, 1), IM_COL32(0, 0, 0, 1));
+
+    BeginInstanced<e_st_ang>(Radius{16.f}, Thickness{2.f}, Speed{2.8f}, Angle{IM_PI * 0.75f});
+    ImGui::SetCursorScreenPos(p0);
+    const Appended live = Append(draw_list, [] { Instance("##split"); });
+    const int after_split = detail::GetInstancedState().count;
+    ImGui::SetCursorScreenPos(p2);
+    const Appended proto = Append(draw_list, [] { Instance("##proto"); });
+    const int after_proto = detail::GetInstancedState().count;
+    EndInstanced();
+
+    printf("split: %d vertices drawn live over %d new command(s), then %d prototype(s)\n", live.vtx_count, live.cmd_count, after_proto);
+    if (live.cmd_count == 0 || live.vtx_count == 0 || after_split != 0) {
+      printf("FAIL: an instance that opened a draw command was captured or not drawn\n");
+      failures++;
+    }
+    if (after_proto != 1 || !Moved(draw_list, live, proto, ImVec2(p2.x - p0.x, p2.y - p0.y), 1e-3f)) {
+      printf("FAIL: after a failed capture the next instance is not drawn and captured as the prototype\n");
+      failures++;
+    }
+    headless::EndFrame();
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+// Step deadlines must line up with the steps the spinners actually take, also long after their phase has
+// wrapped: NextStepTime directly, and GetNextRedrawTime() for two steps() spinners. Before the deadline the
+// spinner draws the same step, just after it the next one.
+
+#include "headless.h"
+
+#include <cmath>
+
+using namespace ImSpinner;
+
+using DrawFn = void (*)(const char *label);
+struct Case { const char *name; DrawFn draw; };
+
+static const Case cases[] = {
+  { "SpinnerTextTyping", [] (const char *l) { SpinnerTextTyping(l, 32.f, white, 1.3f); } },
+  { "SpinnerBlocks",     [] (const char *l) { SpinnerBlocks(l, 16.f, 4.f, ImColor(255, 255, 255, 60), white, 2.7f); } },
+};
+
+// Draws one frame at spinner clock 'time' and returns the vertices the spinner appended.
+static void Capture(const Case &c, double time, ImVector<ImDrawVert> &out, double *next_redraw = nullptr)
+{
+  headless::BeginFrame(time);
+  ImDrawList *draw_list = ImGui::GetWindowDrawList();
+  const int begin = draw_list->VtxBuffer.Size;
+  ImGui::SetCursorPos(ImVec2(8, 8));
+  c.draw(c.name);
+  out.resize(draw_list->VtxBuffer.Size - begin);
+  if (out.Size)
+    memcpy(out.Data, draw_list->VtxBuffer.Data + begin, (size_t)out.Size * sizeof(ImDrawVert));
+  if (next_redraw)
+    *next_redraw = GetNextRedrawTime();
+  headless::EndFrame();
+}
+
+static bool Same(const ImVector<ImDrawVert> &a, const ImVector<ImDrawVert> &b)
+{
+  return a.Size == b.Size && (a.Size == 0 || memcmp(a.Data, b.Data, (size_t)a.Size * sizeof(ImDrawVert)) == 0);
+}
+
+int main()
+{
+  headless::Context context;
+  int failures = 0;
+
+  // NextStepTime against the step index the spinner reads, for a 9 step cycle, well past many wraps.
+  const float speeds[] = { 1.f, 1.3f, 2.7f };
+  for (float speed : speeds)
+    for (double t = 16000.0; t < 16400.0; t += 0.37) {
+      double deadline;
+      int step, before, after;
+      { detail::ClockScope clock(t); deadline = detail::NextStepTime(speed, 9.f); step = (int)detail::AnimTime(speed, 9.f); }
+      { detail::ClockScope clock(deadline - 1e-4); before = (int)detail::AnimTime(speed, 9.f); }
+      { detail::ClockScope clock(deadline + 1e-4); after = (int)detail::AnimTime(speed, 9.f); }
+      if (deadline <= t || before != step || after == step) {
+        if (failures < 10)
+          printf("FAIL: speed %g, t = %.2f: deadline %.6f, step %d, %d before, %d after\n", speed, t, deadline, step, before, after);
+        failures++;
+      }
+    }
+
+  // Through whole spinners and the per-frame deadline, past the angle wrap.
+  ImVector<ImDrawVert> now, before, after;
+  for (const Case &c : cases)
+    for (double t = 3.0 * detail::kAngleWrap + 0.123; t < 3.0 * detail::kAngleWrap + 5.0; t += 0.61) {
+      double deadline = DBL_MAX;
+      Capture(c, t, now, &deadline);
+      if (!(deadline > t && deadline < t + 10.0)) {
+        printf("FAIL: %s at t = %.3f reports next redraw at %.6f\n", c.name, t, deadline);
+        failures++;
+        continue;
+      }
+      Capture(c, deadline - 1e-4, before);
+      Capture(c, deadline + 1e-4, after);
+      if (!Same(now, before) || Same(now, after)) {
+        printf("FAIL: %s at t = %.3f: deadline %.6f %s\n", c.name, t, deadline,
+               !Same(now, before) ? "comes after a step change" : "passes with no step change");
+        failures++;
+      }
+    }
+
+  printf("%s\n", failures ? "deadlines miss step changes" : "deadlines match the step changes");
+  return failures ? 1 : 0;
+}
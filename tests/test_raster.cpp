@@ -0,0 +1,167 @@
+// imspinner_raster.h against hand-computed images: coverage of a known triangle (pixel centres, top-left fill
+// rule), a quad whose two triangles share an edge, clipping, straight-alpha blending and a textured quad
+// sampled nearest-texel. Then the same random frame on one and several threads, the allocations of a repeated
+// draw into one image, and the time per frame.
+
+#include "headless.h"
+#include "imspinner_raster.h"
+#include "alloc_counter.h"
+
+#include <cstdlib>
+
+// Appends one draw command of triangles (3 vertices each) to draw_list, clipped to clip.
+static void AddTris(ImDrawList &draw_list, const ImDrawVert *vtx, int count, const ImVec4 &clip)
+{
+  ImDrawCmd cmd{};
+  cmd.ClipRect = clip;
+  cmd.VtxOffset = (unsigned int)draw_list.VtxBuffer.Size;
+  cmd.IdxOffset = (unsigned int)draw_list.IdxBuffer.Size;
+  cmd.ElemCount = (unsigned int)count;
+  for (int i = 0; i < count; i++) {
+    draw_list.VtxBuffer.push_back(vtx[i]);
+    draw_list.IdxBuffer.push_back((ImDrawIdx)i);
+  }
+  draw_list.CmdBuffer.push_back(cmd);
+}
+
+static void Reset(ImDrawList &draw_list)
+{
+  draw_list.CmdBuffer.resize(0);
+  draw_list.IdxBuffer.resize(0);
+  draw_list.VtxBuffer.resize(0);
+}
+
+// Compares image against rows of '#' (expected colour 'on') and '.' (untouched, 0).
+static bool Matches(const char *what, const ImSpinner::RasterImage &image, const char *const *rows, ImU32 on)
+{
+  for (int y = 0; y < image.height; y++)
+    for (int x = 0; x < image.width; x++) {
+      const ImU32 expected = rows[y][x] == '#' ? on : 0u, actual = image.pixels[(size_t)y * image.width + x];
+      if (actual != expected) {
+        printf("FAIL: %s: pixel (%d, %d) is %08x, expected %08x\n", what, x, y, actual, expected);
+        return false;
+      }
+    }
+  return true;
+}
+
+int main()
+{
+  ImDrawList draw_list(nullptr);
+  ImSpinner::RasterImage image;
+  const ImSpinner::RasterTexture white;  // no texture: vertex colours only
+  const ImVec4 full(0, 0, 4096, 4096);
+  const ImVec2 uv(0, 0);
+  const ImU32 red = IM_COL32(255, 0, 0, 255);
+  int failures = 0;
+
+  // Right triangle with legs of 8 px: pixel centres with x + y < 7 are inside, the ones exactly on the
+  // hypotenuse (x + y == 7) belong to the right edge and are left out, as a GPU would.
+  const ImDrawVert tri[] = { { ImVec2(0, 0), uv, red }, { ImVec2(8, 0), uv, red }, { ImVec2(0, 8), uv, red } };
+  const char *const tri_rows[] = { "#######.", "######..", "#####...", "####....", "###.....", "##......", "#.......", "........" };
+  image.Resize(8, 8);
+  Reset(draw_list);
+  AddTris(draw_list, tri, 3, full);
+  ImSpinner::RasterizeDrawList(image, &draw_list, white);
+  failures += !Matches("triangle", image, tri_rows, red);
+
+  // The same triangle clipped to its top-left 4 x 3 px.
+  const char *const clip_rows[] = { "####....", "####....", "####....", "........", "........", "........", "........", "........" };
+  image.Resize(8, 8);
+  Reset(draw_list);
+  AddTris(draw_list, tri, 3, ImVec4(0, 0, 4, 3));
+  ImSpinner::RasterizeDrawList(image, &draw_list, white);
+  failures += !Matches("clipped triangle", image, clip_rows, red);
+
+  // Half-transparent quad as two triangles sharing a diagonal: every pixel is blended exactly once, so the
+  // diagonal is no darker than the rest. Straight alpha "over" a transparent target: rgb * a, alpha a.
+  const ImU32 half = IM_COL32(255, 255, 255, 128);
+  const ImDrawVert quad[] = { { ImVec2(1, 1), uv, half }, { ImVec2(7, 1), uv, half }, { ImVec2(7, 7), uv, half },
+                              { ImVec2(1, 1), uv, half }, { ImVec2(7, 7), uv, half }, { ImVec2(1, 7), uv, half } };
+  const char *const quad_rows[] = { "........", ".######.", ".######.", ".######.", ".######.", ".######.", ".######.", "........" };
+  image.Resize(8, 8);
+  Reset(draw_list);
+  AddTris(draw_list, quad, 6, full);
+  ImSpinner::RasterizeDrawList(image, &draw_list, white);
+  failures += !Matches("half-transparent quad", image, quad_rows, IM_COL32(128, 128, 128, 128));
+
+  // Over an opaque black background the colour mixes and the alpha stays opaque.
+  image.Resize(8, 8);
+  image.Clear(IM_COL32(0, 0, 0, 255));
+  ImSpinner::RasterizeDrawList(image, &draw_list, white);
+  const ImU32 mixed = image.pixels[3 * 8 + 3];
+  if (mixed != IM_COL32(128, 128, 128, 255)) {
+    printf("FAIL: half white over opaque black is %08x\n", mixed);
+    failures++;
+  }
+
+  // Textured quad: a 4 x 4 RGBA texture stretched over 8 x 8 px, so every texel covers a 2 x 2 block. The
+  // vertex colour is opaque white, so every pixel is its texel.
+  unsigned char texels[4 * 4 * 4];
+  for (int i = 0; i < 16; i++) {
+    texels[i * 4 + 0] = (unsigned char)(i * 16);
+    texels[i * 4 + 1] = (unsigned char)(255 - i * 16);
+    texels[i * 4 + 2] = (unsigned char)(i & 1 ? 255 : 0);
+    texels[i * 4 + 3] = 255;
+  }
+  ImSpinner::RasterTexture tex;
+  tex.pixels = texels;
+  tex.width = tex.height = 4;
+  const ImU32 tint = IM_COL32(255, 255, 255, 255);
+  const ImDrawVert textured[] = { { ImVec2(0, 0), ImVec2(0, 0), tint }, { ImVec2(8, 0), ImVec2(1, 0), tint }, { ImVec2(8, 8), ImVec2(1, 1), tint },
+                                  { ImVec2(0, 0), ImVec2(0, 0), tint }, { ImVec2(8, 8), ImVec2(1, 1), tint }, { ImVec2(0, 8), ImVec2(0, 1), tint } };
+  image.Resize(8, 8);
+  Reset(draw_list);
+  AddTris(draw_list, textured, 6, full);
+  ImSpinner::RasterizeDrawList(image, &draw_list, tex);
+  for (int y = 0; y < 8; y++)
+    for (int x = 0; x < 8; x++) {
+      const unsigned char *t = texels + ((y / 2) * 4 + x / 2) * 4;
+      const ImU32 expected = IM_COL32(t[0], t[1], t[2], t[3]), actual = image.pixels[y * 8 + x];
+      if (actual != expected) {
+        printf("FAIL: textured quad: pixel (%d, %d) is %08x, expected texel %08x\n", x, y, actual, expected);
+        failures++;
+        x = y = 8;
+      }
+    }
+
+  // A frame of random translucent triangles: several threads draw exactly what one does, and drawing it again
+  // into the same image reuses the triangle and bin buffers.
+  srand(11);
+  Reset(draw_list);
+  ImVector<ImDrawVert> random_tris;
+  for (int i = 0; i < 3000 * 3; i++) {
+    const ImVec2 p((float)(rand() % 1280), (float)(rand() % 720));
+    const ImVec2 q = (i % 3) ? ImVec2(random_tris[i - (i % 3)].pos.x + (float)(rand() % 81 - 40), random_tris[i - (i % 3)].pos.y + (float)(rand() % 81 - 40)) : p;
+    random_tris.push_back({ q, uv, IM_COL32(rand() % 256, rand() % 256, rand() % 256, 64 + rand() % 192) });
+  }
+  for (int i = 0; i < random_tris.Size; i += 300)
+    AddTris(draw_list, random_tris.Data + i, 300, full);
+
+  ImSpinner::RasterImage serial, parallel;
+  serial.Resize(1280, 720);
+  parallel.Resize(1280, 720);
+  ImSpinner::RasterizeDrawList(serial, &draw_list, white, ImVec2(0, 0), ImVec2(1, 1), 1);
+  ImSpinner::RasterizeDrawList(parallel, &draw_list, white, ImVec2(0, 0), ImVec2(1, 1), 4);
+  if (serial.pixels != parallel.pixels) {
+    printf("FAIL: 4 threads draw a different image than 1\n");
+    failures++;
+  }
+
+  alloc_counter::Begin();
+  serial.Clear();
+  ImSpinner::RasterizeDrawList(serial, &draw_list, white, ImVec2(0, 0), ImVec2(1, 1), 1);
+  const long allocations = alloc_counter::End();
+  if (allocations) {
+    printf("FAIL: redrawing into the same image allocated %ld times\n", allocations);
+    failures++;
+  }
+
+  const int threads = (int)std::thread::hardware_concurrency();
+  const double one = headless::TimePerCall(10, [&] (int) { serial.Clear(); ImSpinner::RasterizeDrawList(serial, &draw_list, white, ImVec2(0, 0), ImVec2(1, 1), 1); });
+  const double all = headless::TimePerCall(10, [&] (int) { parallel.Clear(); ImSpinner::RasterizeDrawList(parallel, &draw_list, white, ImVec2(0, 0), ImVec2(1, 1), 0); });
+  printf("1280x720, 3000 triangles: %.2f ms on 1 thread, %.2f ms on %d threads\n", one / 1e6, all / 1e6, threads);
+
+  printf("%s\n", failures ? "rasterizer output differs" : "rasterizer output matches");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+// A throttled spinner replays the geometry of its last update, vertex for vertex, until 1/rate seconds have
+// passed and then regenerates it - the same geometry the spinner draws live at that time. An update whose
+// drawing opened a new draw command (the 64k vertex split) is not kept, so the next frame draws live again.
+
+#include "headless.h"
+
+using namespace ImSpinner;
+
+// What the spinner appended in one frame; it stays at pos, so vertices compare as they are.
+struct Geometry {
+  std::vector<ImDrawVert> vtx;
+  std::vector<ImDrawIdx> idx;
+
+  bool operator==(const Geometry &o) const {
+    return vtx.size() == o.vtx.size() && idx == o.idx && memcmp(vtx.data(), o.vtx.data(), vtx.size() * sizeof(ImDrawVert)) == 0;
+  }
+  bool operator!=(const Geometry &o) const { return !(*this == o); }
+};
+
+static const ImVec2 pos(8, 8);
+
+// One frame at clock time with the spinner at pos, optionally behind filler up to the 64k vertex split.
+static Geometry Frame(double time, float rate, bool split = false)
+{
+  headless::BeginFrame(time);
+  ImDrawList *draw_list = ImGui::GetWindowDrawList();
+  if (split)
+    while (draw_list->_VtxCurrentIdx < (1 << 16) - 8)
+      draw_list->AddRectFilled(ImVec2(0, 0), ImVec2(1, 1), IM_COL32(0, 0, 0, 1));
+
+  const detail::DrawSliceMark mark = detail::MarkDrawSlice(draw_list);
+  ImGui::SetCursorScreenPos(pos);
+  SetNextSpinnerUpdateRate(rate);
+  SpinnerAng("##throttled", 16.f, 2.f, white, half_white, 2.8f, IM_PI * 0.75f);
+
+  Geometry g;
+  g.vtx.assign(draw_list->VtxBuffer.Data + mark.vtx_start, draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size);
+  // Past a split the indices restart at the new command's vertex offset; only the vertices are compared there.
+  if (!split)
+    for (int i = mark.idx_start; i < draw_list->IdxBuffer.Size; i++)
+      g.idx.push_back((ImDrawIdx)(draw_list->IdxBuffer[i] - mark.vtx_base));
+  headless::EndFrame();
+  return g;
+}
+
+int main()
+{
+  headless::Context context;
+  int failures = 0;
+  const float rate = 4.f;  // one update every 0.25 s
+
+  // Updates at 10.0, replays at 10.1 and 10.2, regenerates at 10.3.
+  const Geometry update = Frame(10.0, rate);
+  const Geometry replay1 = Frame(10.1, rate), replay2 = Frame(10.2, rate);
+  const Geometry regenerated = Frame(10.3, rate);
+  const Geometry live_01 = Frame(10.1, 0.f), live_03 = Frame(10.3, 0.f);
+
+  printf("throttled: %d vertices per update\n", (int)update.vtx.size());
+  if (update.vtx.empty() || replay1 != update || replay2 != update) {
+    printf("FAIL: a throttled spinner does not replay its last update before 1/rate has passed\n");
+    failures++;
+  }
+  if (live_01 == update) {
+    printf("FAIL: the spinner looks the same 0.1 s later, the replay check proves nothing\n");
+    failures++;
+  }
+  if (regenerated != live_03 || regenerated == update) {
+    printf("FAIL: a throttled spinner does not regenerate its geometry after 1/rate\n");
+    failures++;
+  }
+
+  // An update that opened a draw command can't be replayed: 0.1 s later the spinner draws live again.
+  if (sizeof(ImDrawIdx) == 2) {
+    const Geometry split = Frame(20.0, rate, true);
+    const Geometry after = Frame(20.1, rate), live = Frame(20.1, 0.f);
+    printf("split: %d vertices drawn live, next frame %s\n", (int)split.vtx.size(), after == live ? "draws live" : "replays");
+    if (split.vtx.empty() || after != live) {
+      printf("FAIL: an update that opened a draw command is replayed\n");
+      failures++;
+    }
+  }
+
+  return failures ? 1 : 0;
+}
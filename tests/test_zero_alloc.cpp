@@ -0,0 +1,54 @@
+// Steady-state spinner rendering does no heap allocation: every gallery spinner is drawn each frame, and after
+// the warm-up no spinner call may allocate, through operator new or through ImGui's allocator. The run spans
+// a state-pool eviction sweep (every 600 frames) so that path is covered too.
+
+#include "headless.h"
+#include "alloc_counter.h"
+
+int main()
+{
+  ImGui::SetAllocatorFunctions(alloc_counter::ImGuiAlloc, alloc_counter::ImGuiFree);
+  headless::Context context;
+
+  const int cells = headless::CellCount();
+  const int warmup = 620, frames = 600;
+  ImVector<long> allocations;
+  allocations.resize(cells, 0);
+
+  int peak_vtx = 0, peak_idx = 0, peak_cmd = 0;
+  for (int frame = 0; frame < warmup + frames; frame++) {
+    headless::BeginFrame(frame / 60.0);
+    ImDrawList *draw_list = ImGui::GetWindowDrawList();
+    const bool measure = frame >= warmup;
+    if (measure) {
+      // Growing the window draw list is ImGui's business, not the spinners': give it headroom up front.
+      draw_list->VtxBuffer.reserve(peak_vtx * 2);
+      draw_list->IdxBuffer.reserve(peak_idx * 2);
+      draw_list->CmdBuffer.reserve(peak_cmd * 2);
+      draw_list->_Path.reserve(ImMax(draw_list->_Path.Capacity * 2, 4096));
+    }
+
+    for (int cell = 0; cell < cells; cell++) {
+      if (measure)
+        alloc_counter::Begin();
+      headless::DrawCell(cell);
+      if (measure)
+        allocations[cell] += alloc_counter::End();
+    }
+
+    peak_vtx = ImMax(peak_vtx, draw_list->VtxBuffer.Size);
+    peak_idx = ImMax(peak_idx, draw_list->IdxBuffer.Size);
+    peak_cmd = ImMax(peak_cmd, draw_list->CmdBuffer.Size);
+    headless::EndFrame();
+  }
+
+  int offenders = 0;
+  for (int cell = 0; cell < cells; cell++) {
+    if (!allocations[cell])
+      continue;
+    printf("FAIL: cell %d (%s) allocated %ld times in %d frames\n", cell, headless::CellInfo(cell).name, allocations[cell], frames);
+    offenders++;
+  }
+  printf("%d of %d spinners allocate in steady state\n", offenders, cells);
+  return offenders ? 1 : 0;
+}